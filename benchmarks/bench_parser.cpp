@@ -0,0 +1,398 @@
+// =================================================================
+// bench_parser - StreamFixParser throughput and latency yardstick
+// =================================================================
+//
+// Replays synthetic and recorded corpora through every parser entry point:
+//   Parse/...          parse() over fixed, random-MTU and coalesced-burst fragmentation
+//   ParseBatch/...     parseBatch() over bursts, from a buffer and from a ReceiveRing
+//   ParseWithState/... the resumable incremental path
+//   Intelligent/...    parseIntelligent() per message type
+//   Optimized/...      each OptimizedParser specialization called directly
+//   Recorded/...       every capture in the corpus directory
+//
+// Each benchmark reports bytes/s, msgs/s and p50/p99/p99.9 per call latency
+// (sampled in a separate pass so clock reads do not skew throughput).
+// Recorded corpora are read from $FIX_BENCH_CORPUS_DIR, defaulting to
+// benchmarks/corpus in the source tree.
+
+#include "parser_corpus.h"
+#include "protocol/stream_fix_parser.h"
+#include "common/message_pool.h"
+#include "common/receive_ring.h"
+#include "utils/latency_histogram.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+using namespace fix_gateway;
+using protocol::FixMessage;
+using protocol::FixMsgType;
+using protocol::OptimizedParser;
+using protocol::StreamFixParser;
+
+namespace
+{
+    constexpr size_t POOL_SIZE = 4096;
+    constexpr size_t STREAM_MESSAGES = 10000;
+    constexpr size_t LATENCY_SAMPLES = 20000;
+    constexpr size_t MTU_PAYLOAD = 1460;
+    constexpr size_t BURST_SIZE = 32 * 1024; // Below the 64KB partial buffer with room for a tail
+    constexpr size_t BATCH_SIZE = 256;
+
+    struct ParserRig
+    {
+        common::MessagePool<FixMessage> pool{POOL_SIZE, "bench_pool"};
+        StreamFixParser parser{&pool};
+
+        ParserRig()
+        {
+            parser.setMaxMessageSize(BURST_SIZE);
+            parser.setValidateChecksum(true);
+        }
+
+        void release(FixMessage *message)
+        {
+            if (message)
+                pool.deallocate(message);
+        }
+    };
+
+    const std::string &mixedCorpus()
+    {
+        static const std::string stream = bench::mixedStream(STREAM_MESSAGES);
+        return stream;
+    }
+
+    const std::string &corruptedCorpus()
+    {
+        static const std::string stream = []()
+        {
+            std::string s = bench::mixedStream(STREAM_MESSAGES);
+            bench::corrupt(s, 4096);
+            return s;
+        }();
+        return stream;
+    }
+
+    // Time `samples` individual calls and attach percentile counters
+    void reportLatency(benchmark::State &state, const std::function<void(size_t)> &call)
+    {
+        utils::LatencyHistogram histogram;
+        for (size_t i = 0; i < LATENCY_SAMPLES; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            call(i);
+            auto end = std::chrono::steady_clock::now();
+            histogram.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        }
+
+        auto snap = histogram.snapshot();
+        state.counters["p50_ns"] = static_cast<double>(snap.percentile(50.0));
+        state.counters["p99_ns"] = static_cast<double>(snap.percentile(99.0));
+        state.counters["p99.9_ns"] = static_cast<double>(snap.percentile(99.9));
+    }
+
+    void reportThroughput(benchmark::State &state, uint64_t messages, size_t bytes_per_iteration)
+    {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes_per_iteration));
+        state.counters["msgs/s"] = benchmark::Counter(static_cast<double>(messages), benchmark::Counter::kIsRate);
+    }
+
+    // chunk == 0 selects random sizes up to one MTU
+    std::vector<std::string_view> split(const std::string &stream, size_t chunk)
+    {
+        return chunk ? bench::fragment(stream, chunk) : bench::fragmentRandom(stream, MTU_PAYLOAD);
+    }
+
+    // =================================================================
+    // STREAM BENCHMARKS
+    // =================================================================
+
+    void benchParse(benchmark::State &state, const std::string &stream, size_t chunk)
+    {
+        ParserRig rig;
+        rig.parser.setMaxConsecutiveErrors(SIZE_MAX); // Keep recovering through corrupted corpora
+        auto pieces = split(stream, chunk);
+
+        auto feed = [&](std::string_view piece)
+        {
+            auto result = rig.parser.parse(piece.data(), piece.size());
+            rig.release(result.parsed_message);
+        };
+
+        uint64_t parsed_before = rig.parser.getStats().messages_parsed;
+        for (auto _ : state)
+        {
+            for (std::string_view piece : pieces)
+            {
+                feed(piece);
+            }
+            rig.parser.reset();
+        }
+        reportThroughput(state, rig.parser.getStats().messages_parsed - parsed_before, stream.size());
+
+        reportLatency(state, [&](size_t i)
+                      { feed(pieces[i % pieces.size()]); });
+        rig.parser.reset();
+    }
+
+    void benchParseBatch(benchmark::State &state, const std::string &stream)
+    {
+        ParserRig rig;
+        auto pieces = bench::fragment(stream, BURST_SIZE);
+        FixMessage *batch[BATCH_SIZE];
+        uint64_t messages = 0;
+
+        auto feed = [&](std::string_view piece)
+        {
+            size_t offset = 0;
+            while (offset < piece.size())
+            {
+                auto result = rig.parser.parseBatch(piece.data() + offset, piece.size() - offset, batch, BATCH_SIZE);
+                for (size_t i = 0; i < result.messages_parsed; ++i)
+                {
+                    rig.release(batch[i]);
+                }
+                messages += result.messages_parsed;
+                if (result.bytes_consumed == 0)
+                    break;
+                offset += result.bytes_consumed;
+            }
+        };
+
+        for (auto _ : state)
+        {
+            for (std::string_view piece : pieces)
+            {
+                feed(piece);
+            }
+            rig.parser.reset();
+        }
+        reportThroughput(state, messages, stream.size());
+
+        reportLatency(state, [&](size_t i)
+                      { feed(pieces[i % pieces.size()]); });
+        rig.parser.reset();
+    }
+
+    void benchParseBatchRing(benchmark::State &state, const std::string &stream)
+    {
+        ParserRig rig;
+        common::ReceiveRing ring(4 * BURST_SIZE);
+        auto pieces = bench::fragment(stream, MTU_PAYLOAD);
+        FixMessage *batch[BATCH_SIZE];
+        uint64_t messages = 0;
+
+        // One recv() worth of bytes lands in the ring, then everything complete is decoded in place
+        auto feed = [&](std::string_view piece)
+        {
+            std::memcpy(ring.writePtr(), piece.data(), piece.size());
+            ring.commit(piece.size());
+            for (;;)
+            {
+                auto result = rig.parser.parseBatch(ring, batch, BATCH_SIZE);
+                for (size_t i = 0; i < result.messages_parsed; ++i)
+                {
+                    rig.release(batch[i]);
+                }
+                messages += result.messages_parsed;
+                if (result.messages_parsed < BATCH_SIZE)
+                    break;
+            }
+        };
+
+        for (auto _ : state)
+        {
+            for (std::string_view piece : pieces)
+            {
+                feed(piece);
+            }
+            ring.reset();
+        }
+        reportThroughput(state, messages, stream.size());
+
+        reportLatency(state, [&](size_t i)
+                      {
+            if (i % pieces.size() == 0)
+                ring.reset();
+            feed(pieces[i % pieces.size()]); });
+    }
+
+    void benchParseWithState(benchmark::State &state, const std::string &stream, size_t chunk)
+    {
+        ParserRig rig;
+        StreamFixParser::ParseContext context;
+        auto pieces = split(stream, chunk);
+        std::string retained;
+        retained.reserve(64 * 1024);
+        uint64_t messages = 0;
+
+        auto feed = [&](std::string_view piece)
+        {
+            retained.append(piece.data(), piece.size());
+            for (;;)
+            {
+                auto result = rig.parser.parseWithState(retained.data(), retained.size(), context);
+                if (result.status == StreamFixParser::ParseStatus::Success)
+                {
+                    rig.release(result.parsed_message);
+                    retained.erase(0, result.bytes_consumed);
+                    ++messages;
+                    continue;
+                }
+                if (result.status != StreamFixParser::ParseStatus::NeedMoreData)
+                {
+                    retained.clear();
+                    context.reset();
+                }
+                break;
+            }
+        };
+
+        for (auto _ : state)
+        {
+            for (std::string_view piece : pieces)
+            {
+                feed(piece);
+            }
+            retained.clear();
+            context.reset();
+        }
+        reportThroughput(state, messages, stream.size());
+
+        reportLatency(state, [&](size_t i)
+                      { feed(pieces[i % pieces.size()]); });
+    }
+
+    // =================================================================
+    // SINGLE MESSAGE BENCHMARKS
+    // =================================================================
+
+    using Decoder = StreamFixParser::ParseResult (*)(StreamFixParser *, const char *, size_t);
+
+    void benchDecode(benchmark::State &state, const std::string &message, Decoder decode)
+    {
+        ParserRig rig;
+        uint64_t messages = 0;
+
+        auto call = [&]()
+        {
+            auto result = decode(&rig.parser, message.data(), message.size());
+            messages += result.status == StreamFixParser::ParseStatus::Success;
+            rig.release(result.parsed_message);
+        };
+
+        for (auto _ : state)
+        {
+            call();
+        }
+        reportThroughput(state, messages, message.size());
+
+        reportLatency(state, [&](size_t)
+                      { call(); });
+    }
+
+    StreamFixParser::ParseResult intelligent(StreamFixParser *parser, const char *buffer, size_t length)
+    {
+        return parser->parseIntelligent(buffer, length);
+    }
+
+    void registerAll()
+    {
+        const std::string &mixed = mixedCorpus();
+
+        const std::pair<const char *, size_t> fragmentations[] = {
+            {"frag7", 7}, {"frag64", 64}, {"mtu", MTU_PAYLOAD}, {"random_mtu", 0}, {"burst32k", BURST_SIZE}};
+        for (const auto &[name, chunk] : fragmentations)
+        {
+            size_t size = chunk;
+            benchmark::RegisterBenchmark((std::string("Parse/mixed/") + name).c_str(),
+                                         [&mixed, size](benchmark::State &state)
+                                         { benchParse(state, mixed, size); });
+        }
+        benchmark::RegisterBenchmark("Parse/corrupted/mtu", [](benchmark::State &state)
+                                     { benchParse(state, corruptedCorpus(), MTU_PAYLOAD); });
+
+        benchmark::RegisterBenchmark("ParseBatch/mixed/burst32k", [&mixed](benchmark::State &state)
+                                     { benchParseBatch(state, mixed); });
+        benchmark::RegisterBenchmark("ParseBatch/mixed/ring_mtu", [&mixed](benchmark::State &state)
+                                     { benchParseBatchRing(state, mixed); });
+
+        benchmark::RegisterBenchmark("ParseWithState/mixed/frag64", [&mixed](benchmark::State &state)
+                                     { benchParseWithState(state, mixed, 64); });
+        benchmark::RegisterBenchmark("ParseWithState/mixed/random_mtu", [&mixed](benchmark::State &state)
+                                     { benchParseWithState(state, mixed, 0); });
+
+        static const std::pair<const char *, std::string> messages[] = {
+            {"ExecutionReport", bench::executionReport(1)},
+            {"Heartbeat", bench::heartbeat(1)},
+            {"TestRequest", bench::testRequest(1)},
+            {"ResendRequest", bench::resendRequest(1)},
+            {"Reject", bench::reject(1)},
+            {"OrderCancelReject", bench::orderCancelReject(1)},
+            {"MarketDataSnapshot", bench::marketDataSnapshot(1)},
+        };
+        for (const auto &[name, message] : messages)
+        {
+            const std::string *msg = &message;
+            benchmark::RegisterBenchmark((std::string("Intelligent/") + name).c_str(),
+                                         [msg](benchmark::State &state)
+                                         { benchDecode(state, *msg, &intelligent); });
+        }
+
+        static const std::pair<const char *, Decoder> specializations[] = {
+            {"ExecutionReport", &OptimizedParser<FixMsgType::EXECUTION_REPORT>::parseExecutionReport},
+            {"Heartbeat", &OptimizedParser<FixMsgType::HEARTBEAT>::parseHeartbeat},
+            {"TestRequest", &OptimizedParser<FixMsgType::TEST_REQUEST>::parseTestRequest},
+            {"ResendRequest", &OptimizedParser<FixMsgType::RESEND_REQUEST>::parseResendRequest},
+            {"Reject", &OptimizedParser<FixMsgType::REJECT>::parseReject},
+            {"OrderCancelReject", &OptimizedParser<FixMsgType::ORDER_CANCEL_REJECT>::parseOrderCancelReject},
+        };
+        for (const auto &[name, decode] : specializations)
+        {
+            const std::string *msg = nullptr;
+            for (const auto &[message_name, message] : messages)
+            {
+                if (std::strcmp(message_name, name) == 0)
+                    msg = &message;
+            }
+            Decoder decoder = decode;
+            benchmark::RegisterBenchmark((std::string("Optimized/") + name).c_str(),
+                                         [msg, decoder](benchmark::State &state)
+                                         { benchDecode(state, *msg, decoder); });
+        }
+
+        // Recorded captures, replayed at MTU fragmentation
+        const char *dir = std::getenv("FIX_BENCH_CORPUS_DIR");
+        std::filesystem::path corpus_dir = dir ? dir : FIX_BENCH_CORPUS_DIR;
+        std::error_code ec;
+        for (const auto &entry : std::filesystem::directory_iterator(corpus_dir, ec))
+        {
+            auto capture = std::make_shared<std::string>();
+            if (!entry.is_regular_file() || !bench::loadRecorded(entry.path().string(), *capture) || capture->empty())
+                continue;
+
+            benchmark::RegisterBenchmark(("Recorded/" + entry.path().filename().string()).c_str(),
+                                         [capture](benchmark::State &state)
+                                         { benchParse(state, *capture, MTU_PAYLOAD); });
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    registerAll();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
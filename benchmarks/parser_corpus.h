@@ -0,0 +1,180 @@
+#pragma once
+
+#include "protocol/fix_checksum.h"
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fix_gateway::bench
+{
+    // =================================================================
+    // PARSER CORPORA - Synthetic and recorded inbound traffic
+    // =================================================================
+    //
+    // Shared by bench_parser and fuzz_parser. Synthetic messages are framed
+    // with a standard BodyLength (trailer excluded) and a correct CheckSum;
+    // recorded corpora are raw concatenated FIX bytes as captured from a
+    // session (one file per capture).
+
+    inline std::string frame(std::string_view body)
+    {
+        std::string msg = "8=FIX.4.4\x01"
+                          "9=" + std::to_string(body.size()) + "\x01";
+        msg.append(body.data(), body.size());
+
+        char digits[3];
+        protocol::FixChecksum::format(protocol::FixChecksum::compute(msg.data(), msg.size()), digits);
+        msg += "10=";
+        msg.append(digits, 3);
+        msg += '\x01';
+        return msg;
+    }
+
+    inline std::string header(const char *msg_type, uint32_t seq)
+    {
+        return std::string("35=") + msg_type + "\x01" + "49=EXCHANGE\x01" + "56=CLIENT\x01" +
+               "34=" + std::to_string(seq) + "\x01" + "52=20231201-10:30:00.123\x01";
+    }
+
+    inline std::string executionReport(uint32_t seq)
+    {
+        std::string id = std::to_string(seq);
+        return frame(header("8", seq) + "37=ORD" + id + "\x01" + "11=CL" + id + "\x01" + "17=EX" + id + "\x01" +
+                     "150=F\x01"
+                     "39=2\x01"
+                     "55=AAPL\x01"
+                     "54=1\x01"
+                     "38=100\x01"
+                     "44=150.25\x01"
+                     "32=100\x01"
+                     "31=150.25\x01"
+                     "151=0\x01"
+                     "14=100\x01"
+                     "6=150.25\x01");
+    }
+
+    inline std::string heartbeat(uint32_t seq) { return frame(header("0", seq)); }
+
+    inline std::string testRequest(uint32_t seq)
+    {
+        return frame(header("1", seq) + "112=TEST" + std::to_string(seq) + "\x01");
+    }
+
+    inline std::string resendRequest(uint32_t seq)
+    {
+        return frame(header("2", seq) +
+                     "7=1\x01"
+                     "16=0\x01");
+    }
+
+    inline std::string reject(uint32_t seq)
+    {
+        return frame(header("3", seq) +
+                     "45=1\x01"
+                     "371=44\x01"
+                     "373=5\x01"
+                     "58=Value is incorrect for this tag\x01");
+    }
+
+    inline std::string orderCancelReject(uint32_t seq)
+    {
+        return frame(header("9", seq) + "11=CL" + std::to_string(seq) + "\x01" +
+                     "37=ORD1\x01"
+                     "39=8\x01"
+                     "102=0\x01");
+    }
+
+    // MarketDataSnapshot with a repeating NoMDEntries group
+    inline std::string marketDataSnapshot(uint32_t seq, int entries = 10)
+    {
+        std::string body = header("W", seq) + "262=MD1\x01" + "55=AAPL\x01" +
+                           "268=" + std::to_string(entries) + "\x01";
+        for (int i = 0; i < entries; ++i)
+        {
+            body += std::string("269=") + (i % 2 ? "1" : "0") + "\x01";
+            body += "270=150." + std::to_string(10 + i) + "\x01";
+            body += "271=" + std::to_string(100 * (i + 1)) + "\x01";
+        }
+        return frame(body);
+    }
+
+    // Inbound mix seen by a trading client: mostly fills, some market data
+    // and session traffic
+    inline std::string mixedStream(size_t count, uint32_t seed = 42)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> pick(0, 99);
+        std::string stream;
+        for (uint32_t seq = 1; seq <= count; ++seq)
+        {
+            int p = pick(rng);
+            if (p < 55)
+                stream += executionReport(seq);
+            else if (p < 75)
+                stream += marketDataSnapshot(seq);
+            else if (p < 85)
+                stream += heartbeat(seq);
+            else if (p < 90)
+                stream += testRequest(seq);
+            else if (p < 94)
+                stream += orderCancelReject(seq);
+            else if (p < 97)
+                stream += reject(seq);
+            else
+                stream += resendRequest(seq);
+        }
+        return stream;
+    }
+
+    // Fragment boundaries: fixed chunk size, or uniformly random in [1, max_chunk]
+    inline std::vector<std::string_view> fragment(std::string_view stream, size_t chunk)
+    {
+        std::vector<std::string_view> pieces;
+        for (size_t offset = 0; offset < stream.size(); offset += chunk)
+        {
+            pieces.push_back(stream.substr(offset, chunk));
+        }
+        return pieces;
+    }
+
+    inline std::vector<std::string_view> fragmentRandom(std::string_view stream, size_t max_chunk,
+                                                        uint32_t seed = 7)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> size(1, max_chunk);
+        std::vector<std::string_view> pieces;
+        for (size_t offset = 0; offset < stream.size();)
+        {
+            size_t chunk = size(rng);
+            pieces.push_back(stream.substr(offset, chunk));
+            offset += chunk;
+        }
+        return pieces;
+    }
+
+    // Overwrite roughly one byte in every `interval` with noise
+    inline void corrupt(std::string &stream, size_t interval, uint32_t seed = 13)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> gap(1, 2 * interval);
+        std::uniform_int_distribution<int> noise(0, 255);
+        for (size_t pos = gap(rng); pos < stream.size(); pos += gap(rng))
+        {
+            stream[pos] = static_cast<char>(noise(rng));
+        }
+    }
+
+    inline bool loadRecorded(const std::string &path, std::string &out)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            return false;
+        out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+} // namespace fix_gateway::bench
@@ -4,6 +4,8 @@
 #include "protocol/stream_fix_parser.h"
 #include "protocol/fix_message.h"
 #include "common/message_pool.h"
+#include "common/receive_segment.h"
+#include "common/receive_ring.h"
 #include "manager/message_router.h"
 #include "priority_queue_container.h"
 #include <functional>
@@ -86,6 +88,20 @@ namespace fix_gateway::application
         void setValidateChecksum(bool validate);
         void setStrictValidation(bool strict);
 
+        // Classify frames by MsgType and a few peeked tags before decode (call
+        // before connect). Only Parse frames are allocated and routed; PassThrough
+        // frames go to handler as raw bytes on the receive thread. Refused (false)
+        // if it filters session-level messages, which must reach the session's
+        // sequence number check.
+        bool setPrefilter(const protocol::MessagePrefilter &prefilter,
+                          protocol::StreamFixParser::PassThroughHandler handler = nullptr);
+
+        // View mode (call before connect): recv() lands in pinned, ref-counted
+        // segments and parsed messages reference them instead of copying field
+        // values. A segment is recycled once its last message is deallocated.
+        void enableMessageViews(size_t segment_count = common::ReceiveSegmentPool::DEFAULT_SEGMENT_COUNT);
+        bool messageViewsEnabled() const { return segment_pool_ != nullptr; }
+
         // =================================================================
         // MESSAGE ROUTING
         // =================================================================
@@ -104,22 +120,37 @@ namespace fix_gateway::application
         // TCP data callback - receives raw network buffer
         void onTcpDataReceived(const char *buffer, size_t length);
 
+        // View-mode variant - parser may pin the segment in the messages it produces
+        void onTcpSegmentReceived(common::ReceiveSegment *segment, size_t length);
+
+        // Ring variant (default) - frames are decoded in place, the tail stays in the ring
+        void onTcpRingData(common::ReceiveRing &ring);
+
+        // Route parsed messages and report drops/errors of one parseBatch() call
+        void handleBatchResult(protocol::FixMessage **batch, const protocol::StreamFixParser::BatchParseResult &batch_result);
+
         // TCP error callback
         void onTcpError(const std::string &error);
 
         // TCP disconnect callback
         void onTcpDisconnect();
 
-        // Process parsed FIX message
-        void processParsedMessage(protocol::FixMessage *message);
+        // Route every message parsed from one receive buffer as a single burst
+        void processParsedBatch(protocol::FixMessage **messages, size_t count);
+
+        // Upper bound on messages handed to the router per parseBatch() call
+        static constexpr size_t MAX_PARSE_BATCH = 64;
 
         // =================================================================
         // MEMBER VARIABLES
         // =================================================================
 
-        // Core components
+        // Core components (segments outlive every message that may pin them)
+        std::unique_ptr<common::ReceiveSegmentPool> segment_pool_;
+        std::unique_ptr<common::ReceiveRing> receive_ring_; // Outlives the receive thread
         std::unique_ptr<network::TcpConnection> tcp_connection_;
         std::unique_ptr<protocol::StreamFixParser> fix_parser_;
+        std::unique_ptr<protocol::MessagePrefilter> prefilter_;
         std::unique_ptr<common::MessagePool<protocol::FixMessage>> message_pool_;
 
         // Message routing
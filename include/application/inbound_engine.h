@@ -0,0 +1,231 @@
+#pragma once
+
+#include "network/tcp_connection.h"
+#include "protocol/stream_fix_parser.h"
+#include "protocol/fix_message.h"
+#include "common/message_pool.h"
+#include "common/receive_ring.h"
+#include "manager/message_router.h"
+#include "utils/latency_histogram.h"
+#include "priority_queue_container.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fix_gateway::application
+{
+    // =================================================================
+    // INBOUND ENGINE - Session-sharded receive/parse workers
+    // =================================================================
+    //
+    // FixGateway runs one connection through one parser on one receive
+    // thread. The engine spreads many sessions over N workers instead: each
+    // worker owns a set of connections (every session keeps its own receive
+    // ring and StreamFixParser), parses into a worker-local MessagePool and
+    // routes into its own PriorityQueueContainer. A worker is the only
+    // producer of its queues, so every lane is single-producer/single-consumer
+    // and the managers behind them see all sessions in one process.
+    //
+    //   session ─┐                      ┌─> worker 0 queues ─┐
+    //   session ─┼─> worker 0 (core 4) ─┘                    ├─> pollMessages() ─> managers
+    //   session ─┼─> worker 1 (core 5) ───> worker 1 queues ─┘
+    //
+    // Consumers: one thread per priority lane calls pollMessages(), and every
+    // message goes back through releaseMessage() (it finds the owning pool).
+
+    class InboundEngine
+    {
+    public:
+        using SessionId = uint32_t; // 0 is never a valid session
+        using ErrorCallback = std::function<void(SessionId, const std::string &)>;
+        using PassThroughCallback = std::function<void(SessionId, protocol::FixMsgType, const char *, size_t)>;
+
+        struct Config
+        {
+            size_t worker_count = 2;
+
+            // Worker i runs on worker_cores[i] if given, else first_core + i.
+            // The default leaves cores 0-3 to the AsyncSender threads.
+            bool enable_core_pinning = true;
+            int first_core = 4;
+            std::vector<int> worker_cores;
+
+            size_t worker_pool_size = 8192;              // Messages in each worker-local pool
+            size_t worker_pool_max_size = 0;             // Growth ceiling per pool; grows by worker_pool_size (0 = fixed)
+            bool worker_pool_huge_pages = false;         // Hugepage/THP-backed pool slabs
+            size_t session_ring_capacity = 1024 * 1024; // Receive ring per session
+
+            // Empty passes over all sockets before the worker blocks in poll()
+            // (bounded by idle_poll_timeout_ms so stop() and new sessions are seen)
+            size_t idle_spins = 1000;
+            int idle_poll_timeout_ms = 1;
+
+            // Shared by every session parser; frames it does not Parse are never allocated
+            std::shared_ptr<const protocol::MessagePrefilter> prefilter;
+        };
+
+        struct SessionStats
+        {
+            SessionId session_id = 0;
+            size_t worker = 0;
+            bool active = false;
+            std::string remote;
+            uint64_t messages_parsed = 0;
+            uint64_t messages_dropped = 0;  // Malformed frames skipped by the parser
+            uint64_t messages_filtered = 0; // Passed through or dropped by the prefilter
+            uint64_t parse_errors = 0;
+        };
+
+        struct WorkerStats
+        {
+            size_t worker = 0;
+            int core = -1;
+            bool pinned = false;
+            size_t sessions = 0;
+            uint64_t messages_published = 0;
+            uint64_t queue_full_drops = 0; // Parsed but the lane was full - returned to the pool
+            uint64_t idle_waits = 0;
+            common::MessagePool<protocol::FixMessage>::PoolStats pool{};
+        };
+
+        InboundEngine();
+        explicit InboundEngine(const Config &config);
+        ~InboundEngine();
+
+        // Non-copyable, non-movable (workers hold pointers into the engine)
+        InboundEngine(const InboundEngine &) = delete;
+        InboundEngine &operator=(const InboundEngine &) = delete;
+
+        // =================================================================
+        // LIFECYCLE
+        // =================================================================
+
+        void start();
+        void stop(); // Joins the workers; sessions stay connected until destruction
+        bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+        // =================================================================
+        // SESSIONS - may be added before or after start()
+        // =================================================================
+
+        // Connect (blocking, bounded by the connection timeout) and hand the
+        // session to the least loaded worker. Returns 0 if the connect fails.
+        SessionId addSession(const std::string &host, int port);
+
+        // Take over an already connected connection. worker < 0 picks the least
+        // loaded one. The connection must not run its own receive loop.
+        SessionId addSession(std::unique_ptr<network::TcpConnection> connection, int worker = -1);
+
+        // Called on the worker thread for parse errors and connection loss (set before start())
+        void setErrorCallback(ErrorCallback callback) { error_callback_ = std::move(callback); }
+
+        // Called on the worker thread with raw PassThrough frames (set before start())
+        void setPassThroughCallback(PassThroughCallback callback) { pass_through_callback_ = std::move(callback); }
+
+        // =================================================================
+        // CONSUMER SIDE
+        // =================================================================
+
+        // Drain up to max messages of one priority lane across all workers,
+        // starting from a different worker each call. At most one thread per
+        // priority may call this.
+        size_t pollMessages(Priority priority, protocol::FixMessage **out, size_t max);
+
+        // Return a message to the worker pool it was allocated from
+        bool releaseMessage(protocol::FixMessage *message);
+
+        // Direct access to one worker's lanes (e.g. to bind a manager to them)
+        std::shared_ptr<PriorityQueueContainer> getWorkerQueues(size_t worker) const;
+
+        // =================================================================
+        // MONITORING
+        // =================================================================
+
+        size_t workerCount() const { return workers_.size(); }
+        std::vector<SessionStats> getSessionStats() const;
+        WorkerStats getWorkerStats(size_t worker) const;
+
+    private:
+        using Counter = utils::SingleWriterCounter;
+
+        // Upper bound on messages decoded per parseBatch() call
+        static constexpr size_t MAX_PARSE_BATCH = 64;
+        static constexpr size_t PRIORITY_COUNT = 4;
+
+        struct Session
+        {
+            SessionId id = 0;
+            std::string remote;
+            std::unique_ptr<common::ReceiveRing> ring; // Outlives the connection using it
+            std::unique_ptr<network::TcpConnection> connection;
+            std::unique_ptr<protocol::StreamFixParser> parser;
+
+            std::atomic<bool> active{true};
+            bool retry_parse = false; // Pool was exhausted with frames left in the ring - reads paused
+
+            Counter messages_parsed;
+            Counter messages_dropped;
+            Counter messages_filtered;
+            Counter parse_errors;
+        };
+
+        struct Worker
+        {
+            size_t index = 0;
+            int core = -1;
+            std::atomic<bool> pinned{false};
+            std::atomic<bool> placed{false}; // Affinity settled - the worker may touch its pool
+
+            // Pool first: sessions' parsers allocate from it and die before it
+            std::unique_ptr<common::MessagePool<protocol::FixMessage>> pool;
+            std::shared_ptr<PriorityQueueContainer> queues;
+            std::unique_ptr<manager::MessageRouter> router;
+
+            // Owned by the worker thread; only changed under pending_mutex so
+            // monitoring can read it
+            std::vector<std::unique_ptr<Session>> sessions;
+
+            // Hand-off from addSession()
+            mutable std::mutex pending_mutex;
+            std::vector<std::unique_ptr<Session>> pending;
+            std::atomic<bool> has_pending{false};
+            std::atomic<size_t> session_count{0};
+
+            Counter messages_published;
+            Counter queue_full_drops;
+            Counter idle_waits;
+
+            std::thread thread;
+        };
+
+        // Worker thread
+        void workerLoop(Worker &worker);
+        void adoptPendingSessions(Worker &worker);
+        void removeClosedSessions(Worker &worker);
+        bool pollSession(Worker &worker, Session &session);
+        void onSessionData(Worker &worker, Session &session, common::ReceiveRing &ring);
+        void publish(Worker &worker, Session &session, protocol::FixMessage **messages, size_t count);
+        void waitForData(Worker &worker);
+        void placeWorker(Worker &worker, unsigned hardware_cores);
+        void reportError(Session &session, const std::string &error);
+
+        size_t leastLoadedWorker() const;
+        int coreForWorker(size_t index) const;
+
+        Config config_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::atomic<bool> running_{false};
+        std::atomic<SessionId> next_session_id_{1};
+        ErrorCallback error_callback_;
+        PassThroughCallback pass_through_callback_;
+
+        // Per-lane round-robin start (each lane has a single consumer)
+        std::array<size_t, PRIORITY_COUNT> poll_cursor_{};
+    };
+
+} // namespace fix_gateway::application
@@ -7,20 +7,40 @@
 #include <memory>
 #include <array>
 
+// One queue per priority lane. The default mode is MPSC: a container handed
+// to several managers (router, session, business logic, gap manager) gets
+// pushes from all their threads. Pass SPSC only where a single thread is
+// wired up as the producer, e.g. an InboundEngine worker's own lanes.
+//
+// Each lane has its own consumer wait policy (WaitConfig::forLane by
+// default). Put CRITICAL on BusySpin only when its consumer owns a core.
 class PriorityQueueContainer
 {
 public:
     using FixMessage = fix_gateway::protocol::FixMessage;
     using LockFreeQueue = fix_gateway::utils::LockFreeQueue<FixMessage *>;
+    using QueueMode = fix_gateway::utils::QueueMode;
+    using WaitConfig = fix_gateway::utils::WaitConfig;
     using FixMessageQueuePtr = std::shared_ptr<LockFreeQueue>;
     using QueueArray = std::array<FixMessageQueuePtr, 4>;
 
-    PriorityQueueContainer()
+    explicit PriorityQueueContainer(QueueMode mode = QueueMode::MPSC)
+        : mode_(mode)
     {
-        queues_[getPriorityIndex(Priority::CRITICAL)] = std::make_shared<LockFreeQueue>(2048, "critical_queue");
-        queues_[getPriorityIndex(Priority::HIGH)] = std::make_shared<LockFreeQueue>(2048, "high_queue");
-        queues_[getPriorityIndex(Priority::MEDIUM)] = std::make_shared<LockFreeQueue>(1024, "medium_queue");
-        queues_[getPriorityIndex(Priority::LOW)] = std::make_shared<LockFreeQueue>(512, "low_queue");
+        queues_[getPriorityIndex(Priority::CRITICAL)] = std::make_shared<LockFreeQueue>(2048, "critical_queue", mode);
+        queues_[getPriorityIndex(Priority::HIGH)] = std::make_shared<LockFreeQueue>(2048, "high_queue", mode);
+        queues_[getPriorityIndex(Priority::MEDIUM)] = std::make_shared<LockFreeQueue>(1024, "medium_queue", mode);
+        queues_[getPriorityIndex(Priority::LOW)] = std::make_shared<LockFreeQueue>(512, "low_queue", mode);
+
+        for (size_t lane = 0; lane < queues_.size(); ++lane)
+        {
+            queues_[lane]->setWaitStrategy(WaitConfig::forLane(lane));
+        }
+    }
+
+    QueueMode getMode() const
+    {
+        return mode_;
     }
 
     int getPriorityIndex(Priority priority)
@@ -28,6 +48,12 @@ public:
         return static_cast<int>(priority);
     }
 
+    // Before the lane's consumer starts
+    void setWaitStrategy(Priority priority, const WaitConfig &config)
+    {
+        queues_[getPriorityIndex(priority)]->setWaitStrategy(config);
+    }
+
     FixMessageQueuePtr getQueue(Priority priority)
     {
         return queues_[getPriorityIndex(priority)];
@@ -39,5 +65,6 @@ public:
     }
 
 private:
+    QueueMode mode_;
     QueueArray queues_;
 };
\ No newline at end of file
@@ -23,6 +23,7 @@ namespace fix_gateway
         constexpr int RECV_TIMEOUT_MS = 1000;       // 1 second
         constexpr int SEND_TIMEOUT_MS = 1000;       // 1 second
         constexpr int RECONNECT_DELAY_MS = 1000;    // 1 second between reconnect attempts
+        constexpr int RING_STALL_TIMEOUT_MS = 1000; // Full receive ring reported after 1 second
         constexpr int MAX_RECONNECT_ATTEMPTS = 5;
 
         // =============================================================================
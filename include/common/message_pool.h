@@ -1,6 +1,8 @@
 #pragma once
 
 #include "common/message.h"
+#include "common/slab_memory.h"
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <cstddef>
@@ -8,18 +10,220 @@
 #include <string>
 #include <sstream>
 #include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fix_gateway::common
 {
+    namespace detail
+    {
+        // =================================================================
+        // THREAD MAGAZINES - per-thread caches of free slot indices
+        // =================================================================
+        //
+        // A magazine belongs to one (thread, pool) pair. Only its owner thread
+        // adds slots; the counters are single-writer atomics so monitoring
+        // threads can aggregate them. The owner moves slots to and from the
+        // pool's shared free list in batches, so the shared head (and its
+        // cache line) is hit once per MAGAZINE_BATCH operations instead of on
+        // every allocate/deallocate.
+        //
+        // state packs a version (high 32 bits) with the slot count (low 32).
+        // The owner changes it by CAS on its own, uncontended line; a pool
+        // that runs dry empties other threads' magazines with one CAS of
+        // state to count 0 (steal). Every change bumps the version, so a
+        // steal that raced with the owner's pop + push fails and retries.
+
+        struct alignas(64) PoolMagazine
+        {
+            static constexpr uint32_t CAPACITY = 64;
+
+            std::atomic<uint64_t> state{0};
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> deallocations{0};
+            std::atomic<uint64_t> allocation_failures{0};
+
+            std::atomic<bool> orphaned{false}; // Owner thread exited - slots may be reclaimed
+            std::atomic<bool> retired{false};  // Pool destroyed - the thread drops its handle
+
+            std::atomic<int32_t> slots[CAPACITY] = {};
+
+            static uint32_t countOf(uint64_t state) { return static_cast<uint32_t>(state); }
+            static uint64_t nextState(uint64_t state, uint32_t count)
+            {
+                return ((state >> 32) + 1) << 32 | count;
+            }
+            uint32_t count() const { return countOf(state.load(std::memory_order_relaxed)); }
+
+            // Single-writer increment (plain load/store, no locked RMW)
+            static void bump(std::atomic<uint64_t> &counter)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        };
+
+        // The calling thread's magazines, one per pool it has used. Flags them
+        // orphaned on thread exit so the pool can reclaim or hand them on.
+        class ThreadMagazines
+        {
+        public:
+            static ThreadMagazines &local()
+            {
+                static thread_local ThreadMagazines instance;
+                return instance;
+            }
+
+            // found is false if this thread never registered with the pool;
+            // a registered thread may hold no magazine (nullptr)
+            PoolMagazine *find(uint64_t pool_id, bool &found)
+            {
+                if (last_pool_id_ == pool_id)
+                {
+                    found = true;
+                    return last_magazine_;
+                }
+                for (auto &held : held_)
+                {
+                    if (held.first == pool_id)
+                    {
+                        remember(pool_id, held.second.get());
+                        found = true;
+                        return held.second.get();
+                    }
+                }
+                found = false;
+                return nullptr;
+            }
+
+            void add(uint64_t pool_id, std::shared_ptr<PoolMagazine> magazine)
+            {
+                // Forget magazines of destroyed pools while we are off the fast path
+                for (size_t i = 0; i < held_.size();)
+                {
+                    if (held_[i].second && held_[i].second->retired.load(std::memory_order_acquire))
+                    {
+                        held_[i] = std::move(held_.back());
+                        held_.pop_back();
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+                remember(pool_id, magazine.get());
+                held_.emplace_back(pool_id, std::move(magazine));
+            }
+
+            ~ThreadMagazines()
+            {
+                for (auto &held : held_)
+                {
+                    if (held.second)
+                    {
+                        held.second->orphaned.store(true, std::memory_order_release);
+                    }
+                }
+            }
+
+        private:
+            void remember(uint64_t pool_id, PoolMagazine *magazine)
+            {
+                last_pool_id_ = pool_id;
+                last_magazine_ = magazine;
+            }
+
+            uint64_t last_pool_id_ = 0; // Pool ids start at 1
+            PoolMagazine *last_magazine_ = nullptr;
+            std::vector<std::pair<uint64_t, std::shared_ptr<PoolMagazine>>> held_;
+        };
+
+        // Unique per pool instance - an address could be reused by a later pool
+        inline std::atomic<uint64_t> next_pool_id{1};
+    }
+
+    // Sizing and placement of a MessagePool. Slots come in slabs of
+    // initial_size; a pool with max_size above that grows a slab at a time.
+    struct PoolConfig
+    {
+        size_t initial_size = 8192;   // Slots in every slab
+        size_t max_size = 0;          // Slot ceiling (0 = initial_size: fixed pool)
+        double grow_watermark = 0.75; // maintain() adds a slab at this utilization
+        bool emergency_growth = true; // An exhausted allocation grows inline instead of failing
+        bool huge_pages = false;      // Hugepage (or THP) backed slabs where supported
+        bool numa_local = true;       // Bind later slabs to the node that ran prewarm()
+    };
+
+    // =================================================================
+    // SEGREGATED LAYOUT - hot headers apart from cold payloads
+    // =================================================================
+    //
+    // A type that specializes PoolHeaderTraits gets a second, dense array per
+    // slab: one Header (a few fields such as type, sequence number, priority
+    // and timestamps) per slot. Code that only needs those fields reads them
+    // through MessagePool::headerOf() and never touches the object itself, so
+    // a router scanning a burst stays within a few header lines. The payload
+    // slots of such a type are packed at alignof(T) - its hot fields are no
+    // longer the reason to start every object on a fresh cache line.
+    //
+    // Header must be trivially destructible; a value-initialized Header is
+    // the header of a free slot, and the pool constructs one per slot when it
+    // maps a slab. attach() runs after each construction in the pool and
+    // points the object at its slot's header. forEachHeader() reads headers
+    // while their owners write them, so fields a monitor reads from another
+    // thread must be atomics (FixMessageHeader uses relaxed HeaderFields).
+
+    struct NoPoolHeader
+    {
+    };
+
+    template <typename T>
+    struct PoolHeaderTraits
+    {
+        static constexpr bool segregated = false;
+        using Header = NoPoolHeader;
+        static void attach(T *, Header *) {}
+    };
+
+    // Where a pool puts things - from MessagePool::getLayout()
+    struct PoolLayoutInfo
+    {
+        bool segregated;               // Headers in their own array
+        size_t object_size;            // sizeof(T)
+        size_t object_alignment;       // alignof(T)
+        size_t slot_stride;            // Bytes from one payload to the next
+        size_t slot_padding;           // slot_stride - object_size
+        size_t header_size;            // 0 without a header array
+        size_t headers_per_cache_line; // 0 without a header array
+        size_t header_offset;          // Header array offset within a slab
+        size_t payload_offset;         // First payload offset within a slab
+        size_t slots_per_slab;
+        size_t slab_bytes; // Before page rounding
+    };
+
     template <typename T>
     class MessagePool
     {
     public:
+        using HeaderTraits = PoolHeaderTraits<T>;
+        using Header = typename HeaderTraits::Header;
+        static constexpr bool SEGREGATED = HeaderTraits::segregated;
+
         // Configuration constants
         static constexpr size_t DEFAULT_POOL_SIZE = 8192; // 8K pre-allocated messages
         static constexpr size_t CACHE_LINE_SIZE = 64;     // CPU cache line size
 
-        // Minimal pool statistics for monitoring
+        // Thread magazines: each thread keeps up to MAGAZINE_CAPACITY free slots
+        // and trades MAGAZINE_BATCH at a time with the shared free list. Smaller
+        // pools skip them - cached slots would be a large share of capacity.
+        static constexpr uint32_t MAGAZINE_CAPACITY = detail::PoolMagazine::CAPACITY;
+        static constexpr uint32_t MAGAZINE_BATCH = MAGAZINE_CAPACITY / 2;
+        static constexpr size_t MAGAZINE_MIN_POOL_SIZE = 1024;
+        static constexpr size_t MAX_MAGAZINES = 64; // Further threads use the shared list directly
+        static constexpr size_t MAX_SLABS = 64;
+
+        // Minimal pool statistics for monitoring (summed over thread magazines)
         struct PoolStats
         {
             size_t total_capacity;
@@ -28,12 +232,30 @@ namespace fix_gateway::common
             uint64_t total_allocations;
             uint64_t total_deallocations;
             uint64_t allocation_failures;
+            size_t thread_caches; // Magazines registered with the pool
+            size_t cached_count;  // Free slots held in magazines (counted as available)
+            size_t slab_count;
+            size_t huge_page_slabs;      // Slabs backed by hugepages or THP
+            uint64_t emergency_growths;  // Slabs added by an allocation that found the pool empty
         };
 
-        // Constructor
+        // One thread's magazine
+        struct ThreadCacheStats
+        {
+            size_t cached_count;
+            uint64_t allocations;
+            uint64_t deallocations;
+            uint64_t allocation_failures;
+            bool orphaned; // Owner thread exited
+        };
+
+        // Fixed-size pool of pool_size slots
         explicit MessagePool(size_t pool_size = DEFAULT_POOL_SIZE,
                              const std::string &pool_name = "message_pool");
 
+        // Slab pool: starts with one slab of config.initial_size slots
+        MessagePool(const PoolConfig &config, const std::string &pool_name);
+
         // Destructor
         ~MessagePool();
 
@@ -53,26 +275,58 @@ namespace fix_gateway::common
         // Manual deallocation (required for raw pointer interface)
         void deallocate(T *msg);
 
+        // True if msg lives in this pool's slots (lets owners of several pools
+        // return a message to the right one)
+        bool owns(const T *msg) const { return slotIndexOf(msg) >= 0; }
+
         // Pool management
-        void prewarm();  // Pre-touch memory pages
+        void prewarm();  // Touch every page from the calling (owning) thread
         void reset();    // Reset pool to initial state
         void shutdown(); // Shutdown pool operations
 
-        // Status and monitoring
-        size_t capacity() const { return pool_size_; }
+        // Growth (slab pools). maintain() is the off-hot-path hook - call it from
+        // an idle or housekeeping point on the owning thread; it adds a slab once
+        // utilization reaches the watermark. grow() adds one unconditionally.
+        bool maintain();
+        bool grow();
+        bool isGrowable() const { return max_slabs_ > 1; }
+
+        // Status and monitoring. Exact while no thread is allocating; during a
+        // magazine refill or flush the counts may be off by up to one batch.
+        size_t capacity() const { return capacity_.load(std::memory_order_acquire); }
         size_t available() const;
         size_t allocated() const;
         bool isEmpty() const { return available() == 0; }
-        bool isFull() const { return allocated() == pool_size_; }
+        bool isFull() const { return allocated() == capacity(); }
         PoolStats getStats() const;
+        std::vector<ThreadCacheStats> getThreadCacheStats() const;
+        bool threadCachesEnabled() const { return magazines_enabled_; }
+
+        // Segregated layout (nullptr / no-op unless PoolHeaderTraits<T> is specialized)
+        Header *headerOf(const T *msg);
+        const Header *headerOf(const T *msg) const;
+
+        // Visit the header of every slot, free ones included (the header type
+        // tells them apart), slab by slab in index order. Safe on any thread
+        // only for a Header made of atomic fields (see SEGREGATED LAYOUT).
+        template <typename Visitor>
+        void forEachHeader(Visitor &&visit) const;
+
+        PoolLayoutInfo getLayout() const;
 
         // Utility
         std::string toString() const;
         const std::string &getName() const { return pool_name_; }
 
     private:
+        // Segregated types pack payloads; others start each slot on a cache line
+        static constexpr size_t SLOT_ALIGNMENT = SEGREGATED ? alignof(T) : std::max(CACHE_LINE_SIZE, alignof(T));
+        static constexpr size_t HEADER_STRIDE = SEGREGATED ? sizeof(Header) : 0;
+        static_assert(!SEGREGATED || std::is_trivially_destructible<Header>::value,
+                      "Pool headers are unmapped with their slab, never destroyed");
+
         // Templated pool slot - generic message storage using aligned storage
-        struct alignas(CACHE_LINE_SIZE) PoolSlot
+        struct alignas(SLOT_ALIGNMENT) PoolSlot
         {
             // Use aligned storage to avoid construction until needed
             alignas(T) char message_storage[sizeof(T)];
@@ -83,11 +337,22 @@ namespace fix_gateway::common
         };
 
         // Pool configuration
-        size_t pool_size_;
+        PoolConfig config_;
+        size_t slab_slots_; // Slots per slab
+        size_t max_slabs_;
+        std::atomic<size_t> capacity_{0};
         std::string pool_name_;
 
-        // Pool storage (cache-aligned array)
-        std::unique_ptr<PoolSlot[]> pool_slots_;
+        // Pool storage: slab k holds slots [k * slab_slots_, (k + 1) * slab_slots_).
+        // slab_table_ is append-only, so lookups read it without the growth lock.
+        std::mutex growth_mutex_;
+        std::vector<SlabMemory> slab_memory_; // Guarded by growth_mutex_
+        std::atomic<PoolSlot *> slab_table_[MAX_SLABS] = {};
+        std::atomic<Header *> header_table_[MAX_SLABS] = {}; // Segregated layout only
+        std::atomic<size_t> slab_count_{0};
+        std::atomic<int> home_node_{-1}; // NUMA node of the thread that ran prewarm()
+        std::atomic<size_t> huge_page_slabs_{0};
+        std::atomic<uint64_t> emergency_growths_{0};
 
         // Simple free list using slot indices (atomic stack)
         struct FreeListNode
@@ -95,15 +360,39 @@ namespace fix_gateway::common
             std::atomic<int32_t> next_free_index{-1};
         };
 
-        alignas(CACHE_LINE_SIZE) std::atomic<int32_t> free_list_head_{0};
+        // Head word: generation tag (high 32 bits) | slot index (low 32 bits, -1
+        // when empty). Every successful push or pop bumps the tag, so a CAS
+        // whose head slot was popped and pushed back in between (ABA) fails
+        // instead of installing a stale next index.
+        static uint64_t packHead(int32_t index, uint32_t tag)
+        {
+            return (static_cast<uint64_t>(tag) << 32) | static_cast<uint32_t>(index);
+        }
+        static int32_t headIndex(uint64_t head) { return static_cast<int32_t>(static_cast<uint32_t>(head)); }
+        static uint32_t headTag(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> free_list_head_{0};
         std::unique_ptr<FreeListNode[]> free_list_nodes_;
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "Tagged free-list head needs a lock-free 64-bit CAS");
 
-        // Essential statistics (cache-aligned for performance)
+        // Slots off the shared free list (allocated or cached in a magazine);
+        // changes once per magazine batch, not per message
         alignas(CACHE_LINE_SIZE) std::atomic<size_t> allocated_count_{0};
+
+        // Shared-list path statistics (threads without a magazine)
         alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> total_allocations_{0};
         alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> total_deallocations_{0};
         alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> allocation_failures_{0};
 
+        // Thread magazines. magazine_table_[0, magazine_count_) is append-only
+        // so monitoring reads it without the lock.
+        uint64_t pool_id_;
+        bool magazines_enabled_;
+        mutable std::mutex magazine_mutex_;
+        std::vector<std::shared_ptr<detail::PoolMagazine>> magazine_owners_;
+        detail::PoolMagazine *magazine_table_[MAX_MAGAZINES] = {};
+        std::atomic<size_t> magazine_count_{0};
+
         // State
         std::atomic<bool> is_shutdown_{false};
 
@@ -115,6 +404,80 @@ namespace fix_gateway::common
 
         void deallocateRaw(T *msg);
         void initializeFreeList();
+
+        // Slot-index level allocation (-1 when exhausted)
+        int32_t acquireSlot();
+        void releaseSlot(int32_t slot_index);
+
+        PoolSlot &slotAt(int32_t slot_index) const
+        {
+            size_t slab = static_cast<size_t>(slot_index) / slab_slots_;
+            return slab_table_[slab].load(std::memory_order_relaxed)[static_cast<size_t>(slot_index) - slab * slab_slots_];
+        }
+
+        Header *headerAt(int32_t slot_index) const
+        {
+            size_t slab = static_cast<size_t>(slot_index) / slab_slots_;
+            return header_table_[slab].load(std::memory_order_relaxed) + (static_cast<size_t>(slot_index) - slab * slab_slots_);
+        }
+
+        // Construct-time hook of the segregated layout
+        T *attachHeader(T *obj, int32_t slot_index)
+        {
+            if constexpr (SEGREGATED)
+            {
+                HeaderTraits::attach(obj, headerAt(slot_index));
+            }
+            return obj;
+        }
+
+        // Slab layout: [header array][payload slots], payloads on a cache line
+        size_t payloadOffset() const
+        {
+            size_t header_bytes = HEADER_STRIDE * slab_slots_;
+            return (header_bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+        }
+        size_t slabBytes() const { return payloadOffset() + slab_slots_ * sizeof(PoolSlot); }
+
+        // Map the next slab (growth_mutex_ held or in the constructor) and
+        // publish it in the tables; false if no memory could be mapped
+        bool mapSlab(size_t slab, const SlabOptions &options);
+
+        // Slot index of msg, -1 if it is not a slot of this pool
+        int32_t slotIndexOf(const T *msg) const;
+
+        // Map a slab and put its slots on the shared list. With only_if_empty,
+        // nothing is added if another thread refilled the list meanwhile.
+        bool addSlab(bool only_if_empty);
+
+        // Pop from the shared list, draining thread magazines and growing
+        // (emergency) before giving up
+        uint32_t takeShared(int32_t *out, uint32_t max);
+
+        // Calling thread's magazine (nullptr: use the shared list directly)
+        detail::PoolMagazine *localMagazine()
+        {
+            if (!magazines_enabled_)
+            {
+                return nullptr;
+            }
+            bool found;
+            detail::PoolMagazine *magazine = detail::ThreadMagazines::local().find(pool_id_, found);
+            return found ? magazine : registerMagazine();
+        }
+        detail::PoolMagazine *registerMagazine();
+
+        // Shared free list: pop up to max slots into out / push a batch of slots
+        uint32_t popShared(int32_t *out, uint32_t max);
+        void pushShared(const int32_t *slots, uint32_t count);
+        void pushChain(int32_t first, int32_t last); // Already linked first..last
+
+        // Steal every slot cached in magazines (live or orphaned threads)
+        // back to the shared list; the exhaustion path calls it before failing
+        bool drainMagazines();
+
+        // Free slots currently held in magazines
+        size_t cachedCount() const;
     };
 
     // Global templated message pool instance (singleton pattern) - same as your original design
@@ -138,18 +501,56 @@ namespace fix_gateway::common
     };
 
     // Template implementation (must be in header for templates)
+    namespace detail
+    {
+        inline PoolConfig fixedPoolConfig(size_t pool_size)
+        {
+            PoolConfig config;
+            config.initial_size = pool_size;
+            config.max_size = pool_size;
+            config.emergency_growth = false;
+            return config;
+        }
+    }
+
     template <typename T>
     MessagePool<T>::MessagePool(size_t pool_size, const std::string &pool_name)
-        : pool_size_(pool_size), pool_name_(pool_name)
+        : MessagePool(detail::fixedPoolConfig(pool_size), pool_name)
+    {
+    }
+
+    template <typename T>
+    MessagePool<T>::MessagePool(const PoolConfig &config, const std::string &pool_name)
+        : config_(config), slab_slots_(config.initial_size), pool_name_(pool_name),
+          pool_id_(detail::next_pool_id.fetch_add(1, std::memory_order_relaxed)),
+          magazines_enabled_(config.initial_size >= MAGAZINE_MIN_POOL_SIZE)
     {
-        if (pool_size_ == 0)
+        if (slab_slots_ == 0)
         {
             throw std::invalid_argument("Pool size cannot be zero");
         }
 
-        // Allocate pool slots and free list nodes
-        pool_slots_ = std::make_unique<PoolSlot[]>(pool_size_);
-        free_list_nodes_ = std::make_unique<FreeListNode[]>(pool_size_);
+        size_t max_size = std::max(config.max_size, slab_slots_);
+        max_slabs_ = std::min(MAX_SLABS, (max_size + slab_slots_ - 1) / slab_slots_);
+        if (max_slabs_ * slab_slots_ > static_cast<size_t>(INT32_MAX))
+        {
+            throw std::invalid_argument("Pool size exceeds slot index range");
+        }
+
+        // Free-list nodes for every slot the pool may ever have (4 bytes each)
+        free_list_nodes_ = std::make_unique<FreeListNode[]>(max_slabs_ * slab_slots_);
+
+        // First slab; its pages are placed by whichever thread touches them
+        // first - prewarm() from the owning thread
+        SlabOptions options;
+        options.huge_pages = config_.huge_pages;
+        options.prefault = false;
+        if (!mapSlab(0, options))
+        {
+            throw std::bad_alloc();
+        }
+        slab_count_.store(1, std::memory_order_release);
+        capacity_.store(slab_slots_, std::memory_order_release);
 
         // Initialize free list
         initializeFreeList();
@@ -160,6 +561,13 @@ namespace fix_gateway::common
     {
         shutdown();
 
+        // Threads still holding our magazines drop them on their next registration
+        std::lock_guard<std::mutex> lock(magazine_mutex_);
+        for (auto &magazine : magazine_owners_)
+        {
+            magazine->retired.store(true, std::memory_order_release);
+        }
+
         // Note: We use aligned storage, so no automatic destructors are called
         // Objects must be properly deallocated before pool destruction
     }
@@ -167,17 +575,28 @@ namespace fix_gateway::common
     template <typename T>
     void MessagePool<T>::initializeFreeList()
     {
-        // Build the free list by linking indices - same algorithm as original
-        for (size_t i = 0; i < pool_size_ - 1; ++i)
+        // Build the free list by linking indices over every slab
+        size_t slots = capacity();
+        for (size_t i = 0; i < slots - 1; ++i)
         {
             free_list_nodes_[i].next_free_index.store(static_cast<int32_t>(i + 1), std::memory_order_relaxed);
         }
         // Last node points to -1 (end of list)
-        free_list_nodes_[pool_size_ - 1].next_free_index.store(-1, std::memory_order_relaxed);
+        free_list_nodes_[slots - 1].next_free_index.store(-1, std::memory_order_relaxed);
 
-        // Head starts at index 0
-        free_list_head_.store(0, std::memory_order_release);
+        // Head starts at index 0 (the tag carries on across resets)
+        uint32_t tag = headTag(free_list_head_.load(std::memory_order_relaxed));
+        free_list_head_.store(packHead(0, tag + 1), std::memory_order_release);
         allocated_count_.store(0, std::memory_order_relaxed);
+
+        // Every slot is back on the shared list - magazines start empty
+        size_t magazines = magazine_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < magazines; ++i)
+        {
+            std::atomic<uint64_t> &state = magazine_table_[i]->state;
+            state.store(detail::PoolMagazine::nextState(state.load(std::memory_order_relaxed), 0),
+                        std::memory_order_release);
+        }
     }
 
     template <typename T>
@@ -219,25 +638,128 @@ namespace fix_gateway::common
     template <typename T>
     void MessagePool<T>::prewarm()
     {
-        // Pre-touch all memory pages to avoid page faults during allocation - same as original
-        for (size_t i = 0; i < pool_size_; ++i)
+        // Fault in every page (not just each slot's first byte) from this thread,
+        // so first touch puts the slabs on its NUMA node; later slabs follow it
+        std::lock_guard<std::mutex> lock(growth_mutex_);
+        if (config_.numa_local)
+        {
+            home_node_.store(SlabMemory::currentNumaNode(), std::memory_order_relaxed);
+        }
+        for (const SlabMemory &slab : slab_memory_)
+        {
+            slab.prefault();
+        }
+    }
+
+    template <typename T>
+    bool MessagePool<T>::maintain()
+    {
+        if (!isGrowable())
+        {
+            return false;
+        }
+        size_t slots = capacity();
+        if (static_cast<double>(allocated()) < config_.grow_watermark * static_cast<double>(slots))
+        {
+            return false;
+        }
+        return addSlab(false);
+    }
+
+    template <typename T>
+    bool MessagePool<T>::grow()
+    {
+        return addSlab(false);
+    }
+
+    template <typename T>
+    bool MessagePool<T>::addSlab(bool only_if_empty)
+    {
+        std::lock_guard<std::mutex> lock(growth_mutex_);
+
+        // Several threads can find the pool empty at once - only the first grows it
+        if (only_if_empty && headIndex(free_list_head_.load(std::memory_order_acquire)) >= 0)
         {
-            volatile char *touch_ptr = reinterpret_cast<volatile char *>(&pool_slots_[i]);
-            *touch_ptr = 0;
+            return true;
         }
+
+        size_t slab = slab_count_.load(std::memory_order_relaxed);
+        if (slab >= max_slabs_ || is_shutdown_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        SlabOptions options;
+        options.huge_pages = config_.huge_pages;
+        options.numa_node = config_.numa_local ? home_node_.load(std::memory_order_relaxed) : -1;
+        options.prefault = true; // Faults are taken here, not on the allocation path
+        if (!mapSlab(slab, options))
+        {
+            return false;
+        }
+
+        int32_t first = static_cast<int32_t>(slab * slab_slots_);
+        int32_t last = static_cast<int32_t>(first + slab_slots_ - 1);
+        for (int32_t i = first; i < last; ++i)
+        {
+            free_list_nodes_[i].next_free_index.store(i + 1, std::memory_order_relaxed);
+        }
+        slab_count_.store(slab + 1, std::memory_order_release);
+        capacity_.fetch_add(slab_slots_, std::memory_order_acq_rel);
+
+        pushChain(first, last);
+        if (only_if_empty)
+        {
+            emergency_growths_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool MessagePool<T>::mapSlab(size_t slab, const SlabOptions &options)
+    {
+        try
+        {
+            slab_memory_.emplace_back(slabBytes(), options);
+        }
+        catch (const std::bad_alloc &)
+        {
+            return false;
+        }
+        if (slab_memory_.back().backing() != SlabBacking::Pages)
+        {
+            huge_page_slabs_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Publish the slab before any of its slots can be popped
+        char *base = static_cast<char *>(slab_memory_.back().data());
+        if constexpr (SEGREGATED)
+        {
+            Header *headers = reinterpret_cast<Header *>(base);
+            for (size_t i = 0; i < slab_slots_; ++i)
+            {
+                new (headers + i) Header();
+            }
+        }
+        header_table_[slab].store(reinterpret_cast<Header *>(base), std::memory_order_release);
+        slab_table_[slab].store(reinterpret_cast<PoolSlot *>(base + payloadOffset()), std::memory_order_release);
+        return true;
     }
 
     template <typename T>
     void MessagePool<T>::reset()
     {
         std::cout << "reset" << std::endl;
-        // Caller responsibility: ensure pool is drained first
-        if (allocated_count_.load() > 0)
+        // Caller responsibility: ensure pool is drained first. Slots cached in
+        // thread magazines are free - allocated() already leaves them out.
+        if (allocated() > 0)
         {
             std::cout << "Cannot reset non-empty pool" << std::endl;
             throw std::runtime_error("Cannot reset non-empty pool");
         }
-        // Reinitialize free list - same as original
+        // Flush the magazines so the count is exact, then reinitialize the
+        // free list (which also leaves every magazine empty)
+        drainMagazines();
         initializeFreeList();
     }
 
@@ -250,28 +772,74 @@ namespace fix_gateway::common
     template <typename T>
     size_t MessagePool<T>::available() const
     {
-        return pool_size_ - allocated_count_.load(std::memory_order_acquire);
+        size_t slots = capacity();
+        size_t used = allocated();
+        return slots > used ? slots - used : 0;
     }
 
     template <typename T>
     size_t MessagePool<T>::allocated() const
     {
-        return allocated_count_.load(std::memory_order_acquire);
+        size_t off_list = allocated_count_.load(std::memory_order_acquire);
+        size_t cached = cachedCount();
+        return off_list > cached ? off_list - cached : 0;
+    }
+
+    template <typename T>
+    size_t MessagePool<T>::cachedCount() const
+    {
+        size_t cached = 0;
+        size_t magazines = magazine_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < magazines; ++i)
+        {
+            cached += magazine_table_[i]->count();
+        }
+        return cached;
     }
 
     template <typename T>
     typename MessagePool<T>::PoolStats MessagePool<T>::getStats() const
     {
         PoolStats stats;
-        stats.total_capacity = pool_size_;
+        stats.total_capacity = capacity();
         stats.allocated_count = allocated();
-        stats.available_count = available();
+        stats.available_count = stats.total_capacity > stats.allocated_count ? stats.total_capacity - stats.allocated_count : 0;
         stats.total_allocations = total_allocations_.load(std::memory_order_relaxed);
         stats.total_deallocations = total_deallocations_.load(std::memory_order_relaxed);
         stats.allocation_failures = allocation_failures_.load(std::memory_order_relaxed);
+        stats.slab_count = slab_count_.load(std::memory_order_acquire);
+        stats.huge_page_slabs = huge_page_slabs_.load(std::memory_order_relaxed);
+        stats.emergency_growths = emergency_growths_.load(std::memory_order_relaxed);
+        stats.thread_caches = magazine_count_.load(std::memory_order_acquire);
+        stats.cached_count = 0;
+        for (size_t i = 0; i < stats.thread_caches; ++i)
+        {
+            const detail::PoolMagazine &magazine = *magazine_table_[i];
+            stats.cached_count += magazine.count();
+            stats.total_allocations += magazine.allocations.load(std::memory_order_relaxed);
+            stats.total_deallocations += magazine.deallocations.load(std::memory_order_relaxed);
+            stats.allocation_failures += magazine.allocation_failures.load(std::memory_order_relaxed);
+        }
         return stats;
     }
 
+    template <typename T>
+    std::vector<typename MessagePool<T>::ThreadCacheStats> MessagePool<T>::getThreadCacheStats() const
+    {
+        std::vector<ThreadCacheStats> caches;
+        size_t magazines = magazine_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < magazines; ++i)
+        {
+            const detail::PoolMagazine &magazine = *magazine_table_[i];
+            caches.push_back({magazine.count(),
+                              magazine.allocations.load(std::memory_order_relaxed),
+                              magazine.deallocations.load(std::memory_order_relaxed),
+                              magazine.allocation_failures.load(std::memory_order_relaxed),
+                              magazine.orphaned.load(std::memory_order_acquire)});
+        }
+        return caches;
+    }
+
     template <typename T>
     std::string MessagePool<T>::toString() const
     {
@@ -285,120 +853,389 @@ namespace fix_gateway::common
             << ", total_allocs=" << stats.total_allocations
             << ", total_deallocs=" << stats.total_deallocations
             << ", failures=" << stats.allocation_failures
+            << ", thread_caches=" << stats.thread_caches
+            << ", cached=" << stats.cached_count
+            << ", slabs=" << stats.slab_count
+            << ", slot_stride=" << sizeof(PoolSlot)
             << ", utilization=" << (stats.allocated_count * 100.0 / stats.total_capacity) << "%"
             << "}";
         return oss.str();
     }
 
-    // Private methods - Core lock-free algorithms (same as original)
+    // Private methods - Core lock-free algorithms
     template <typename T>
     T *MessagePool<T>::allocateRaw()
     {
-        // Lock-free pop from free list (atomic stack using indices) - exact same algorithm
-        int32_t head_index = free_list_head_.load(std::memory_order_acquire);
+        int32_t slot_index = acquireSlot();
+        if (slot_index < 0)
+        {
+            return nullptr;
+        }
+
+        // Use placement new with default constructor
+        T *obj = slotAt(slot_index).get_message();
+        return attachHeader(new (obj) T(), slot_index);
+    }
 
-        while (head_index >= 0)
+    template <typename T>
+    template <typename... Args>
+    T *MessagePool<T>::allocateWithArgs(Args &&...args)
+    {
+        int32_t slot_index = acquireSlot();
+        if (slot_index < 0)
         {
-            int32_t next_index = free_list_nodes_[head_index].next_free_index.load(std::memory_order_relaxed);
+            return nullptr;
+        }
 
-            // Try to atomically update head to next
-            if (free_list_head_.compare_exchange_weak(head_index, next_index,
-                                                      std::memory_order_release,
-                                                      std::memory_order_acquire))
-            {
-                // Successfully popped from free list
-                allocated_count_.fetch_add(1, std::memory_order_relaxed);
-                total_allocations_.fetch_add(1, std::memory_order_relaxed);
+        // Use placement new with perfect forwarding
+        T *obj = slotAt(slot_index).get_message();
+        return attachHeader(new (obj) T(std::forward<Args>(args)...), slot_index);
+    }
 
-                // Use placement new with default constructor
-                T *obj = pool_slots_[head_index].get_message();
-                return new (obj) T();
-            }
-            // CAS failed, retry with updated head value
+    template <typename T>
+    void MessagePool<T>::deallocateRaw(T *msg)
+    {
+        int32_t slot_index = slotIndexOf(msg);
+        if (slot_index < 0)
+        {
+            return; // Message not from this pool
         }
 
-        // Pool exhausted
-        allocation_failures_.fetch_add(1, std::memory_order_relaxed);
+        releaseSlot(slot_index);
+    }
+
+    template <typename T>
+    typename MessagePool<T>::Header *MessagePool<T>::headerOf(const T *msg)
+    {
+        if constexpr (SEGREGATED)
+        {
+            int32_t slot_index = slotIndexOf(msg);
+            return slot_index < 0 ? nullptr : headerAt(slot_index);
+        }
         return nullptr;
     }
 
     template <typename T>
-    template <typename... Args>
-    T *MessagePool<T>::allocateWithArgs(Args &&...args)
+    const typename MessagePool<T>::Header *MessagePool<T>::headerOf(const T *msg) const
     {
-        // Lock-free pop from free list (atomic stack using indices) - same algorithm
-        int32_t head_index = free_list_head_.load(std::memory_order_acquire);
+        return const_cast<MessagePool<T> *>(this)->headerOf(msg);
+    }
 
-        while (head_index >= 0)
+    template <typename T>
+    template <typename Visitor>
+    void MessagePool<T>::forEachHeader(Visitor &&visit) const
+    {
+        if constexpr (SEGREGATED)
         {
-            int32_t next_index = free_list_nodes_[head_index].next_free_index.load(std::memory_order_relaxed);
-
-            // Try to atomically update head to next
-            if (free_list_head_.compare_exchange_weak(head_index, next_index,
-                                                      std::memory_order_release,
-                                                      std::memory_order_acquire))
+            size_t slabs = slab_count_.load(std::memory_order_acquire);
+            for (size_t slab = 0; slab < slabs; ++slab)
             {
-                // Successfully popped from free list
-                allocated_count_.fetch_add(1, std::memory_order_relaxed);
-                total_allocations_.fetch_add(1, std::memory_order_relaxed);
-
-                // Use placement new with perfect forwarding
-                T *obj = pool_slots_[head_index].get_message();
-                return new (obj) T(std::forward<Args>(args)...);
+                const Header *headers = header_table_[slab].load(std::memory_order_acquire);
+                for (size_t i = 0; i < slab_slots_; ++i)
+                {
+                    visit(headers[i]);
+                }
             }
-            // CAS failed, retry with updated head value
         }
+    }
 
-        // Pool exhausted
-        allocation_failures_.fetch_add(1, std::memory_order_relaxed);
-        return nullptr;
+    template <typename T>
+    PoolLayoutInfo MessagePool<T>::getLayout() const
+    {
+        PoolLayoutInfo layout;
+        layout.segregated = SEGREGATED;
+        layout.object_size = sizeof(T);
+        layout.object_alignment = alignof(T);
+        layout.slot_stride = sizeof(PoolSlot);
+        layout.slot_padding = sizeof(PoolSlot) - sizeof(T);
+        layout.header_size = HEADER_STRIDE;
+        layout.headers_per_cache_line = 0;
+        if constexpr (SEGREGATED)
+        {
+            layout.headers_per_cache_line = CACHE_LINE_SIZE / HEADER_STRIDE;
+        }
+        layout.header_offset = 0;
+        layout.payload_offset = payloadOffset();
+        layout.slots_per_slab = slab_slots_;
+        layout.slab_bytes = slabBytes();
+        return layout;
     }
 
     template <typename T>
-    void MessagePool<T>::deallocateRaw(T *msg)
+    int32_t MessagePool<T>::slotIndexOf(const T *msg) const
     {
         if (!msg)
         {
-            return;
+            return -1;
         }
 
-        // Convert message pointer back to slot index - same algorithm as original
+        // Convert message pointer back to slot index, one slab range at a time
         uintptr_t msg_addr = reinterpret_cast<uintptr_t>(msg);
-        uintptr_t pool_start = reinterpret_cast<uintptr_t>(pool_slots_.get());
-        uintptr_t pool_end = pool_start + (pool_size_ * sizeof(PoolSlot));
+        size_t slabs = slab_count_.load(std::memory_order_acquire);
+        for (size_t slab = 0; slab < slabs; ++slab)
+        {
+            const PoolSlot *slots = slab_table_[slab].load(std::memory_order_relaxed);
+            uintptr_t slab_start = reinterpret_cast<uintptr_t>(slots);
+            uintptr_t slab_end = slab_start + slab_slots_ * sizeof(PoolSlot);
+            if (msg_addr < slab_start || msg_addr >= slab_end)
+            {
+                continue;
+            }
 
-        if (msg_addr < pool_start || msg_addr >= pool_end)
+            // Verify this is the start of a slot
+            size_t offset = (msg_addr - slab_start) / sizeof(PoolSlot);
+            if (msg != slots[offset].get_message())
+            {
+                return -1;
+            }
+            return static_cast<int32_t>(slab * slab_slots_ + offset);
+        }
+        return -1;
+    }
+
+    template <typename T>
+    int32_t MessagePool<T>::acquireSlot()
+    {
+        detail::PoolMagazine *magazine = localMagazine();
+        if (!magazine)
         {
-            return; // Message not from this pool
+            int32_t slot_index;
+            if (takeShared(&slot_index, 1) == 0)
+            {
+                allocation_failures_.fetch_add(1, std::memory_order_relaxed);
+                return -1;
+            }
+            total_allocations_.fetch_add(1, std::memory_order_relaxed);
+            return slot_index;
         }
 
-        // Calculate slot index
-        size_t slot_index = (msg_addr - pool_start) / sizeof(PoolSlot);
-        if (slot_index >= pool_size_)
+        using detail::PoolMagazine;
+        uint64_t state = magazine->state.load(std::memory_order_acquire);
+        for (;;)
         {
-            return;
+            uint32_t count = PoolMagazine::countOf(state);
+            if (count == 0)
+            {
+                // Refill half a magazine in one shared-list transaction. Nobody
+                // steals from an empty magazine, so a plain store publishes it.
+                int32_t batch[MAGAZINE_BATCH];
+                count = takeShared(batch, MAGAZINE_BATCH);
+                if (count == 0)
+                {
+                    PoolMagazine::bump(magazine->allocation_failures);
+                    return -1;
+                }
+                for (uint32_t i = 0; i + 1 < count; ++i)
+                {
+                    magazine->slots[i].store(batch[i], std::memory_order_relaxed);
+                }
+                magazine->state.store(PoolMagazine::nextState(state, count - 1), std::memory_order_release);
+                PoolMagazine::bump(magazine->allocations);
+                return batch[count - 1];
+            }
+
+            int32_t slot_index = magazine->slots[count - 1].load(std::memory_order_relaxed);
+            if (magazine->state.compare_exchange_weak(state, PoolMagazine::nextState(state, count - 1),
+                                                      std::memory_order_acquire, std::memory_order_acquire))
+            {
+                PoolMagazine::bump(magazine->allocations);
+                return slot_index;
+            }
+            // Stolen meanwhile - state now holds the current count
         }
+    }
 
-        // Verify this is the correct message
-        if (msg != pool_slots_[slot_index].get_message())
+    template <typename T>
+    void MessagePool<T>::releaseSlot(int32_t slot_index)
+    {
+        detail::PoolMagazine *magazine = localMagazine();
+        if (!magazine)
         {
+            pushShared(&slot_index, 1);
+            total_deallocations_.fetch_add(1, std::memory_order_relaxed);
             return;
         }
 
-        // Lock-free push to free list (atomic stack using indices) - same algorithm
-        int32_t current_head = free_list_head_.load(std::memory_order_relaxed);
-        int32_t slot_idx = static_cast<int32_t>(slot_index);
+        // Freed on any thread - the slot joins this thread's magazine (a manager
+        // thread freeing what the receive thread allocated never touches the
+        // receive thread's cache line)
+        using detail::PoolMagazine;
+        uint64_t state = magazine->state.load(std::memory_order_acquire);
+        for (;;)
+        {
+            uint32_t count = PoolMagazine::countOf(state);
+            if (count == MAGAZINE_CAPACITY)
+            {
+                // Take the full magazine private (count 0), flush the older
+                // half and keep the recently freed (cache-warm) half
+                if (!magazine->state.compare_exchange_weak(state, PoolMagazine::nextState(state, 0),
+                                                           std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    continue;
+                }
+                int32_t older[MAGAZINE_BATCH];
+                for (uint32_t i = 0; i < MAGAZINE_BATCH; ++i)
+                {
+                    older[i] = magazine->slots[i].load(std::memory_order_relaxed);
+                    magazine->slots[i].store(magazine->slots[i + MAGAZINE_BATCH].load(std::memory_order_relaxed),
+                                             std::memory_order_relaxed);
+                }
+                pushShared(older, MAGAZINE_BATCH);
+                magazine->slots[MAGAZINE_BATCH].store(slot_index, std::memory_order_relaxed);
+                magazine->state.store(PoolMagazine::nextState(PoolMagazine::nextState(state, 0), MAGAZINE_BATCH + 1),
+                                      std::memory_order_release);
+                break;
+            }
+
+            magazine->slots[count].store(slot_index, std::memory_order_relaxed);
+            if (magazine->state.compare_exchange_weak(state, PoolMagazine::nextState(state, count + 1),
+                                                      std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+        PoolMagazine::bump(magazine->deallocations);
+    }
+
+    template <typename T>
+    uint32_t MessagePool<T>::popShared(int32_t *out, uint32_t max)
+    {
+        // Lock-free pop of up to max nodes (tagged atomic stack using indices)
+        uint64_t head = free_list_head_.load(std::memory_order_acquire);
+
+        while (headIndex(head) >= 0)
+        {
+            // Walk the chain to be detached, copying the indices as we go. The
+            // links may change under us if another thread wins first; the tag
+            // makes the CAS below fail in that case, so a torn walk is discarded.
+            uint32_t taken = 0;
+            int32_t next_index = headIndex(head);
+            while (taken < max && next_index >= 0)
+            {
+                out[taken++] = next_index;
+                next_index = free_list_nodes_[next_index].next_free_index.load(std::memory_order_relaxed);
+            }
 
+            // Try to atomically update head past the chain
+            if (free_list_head_.compare_exchange_weak(head, packHead(next_index, headTag(head) + 1),
+                                                      std::memory_order_acq_rel,
+                                                      std::memory_order_acquire))
+            {
+                allocated_count_.fetch_add(taken, std::memory_order_relaxed);
+                return taken;
+            }
+            // CAS failed, retry with updated head value
+        }
+
+        return 0; // Shared list exhausted
+    }
+
+    template <typename T>
+    uint32_t MessagePool<T>::takeShared(int32_t *out, uint32_t max)
+    {
+        uint32_t taken = popShared(out, max);
+        if (taken == 0 && drainMagazines())
+        {
+            taken = popShared(out, max);
+        }
+        // A spike drained the pool - grow rather than fail the allocation
+        if (taken == 0 && config_.emergency_growth && isGrowable() && addSlab(true))
+        {
+            taken = popShared(out, max);
+        }
+        return taken;
+    }
+
+    template <typename T>
+    void MessagePool<T>::pushShared(const int32_t *slots, uint32_t count)
+    {
+        // Link the batch privately, then publish it with a single CAS
+        for (uint32_t i = 0; i + 1 < count; ++i)
+        {
+            free_list_nodes_[slots[i]].next_free_index.store(slots[i + 1], std::memory_order_relaxed);
+        }
+
+        pushChain(slots[0], slots[count - 1]);
+        allocated_count_.fetch_sub(count, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    void MessagePool<T>::pushChain(int32_t first, int32_t last)
+    {
+        uint64_t current_head = free_list_head_.load(std::memory_order_relaxed);
         do
         {
-            free_list_nodes_[slot_index].next_free_index.store(current_head, std::memory_order_relaxed);
-        } while (!free_list_head_.compare_exchange_weak(current_head, slot_idx,
-                                                        std::memory_order_release,
+            free_list_nodes_[last].next_free_index.store(headIndex(current_head), std::memory_order_relaxed);
+        } while (!free_list_head_.compare_exchange_weak(current_head, packHead(first, headTag(current_head) + 1),
+                                                        std::memory_order_acq_rel,
                                                         std::memory_order_relaxed));
+    }
 
-        // Update statistics
-        allocated_count_.fetch_sub(1, std::memory_order_relaxed);
-        total_deallocations_.fetch_add(1, std::memory_order_relaxed);
+    template <typename T>
+    detail::PoolMagazine *MessagePool<T>::registerMagazine()
+    {
+        std::lock_guard<std::mutex> lock(magazine_mutex_);
+        std::shared_ptr<detail::PoolMagazine> magazine;
+
+        // Take over an exited thread's magazine (and the slots it still holds)
+        for (auto &candidate : magazine_owners_)
+        {
+            if (candidate.use_count() == 1 && candidate->orphaned.load(std::memory_order_acquire))
+            {
+                candidate->orphaned.store(false, std::memory_order_relaxed);
+                magazine = candidate;
+                break;
+            }
+        }
+
+        if (!magazine && magazine_owners_.size() < MAX_MAGAZINES)
+        {
+            magazine = std::make_shared<detail::PoolMagazine>();
+            magazine_owners_.push_back(magazine);
+            magazine_table_[magazine_owners_.size() - 1] = magazine.get();
+            magazine_count_.store(magazine_owners_.size(), std::memory_order_release);
+        }
+
+        // Registered even without a magazine so the lookup is not repeated
+        detail::PoolMagazine *local = magazine.get();
+        detail::ThreadMagazines::local().add(pool_id_, std::move(magazine));
+        return local;
+    }
+
+    template <typename T>
+    bool MessagePool<T>::drainMagazines()
+    {
+        if (!magazines_enabled_)
+        {
+            return false;
+        }
+
+        // Idle threads can sit on a full magazine each; an allocation must not
+        // fail while they hold free slots
+        using detail::PoolMagazine;
+        std::lock_guard<std::mutex> lock(magazine_mutex_);
+        bool drained = false;
+        for (auto &magazine : magazine_owners_)
+        {
+            uint64_t state = magazine->state.load(std::memory_order_acquire);
+            while (PoolMagazine::countOf(state) > 0)
+            {
+                uint32_t count = PoolMagazine::countOf(state);
+                int32_t stolen[MAGAZINE_CAPACITY];
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    stolen[i] = magazine->slots[i].load(std::memory_order_relaxed);
+                }
+                if (magazine->state.compare_exchange_weak(state, PoolMagazine::nextState(state, 0),
+                                                          std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    pushShared(stolen, count);
+                    drained = true;
+                    break;
+                }
+            }
+        }
+        return drained;
     }
 
     // Global instance implementations - same pattern as original
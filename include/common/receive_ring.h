@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::common
+{
+    // =================================================================
+    // RECEIVE RING - Mirrored (double-mapped) byte ring for the inbound stream
+    // =================================================================
+    //
+    // The same physical pages are mapped twice, back to back, so the bytes
+    // at [base + capacity, base + 2 * capacity) alias [base, base + capacity).
+    // Readable and writable regions are therefore always contiguous: recv()
+    // writes straight into writePtr() and the parser frames messages at
+    // readPtr() even when they straddle the physical end of the ring. An
+    // incomplete tail simply stays where it is until more bytes arrive.
+    //
+    // Single producer (the receive thread) and single consumer; indices are
+    // monotonic and published with release/acquire.
+
+    class ReceiveRing
+    {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 4 * 1024 * 1024; // 4MB - several 1MB burst reads
+
+        // Capacity is rounded up to a power of two multiple of the page size.
+        // Throws std::runtime_error if the mirrored mapping cannot be created.
+        explicit ReceiveRing(size_t capacity = DEFAULT_CAPACITY);
+        ~ReceiveRing();
+
+        // Non-copyable, non-movable (the mapping is tied to this object)
+        ReceiveRing(const ReceiveRing &) = delete;
+        ReceiveRing &operator=(const ReceiveRing &) = delete;
+
+        size_t capacity() const { return capacity_; }
+
+        // Producer side: free space starting at writePtr(), then publish n bytes
+        char *writePtr() { return base_ + (tail_.load(std::memory_order_relaxed) & mask_); }
+        size_t writable() const
+        {
+            return capacity_ - (tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_acquire));
+        }
+        void commit(size_t n) { tail_.store(tail_.load(std::memory_order_relaxed) + n, std::memory_order_release); }
+
+        // Consumer side: unconsumed bytes starting at readPtr(), then release n bytes
+        const char *readPtr() const { return base_ + (head_.load(std::memory_order_relaxed) & mask_); }
+        size_t readable() const
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_relaxed);
+        }
+        void consume(size_t n) { head_.store(head_.load(std::memory_order_relaxed) + n, std::memory_order_release); }
+
+        // Drop everything (both sides must be idle, e.g. on reconnect)
+        void reset()
+        {
+            head_.store(0, std::memory_order_relaxed);
+            tail_.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        char *base_ = nullptr;
+        size_t capacity_ = 0;
+        size_t mask_ = 0;
+
+        alignas(64) std::atomic<uint64_t> head_{0}; // Consumer
+        alignas(64) std::atomic<uint64_t> tail_{0}; // Producer
+    };
+
+} // namespace fix_gateway::common
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "common/constants.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace fix_gateway::common
+{
+    class ReceiveSegmentPool;
+
+    // =================================================================
+    // RECEIVE SEGMENT - Pinned, reference-counted receive buffer
+    // =================================================================
+    //
+    // The network thread reads into a segment and the parser hands out
+    // FixMessage views whose field values point straight into it. Every
+    // view holds a reference; the segment goes back to its pool when the
+    // last view is deallocated.
+
+    class ReceiveSegment
+    {
+    public:
+        char *data() { return data_; }
+        const char *data() const { return data_; }
+        size_t capacity() const { return capacity_; }
+
+        // True if [ptr, ptr + length) lies inside this segment
+        bool contains(const char *ptr, size_t length) const
+        {
+            return ptr >= data_ && length <= capacity_ &&
+                   static_cast<size_t>(ptr - data_) <= capacity_ - length;
+        }
+
+        void retain() { ref_count_.fetch_add(1, std::memory_order_relaxed); }
+        inline void release();
+
+        uint32_t refCount() const { return ref_count_.load(std::memory_order_acquire); }
+
+    private:
+        friend class ReceiveSegmentPool;
+
+        std::atomic<uint32_t> ref_count_{0};
+        ReceiveSegmentPool *owner_ = nullptr;
+        char *data_ = nullptr;
+        size_t capacity_ = 0;
+    };
+
+    // Fixed set of equally sized segments carved from one allocation
+    class ReceiveSegmentPool
+    {
+    public:
+        static constexpr size_t DEFAULT_SEGMENT_COUNT = 64;
+
+        explicit ReceiveSegmentPool(size_t segment_count = DEFAULT_SEGMENT_COUNT,
+                                    size_t segment_size = constants::LARGE_BUFFER_SIZE)
+            : segment_count_(segment_count),
+              segment_size_(segment_size)
+        {
+            if (segment_count == 0 || segment_size == 0)
+            {
+                throw std::invalid_argument("ReceiveSegmentPool requires a non-zero segment count and size");
+            }
+
+            storage_ = std::make_unique<char[]>(segment_count * segment_size);
+            segments_ = std::make_unique<ReceiveSegment[]>(segment_count);
+            free_list_.reserve(segment_count);
+
+            for (size_t i = 0; i < segment_count; ++i)
+            {
+                segments_[i].owner_ = this;
+                segments_[i].data_ = storage_.get() + i * segment_size;
+                segments_[i].capacity_ = segment_size;
+                free_list_.push_back(&segments_[i]);
+            }
+        }
+
+        // Non-copyable, non-movable (segments point back at the pool)
+        ReceiveSegmentPool(const ReceiveSegmentPool &) = delete;
+        ReceiveSegmentPool &operator=(const ReceiveSegmentPool &) = delete;
+
+        // Returns a segment holding one reference, or nullptr when every
+        // segment is still pinned by outstanding views
+        ReceiveSegment *acquire()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (free_list_.empty())
+            {
+                acquire_failures_++;
+                return nullptr;
+            }
+
+            ReceiveSegment *segment = free_list_.back();
+            free_list_.pop_back();
+            segment->ref_count_.store(1, std::memory_order_relaxed);
+            return segment;
+        }
+
+        size_t capacity() const { return segment_count_; }
+        size_t segmentSize() const { return segment_size_; }
+
+        size_t available() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return free_list_.size();
+        }
+
+        uint64_t acquireFailures() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return acquire_failures_;
+        }
+
+    private:
+        friend class ReceiveSegment;
+
+        void recycle(ReceiveSegment *segment)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_list_.push_back(segment);
+        }
+
+        size_t segment_count_;
+        size_t segment_size_;
+        std::unique_ptr<char[]> storage_;
+        std::unique_ptr<ReceiveSegment[]> segments_;
+
+        mutable std::mutex mutex_;
+        std::vector<ReceiveSegment *> free_list_;
+        uint64_t acquire_failures_ = 0;
+    };
+
+    inline void ReceiveSegment::release()
+    {
+        // acq_rel: the last releaser must see every view's reads complete
+        if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            owner_->recycle(this);
+        }
+    }
+
+} // namespace fix_gateway::common
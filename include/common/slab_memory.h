@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::common
+{
+    // =================================================================
+    // SLAB MEMORY - Page-aligned backing store for pool slabs
+    // =================================================================
+    //
+    // One anonymous mapping per slab. With huge_pages the mapping is tried
+    // as MAP_HUGETLB first (needs reserved hugepages), then as regular pages
+    // advised for transparent hugepages. With numa_node >= 0 the range is
+    // bound (preferred) to that node before it is touched; otherwise the
+    // kernel's first-touch policy places each page on the node of the thread
+    // that prefaults it.
+
+    enum class SlabBacking : uint8_t
+    {
+        Pages,                // Regular pages
+        TransparentHugePages, // Regular mapping with MADV_HUGEPAGE
+        HugePages             // MAP_HUGETLB
+    };
+
+    struct SlabOptions
+    {
+        bool huge_pages = false;
+        int numa_node = -1;   // Preferred node, -1 for first touch
+        bool prefault = true; // Touch every page from the calling thread
+    };
+
+    class SlabMemory
+    {
+    public:
+        SlabMemory() = default;
+
+        // Throws std::bad_alloc if no mapping could be made
+        SlabMemory(size_t bytes, const SlabOptions &options);
+        ~SlabMemory();
+
+        SlabMemory(const SlabMemory &) = delete;
+        SlabMemory &operator=(const SlabMemory &) = delete;
+        SlabMemory(SlabMemory &&other) noexcept;
+        SlabMemory &operator=(SlabMemory &&other) noexcept;
+
+        void *data() const { return base_; }
+        size_t size() const { return mapped_; }
+        SlabBacking backing() const { return backing_; }
+
+        // Write one byte per page (first-touch places the page on this thread's node)
+        void prefault() const;
+
+        // NUMA node the calling thread runs on, -1 if unknown
+        static int currentNumaNode();
+
+        // True if the platform offers hugepages at all (cached)
+        static bool hugePagesAvailable();
+
+    private:
+        void release();
+
+        void *base_ = nullptr;
+        size_t mapped_ = 0;
+        SlabBacking backing_ = SlabBacking::Pages;
+    };
+
+} // namespace fix_gateway::common
@@ -4,6 +4,7 @@
 #include "utils/lockfree_queue.h"
 #include "network/tcp_connection.h"
 #include "network/async_sender.h"
+#include "network/egress_scheduler.h"
 #include "common/message.h"
 #include "priority_config.h"
 
@@ -41,8 +42,11 @@ namespace fix_gateway::manager
     public:
         enum class QueueType
         {
-            MUTEX_BASED, // Phase 2: STL priority_queue with mutex
-            LOCK_FREE    // Phase 3: Lock-free ring buffer implementation
+            PRIORITY_SCHEDULER, // utils::PriorityQueue: lock-free multi-level scheduler
+            LOCK_FREE,          // Plain lock-free ring per priority (FIFO only)
+
+            // Former name of PRIORITY_SCHEDULER (the queue is no longer mutex based)
+            MUTEX_BASED [[deprecated("use PRIORITY_SCHEDULER")]] = PRIORITY_SCHEDULER
         };
 
         struct CorePinningConfig
@@ -58,13 +62,26 @@ namespace fix_gateway::manager
             bool enable_real_time_priority = false; // Requires root on Linux/macOS
 
             // Queue configuration (Phase 3)
-            QueueType queue_type = QueueType::MUTEX_BASED; // Default to mutex-based for compatibility
+            QueueType queue_type = QueueType::PRIORITY_SCHEDULER;
 
             // Queue sizes per priority
             size_t critical_queue_size = 1024;
             size_t high_queue_size = 2048;
             size_t medium_queue_size = 4096;
             size_t low_queue_size = 8192;
+
+            // Sender wait per lane when its lock-free queue is empty
+            fix_gateway::utils::WaitConfig critical_wait = fix_gateway::utils::WaitConfig::forLane(0);
+            fix_gateway::utils::WaitConfig high_wait = fix_gateway::utils::WaitConfig::forLane(1);
+            fix_gateway::utils::WaitConfig medium_wait = fix_gateway::utils::WaitConfig::forLane(2);
+            fix_gateway::utils::WaitConfig low_wait = fix_gateway::utils::WaitConfig::forLane(3);
+
+            // One EgressScheduler thread drains all lanes with strict priority and
+            // writes batches with one gather write, instead of an AsyncSender per
+            // lane racing on the socket. Uses the lock-free lanes (forces LOCK_FREE)
+            // and pins to critical_core.
+            bool single_writer_egress = false;
+            fix_gateway::network::EgressConfig egress;
         };
 
         struct PerformanceStats
@@ -112,6 +129,9 @@ namespace fix_gateway::manager
         std::shared_ptr<AsyncSender> getMediumSender() const;   // For BusinessLogicManager
         std::shared_ptr<AsyncSender> getLowSender() const;      // For FixSessionManager
 
+        // Single-writer egress (null unless single_writer_egress; no per-lane senders then)
+        std::shared_ptr<fix_gateway::network::EgressScheduler> getEgressScheduler() const { return egress_scheduler_; }
+
         // Direct message sending (routes to appropriate priority queue)
         bool sendMessage(MessagePtr message, Priority priority);
 
@@ -138,6 +158,10 @@ namespace fix_gateway::manager
         QueueType getQueueType() const { return config_.queue_type; }
         std::string getQueueTypeString() const;
 
+        // Pin any thread to a core (affinity on Linux, affinity/QoS fallback on macOS);
+        // shared with the inbound receive workers
+        static bool pinThreadToCore(std::thread &thread, int core_id);
+
     private:
         // Core configuration
         CorePinningConfig config_;
@@ -145,10 +169,11 @@ namespace fix_gateway::manager
         // Shared TCP connection (used by all AsyncSenders)
         std::shared_ptr<TcpConnection> tcp_connection_;
 
-        // Per-priority queues and senders - supports both mutex-based and lock-free
+        // Per-priority queues and senders - priority schedulers or plain lock-free rings
         std::unordered_map<Priority, std::shared_ptr<PriorityQueue>> priority_queues_;
         std::unordered_map<Priority, std::shared_ptr<LockFreeQueue>> lockfree_queues_;
         std::unordered_map<Priority, std::shared_ptr<AsyncSender>> async_senders_;
+        std::shared_ptr<fix_gateway::network::EgressScheduler> egress_scheduler_;
 
         // Core management
         std::unordered_map<Priority, int> priority_to_core_;
@@ -163,10 +188,10 @@ namespace fix_gateway::manager
         void createQueuesAndSenders();
         void startAsyncSenders();
         void stopAsyncSenders();
+        void startEgressScheduler();
 
         // Thread management helpers (preserved core performance logic)
-        bool pinThreadToCore(std::thread &thread, int core_id);
-        bool setThreadQoSClass(std::thread &thread, int core_id);
+        static bool setThreadQoSClass(std::thread &thread, int core_id);
         bool setThreadRealTimePriority(std::thread &thread);
 
         // Queue interface abstraction
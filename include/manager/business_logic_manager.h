@@ -11,6 +11,8 @@
 namespace fix_gateway::manager
 {
     using OrderBookInterface = fix_gateway::application::OrderBookInterface;
+    using FixDecimal = fix_gateway::protocol::FixDecimal;
+    using PriceScaleTable = fix_gateway::protocol::PriceScaleTable;
 
     /**
      * @brief Handles business logic and trading-related FIX messages
@@ -31,8 +33,8 @@ namespace fix_gateway::manager
             std::string order_id;
             std::string client_order_id;
             std::string symbol;
-            double quantity;
-            double price;
+            FixDecimal quantity; // Exact wire values - no double round trip
+            FixDecimal price;
             char side;         // '1' = Buy, '2' = Sell
             char order_status; // '0' = New, '1' = Partial Fill, '2' = Filled, etc.
             std::chrono::steady_clock::time_point creation_time;
@@ -64,7 +66,8 @@ namespace fix_gateway::manager
         void setOrderBook(std::shared_ptr<OrderBookInterface> order_book);
 
         // Business rule configuration
-        void setMaxOrderSize(double max_size) { max_order_size_ = max_size; }
+        void setMaxOrderSize(const FixDecimal &max_size) { max_order_size_ = max_size; }
+        void setPriceScale(std::string_view symbol, uint8_t scale) { price_scales_.setScale(symbol, scale); }
         void setMaxOrdersPerSecond(int max_rate) { max_orders_per_second_ = max_rate; }
         void enableRiskChecks(bool enable) { risk_checks_enabled_ = enable; }
 
@@ -95,7 +98,7 @@ namespace fix_gateway::manager
         // Business logic validation
         bool validateNewOrder(const FixMessage* message, std::string& reject_reason);
         bool applyRiskChecks(const FixMessage* message, std::string& reject_reason);
-        bool checkOrderSize(double size, std::string& reject_reason);
+        bool checkOrderSize(const FixDecimal& size, std::string& reject_reason);
         bool checkOrderRate(std::string& reject_reason);
 
         // Order state management
@@ -105,8 +108,9 @@ namespace fix_gateway::manager
 
         // Utility methods
         std::string generateOrderId();
-        double extractPrice(const FixMessage* message);
-        double extractQuantity(const FixMessage* message);
+        // False when the field is absent or not a valid FIX decimal
+        bool extractPrice(const FixMessage* message, FixDecimal& price);
+        bool extractQuantity(const FixMessage* message, FixDecimal& quantity);
         char extractSide(const FixMessage* message);
         std::string extractSymbol(const FixMessage* message);
         
@@ -123,7 +127,8 @@ namespace fix_gateway::manager
         std::unordered_map<std::string, std::string> client_id_to_order_id_;
 
         // Business configuration
-        double max_order_size_ = 1000000.0; // Default 1M
+        FixDecimal max_order_size_ = FixDecimal::fromInteger(1000000); // Default 1M
+        PriceScaleTable price_scales_;                                 // Outbound price precision per symbol
         int max_orders_per_second_ = 1000;  // Default 1K orders/sec
         bool risk_checks_enabled_ = true;
 
@@ -35,7 +35,7 @@ namespace fix_gateway::network
     class AsyncSender
     {
     public:
-        // Constructor for mutex-based queue (Phase 2)
+        // Constructor for the multi-level priority scheduler
         AsyncSender(std::shared_ptr<PriorityQueue> priority_queue,
                     std::shared_ptr<TcpConnection> tcp_connection);
 
@@ -75,7 +75,7 @@ namespace fix_gateway::network
         using ErrorCallback = std::function<void(MessagePtr, const std::string &)>;
         ErrorCallback error_callback_;
 
-        // Core components - either mutex-based or lock-free
+        // Core components - either priority scheduler or lock-free ring
         std::shared_ptr<PriorityQueue> priority_queue_;
         std::shared_ptr<LockFreeQueue> lockfree_queue_;
         std::shared_ptr<TcpConnection> tcp_connection_;
@@ -91,6 +91,9 @@ namespace fix_gateway::network
         std::atomic<size_t> total_failed_{0};
         std::atomic<size_t> total_retried_{0};
 
+        // Messages taken per popBulk() in the lock-free sender loop
+        static constexpr size_t SEND_BATCH = 32;
+
         // Batch processing (Phase 3 optimization)
         bool enable_batch_processing_{false};
         size_t batch_size_{100};
@@ -102,7 +105,7 @@ namespace fix_gateway::network
 
         // Private methods
         void senderLoop();
-        void senderLoopMutex();    // For mutex-based queue
+        void senderLoopScheduler(); // For the priority scheduler
         void senderLoopLockFree(); // For lock-free queue
         void sendMessage(MessagePtr message);
         void handleSendFailure(MessagePtr message);
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "utils/lockfree_queue.h"
+#include "utils/wait_strategy.h"
+#include "network/tcp_connection.h"
+#include "common/message.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace fix_gateway::network
+{
+    using MessagePtr = fix_gateway::common::MessagePtr;
+
+    // =================================================================
+    // EGRESS SCHEDULER - One writer thread for all priority lanes
+    // =================================================================
+    //
+    // Replaces one AsyncSender per lane on a shared TcpConnection: a single
+    // thread drains CRITICAL / HIGH / MEDIUM / LOW and writes each batch with
+    // one gather write, so priority is decided here rather than by OS
+    // scheduling and contention on the socket.
+    //
+    // Each batch is filled in strict priority order. Anti-starvation: while a
+    // lane has messages, min_share[lane] slots of every batch stay reserved
+    // for it, so a busy CRITICAL lane cannot shut LOW out entirely. Reserved
+    // messages are still written behind everything more urgent in the batch.
+    //
+    // The lanes share the scheduler's WaitStrategy, so an idle scheduler parks
+    // until a push to any lane. The scheduler takes ownership of the popped
+    // messages and destroys them after the write.
+    //
+    // A failed write keeps the unsent part of the batch and retries it with
+    // AsyncSender's policy (max_retries, linearly growing delay). Messages
+    // still unsent after that go to the error callback before destruction.
+
+    struct EgressConfig
+    {
+        static constexpr size_t LANE_COUNT = 4; // One per Priority value
+
+        size_t batch_messages = 64; // Messages per gather write
+
+        // Slots per batch reserved for each lane while it has messages
+        std::array<uint32_t, LANE_COUNT> min_share = {0, 4, 2, 1};
+
+        // Retries of the unsent part of a batch, retry_delay * attempt apart
+        size_t max_retries = 3;
+        std::chrono::milliseconds retry_delay{100};
+
+        // How the idle scheduler waits for the next push
+        fix_gateway::utils::WaitConfig idle_wait = fix_gateway::utils::WaitConfig::forLane(0);
+    };
+
+    struct EgressStats
+    {
+        uint64_t messages_sent = 0;
+        uint64_t messages_failed = 0;
+        uint64_t batches_written = 0;
+        uint64_t batch_retries = 0;
+        uint64_t bytes_sent = 0;
+        std::array<uint64_t, EgressConfig::LANE_COUNT> lane_sent{};
+    };
+
+    class EgressScheduler
+    {
+    public:
+        static constexpr size_t LANE_COUNT = EgressConfig::LANE_COUNT;
+        using LaneQueue = fix_gateway::utils::LockFreeQueue<MessagePtr>;
+        using LaneArray = std::array<std::shared_ptr<LaneQueue>, LANE_COUNT>;
+        using ErrorCallback = std::function<void(MessagePtr, const std::string &)>;
+
+        // lanes indexed by Priority; a lane may be null
+        EgressScheduler(LaneArray lanes, std::shared_ptr<TcpConnection> tcp_connection,
+                        const EgressConfig &config = EgressConfig{});
+        ~EgressScheduler();
+
+        EgressScheduler(const EgressScheduler &) = delete;
+        EgressScheduler &operator=(const EgressScheduler &) = delete;
+
+        // Lifecycle management
+        void start();
+        void stop(); // Writes what is still queued, then joins
+
+        // Called on the scheduler thread for each message given up on; the
+        // message is destroyed after the call (set before start())
+        void setErrorCallback(ErrorCallback callback) { error_callback_ = std::move(callback); }
+
+        bool isRunning() const { return running_.load(); }
+        std::thread &getSchedulerThread() { return scheduler_thread_; }
+
+        // Next batch in write order (no I/O); the caller owns the messages
+        size_t selectBatch(MessagePtr *out, size_t max);
+
+        // One round on the calling thread: select, write (with retries),
+        // release. Returns the number of messages taken (sent or failed).
+        size_t drainOnce();
+
+        EgressStats getStats() const;
+        size_t getQueueDepth() const;
+
+    private:
+        static constexpr size_t MAX_BATCH = 256;
+
+        LaneArray lanes_;
+        std::shared_ptr<TcpConnection> tcp_connection_;
+        EgressConfig config_;
+        ErrorCallback error_callback_;
+
+        // Shared by all lanes: any push wakes the parked scheduler
+        fix_gateway::utils::WaitStrategy wait_;
+
+        std::thread scheduler_thread_;
+        std::atomic<bool> running_{false};
+
+        // Written by the scheduler thread only
+        fix_gateway::utils::SingleWriterCounter messages_sent_;
+        fix_gateway::utils::SingleWriterCounter messages_failed_;
+        fix_gateway::utils::SingleWriterCounter batches_written_;
+        fix_gateway::utils::SingleWriterCounter batch_retries_;
+        fix_gateway::utils::SingleWriterCounter bytes_sent_;
+        std::array<fix_gateway::utils::SingleWriterCounter, LANE_COUNT> lane_sent_;
+
+        void schedulerLoop();
+
+        // One gather write of batch[0, count); returns the messages written in full
+        size_t writeBatch(MessagePtr *batch, size_t count, bool &ok);
+        bool anyLaneReady() const;
+    };
+
+} // namespace fix_gateway::network
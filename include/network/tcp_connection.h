@@ -7,9 +7,13 @@
 #include <vector>
 #include <mutex>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include "common/constants.h"
+#include "common/receive_segment.h"
+#include "common/receive_ring.h"
+#include "utils/wait_strategy.h"
 
 namespace fix_gateway::network
 {
@@ -21,6 +25,22 @@ namespace fix_gateway::network
         using ErrorCallback = std::function<void(const std::string &)>;
         using DisconnectCallback = std::function<void()>;
 
+        // Zero-copy receive: data lives in a pinned segment the callee may retain
+        using SegmentCallback = std::function<void(common::ReceiveSegment *, size_t)>;
+
+        // Ring receive: the callee consumes whole frames; an unconsumed tail stays in the ring
+        using RingCallback = std::function<void(common::ReceiveRing &)>;
+
+        // Outcome of one non-blocking read
+        enum class ReceiveStatus
+        {
+            Data,       // Bytes were read and handed to the callbacks
+            WouldBlock, // Nothing to read right now
+            RingFull,   // Receive ring has no space left; nothing was read
+            Closed,     // Peer closed or the connection was lost
+            Error       // Socket error on a connection that is still up
+        };
+
         // Constructor/Destructor
         TcpConnection();
         ~TcpConnection();
@@ -44,12 +64,28 @@ namespace fix_gateway::network
         bool send(const std::string &message);
         bool send(const std::vector<char> &data);
         ssize_t sendRaw(const void *data, size_t length);
+
+        // Gather write of a batch, one entry per message. Completes partial
+        // writes (advancing iov in place) and waits up to SEND_TIMEOUT_MS for
+        // POLLOUT while the socket buffer is full, so a batch is never cut
+        // mid-message on success. written (optional) receives the number of
+        // entries written in full. A failure that leaves part of an entry on
+        // the wire is fatal: the stream is corrupt, so the connection is shut
+        // down and reported lost.
+        bool sendv(struct iovec *iov, size_t count, size_t *written = nullptr);
         bool handlePartialSend(const void *data, size_t length, ssize_t bytesSent);
 
         // Step 4: Async Data Receiving
         void startReceiveLoop();
         void receiveLoop();
+
+        // One non-blocking read into the ring (or private buffer) and dispatch,
+        // for callers that poll many connections from their own thread instead
+        // of starting a receive loop. Segment mode is not used here.
+        ReceiveStatus receiveOnce();
         void onDataReceived(const char *data, size_t length);
+        void onSegmentReceived(common::ReceiveSegment *segment, size_t length);
+        void onRingDataReceived(common::ReceiveRing &ring);
 
         // Step 5: Connection Management
         bool isConnected() const;
@@ -70,10 +106,27 @@ namespace fix_gateway::network
         void setDataCallback(DataCallback callback);
         void setErrorCallback(ErrorCallback callback);
         void setDisconnectCallback(DisconnectCallback callback);
+        void setSegmentCallback(SegmentCallback callback);
+        void setRingCallback(RingCallback callback);
+
+        // Receive into segments from this pool (set before startReceiveLoop).
+        // Falls back to the private buffer while every segment is pinned.
+        void setReceiveSegmentPool(common::ReceiveSegmentPool *pool);
+
+        // Receive into this mirrored ring (set before startReceiveLoop), so a
+        // frame split across reads is never copied. Not used while a segment
+        // pool is set. Reads pause while the consumer leaves the ring full.
+        void setReceiveRing(common::ReceiveRing *ring);
+
+        // How receiveLoop() waits on an idle socket (set before startReceiveLoop).
+        // Spin and yield rounds retry the read; the park step is poll(POLLIN) for
+        // at most park_timeout, which returns as soon as data arrives.
+        void setReceiveWait(const utils::WaitConfig &config);
 
         // Connection info
         std::string getRemoteHost() const;
         int getRemotePort() const;
+        int getSocketFd() const { return socket_fd_; }
 
     private:
         // Socket members
@@ -94,6 +147,9 @@ namespace fix_gateway::network
         // Buffers
         std::vector<char> receive_buffer_;
         mutable std::mutex buffer_mutex_;
+        common::ReceiveSegmentPool *segment_pool_ = nullptr; // Not owned
+        common::ReceiveRing *receive_ring_ = nullptr;        // Not owned
+        utils::WaitConfig receive_wait_ = utils::WaitConfig::spinPark(0, 0);
 
         // Error handling
         std::string last_error_;
@@ -103,8 +159,19 @@ namespace fix_gateway::network
         DataCallback data_callback_;
         ErrorCallback error_callback_;
         DisconnectCallback disconnect_callback_;
+        SegmentCallback segment_callback_;
+        RingCallback ring_callback_;
         mutable std::mutex callback_mutex_;
 
+        // One read + dispatch shared by receiveLoop() and receiveOnce()
+        ReceiveStatus receiveChunk(std::vector<char> &buffer, common::ReceiveSegment *&segment);
+
+        // One step of receive_wait_ after idle_rounds reads in a row found nothing
+        void waitReadable(uint32_t idle_rounds);
+
+        // sendv() failure: a cut entry corrupts the stream, so drop the connection
+        void abortPartialWrite(bool mid_entry);
+
         // Note: Constants moved to common/constants.h
     };
 } // namespace fix_gateway::network
\ No newline at end of file
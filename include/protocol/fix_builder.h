@@ -60,6 +60,10 @@ namespace fix_gateway::protocol
         int getNextSeqNum() const { return nextSeqNum_; }
         int getCurrentSeqNum() const { return nextSeqNum_ - 1; }
 
+        // Per-symbol price precision for FixDecimal prices (configure before building)
+        void setPriceScale(std::string_view symbol, uint8_t scale) { priceScales_.setScale(symbol, scale); }
+        const PriceScaleTable &getPriceScales() const { return priceScales_; }
+
         // Core building methods
         std::string buildMessage(const FixMessage &message);
         std::string buildMessage(FixMessagePtr message);
@@ -85,6 +89,16 @@ namespace fix_gateway::protocol
                                         const std::string &timeInForce = TimeInForce::Day,
                                         const std::string &account = "");
 
+        // Fixed-point variant - price is formatted at the symbol's configured scale
+        std::string buildNewOrderSingle(const std::string &clOrdID,
+                                        const std::string &symbol,
+                                        const std::string &side,
+                                        const FixDecimal &orderQty,
+                                        const FixDecimal &price,
+                                        const std::string &orderType = OrderType::Limit,
+                                        const std::string &timeInForce = TimeInForce::Day,
+                                        const std::string &account = "");
+
         std::string buildOrderCancelRequest(const std::string &origClOrdID,
                                             const std::string &clOrdID,
                                             const std::string &symbol,
@@ -133,6 +147,7 @@ namespace fix_gateway::protocol
             MessageBuilder &setField(int tag, int value);
             MessageBuilder &setField(int tag, double value, int precision = 2);
             MessageBuilder &setField(int tag, char value);
+            MessageBuilder &setField(int tag, const FixDecimal &value);
 
             // Common field shortcuts
             MessageBuilder &setClOrdID(const std::string &clOrdID);
@@ -140,6 +155,8 @@ namespace fix_gateway::protocol
             MessageBuilder &setSide(const std::string &side);
             MessageBuilder &setOrderQty(const std::string &qty);
             MessageBuilder &setPrice(const std::string &price);
+            MessageBuilder &setOrderQty(const FixDecimal &qty);
+            MessageBuilder &setPrice(const FixDecimal &price); // Scaled for the Symbol set so far
             MessageBuilder &setAccount(const std::string &account);
             MessageBuilder &setText(const std::string &text);
 
@@ -165,6 +182,7 @@ namespace fix_gateway::protocol
         BuilderConfig config_;
         int nextSeqNum_ = 1;
         BuilderStats stats_;
+        PriceScaleTable priceScales_;
 
         // Core building implementation
         std::string buildImpl(const FixMessage &message);
@@ -181,6 +199,7 @@ namespace fix_gateway::protocol
         std::string getCurrentTimestamp() const;
         size_t calculateBodyLength(const FixMessage &message) const;
         std::string calculateChecksum(const std::string &message) const;
+        void setScaledPrice(FixMessage &message, int tag, std::string_view symbol, const FixDecimal &price) const;
 
         // Performance helpers
         void startTiming();
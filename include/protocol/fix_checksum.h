@@ -0,0 +1,92 @@
+#pragma once
+
+#include "protocol/fix_tokenizer.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // FIX CHECKSUM KERNEL (tag 10)
+    // =================================================================
+    //
+    // CheckSum is the sum of every byte before "10=" modulo 256. The byte
+    // sum is computed with PSADBW-style horizontal adds (sum of absolute
+    // differences against zero), 16 or 32 bytes per instruction, using the
+    // same runtime kernel selection as FixTokenizer. BodyLength needs no
+    // byte scan: the declared count either lands on the trailer or not.
+
+    class FixChecksum
+    {
+    public:
+        using Kernel = FixTokenizer::Kernel;
+
+        // Length of the "10=XXX<SOH>" trailer
+        static constexpr size_t TRAILER_LENGTH = 7;
+
+        // Raw sum of all bytes (modulo 2^32 - exact for any FIX message)
+        static uint32_t byteSum(const char *buffer, size_t length);
+        static uint32_t byteSumWith(Kernel kernel, const char *buffer, size_t length);
+
+        // Checksum of [buffer, buffer + length)
+        static uint8_t compute(const char *buffer, size_t length)
+        {
+            return static_cast<uint8_t>(byteSum(buffer, length));
+        }
+
+        // Validate a complete message that ends with "10=XXX<SOH>"
+        static bool validate(const char *message, size_t length);
+
+        // BodyLength (9) of a complete message: the declared count must end the
+        // body exactly where the "10=XXX<SOH>" trailer starts (spec reading)
+        static bool validateBodyLength(const char *message, size_t length);
+
+        // Both trailer checks - BodyLength, then the byte sum
+        static bool validateFrame(const char *message, size_t length)
+        {
+            return validateBodyLength(message, length) && validate(message, length);
+        }
+
+        // Three ASCII digits <-> checksum value (no allocation)
+        static void format(uint8_t checksum, char *out)
+        {
+            out[0] = static_cast<char>('0' + checksum / 100);
+            out[1] = static_cast<char>('0' + (checksum / 10) % 10);
+            out[2] = static_cast<char>('0' + checksum % 10);
+        }
+
+        static bool parse(const char *digits, uint8_t &checksum)
+        {
+            unsigned d0 = static_cast<unsigned char>(digits[0]) - '0';
+            unsigned d1 = static_cast<unsigned char>(digits[1]) - '0';
+            unsigned d2 = static_cast<unsigned char>(digits[2]) - '0';
+            if (d0 > 9 || d1 > 9 || d2 > 9)
+                return false;
+
+            unsigned value = d0 * 100 + d1 * 10 + d2;
+            if (value > 255)
+                return false;
+
+            checksum = static_cast<uint8_t>(value);
+            return true;
+        }
+
+        // Incremental mode - fold bytes in as they stream past (partial
+        // messages, field-by-field serialization, tokenizer byte sums)
+        class Accumulator
+        {
+        public:
+            void update(const char *buffer, size_t length) { sum_ += FixChecksum::byteSum(buffer, length); }
+            void update(char c) { sum_ += static_cast<unsigned char>(c); }
+            void addByteSum(uint32_t partial_sum) { sum_ += partial_sum; }
+            void reset() { sum_ = 0; }
+
+            uint32_t sum() const { return sum_; }
+            uint8_t value() const { return static_cast<uint8_t>(sum_); }
+
+        private:
+            uint32_t sum_ = 0;
+        };
+    };
+
+} // namespace fix_gateway::protocol
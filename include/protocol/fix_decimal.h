@@ -0,0 +1,231 @@
+#pragma once
+
+#include "utils/fast_string_conversion.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // FIX DECIMAL - Fixed-point Price / Qty / Px values
+    // =================================================================
+    //
+    // value = mantissa / 10^scale. Wire values are decoded exactly (no
+    // binary floating point), so price ticks compare and round-trip
+    // without drift. The parser consumes digit runs eight bytes at a time
+    // (SWAR); the formatter is FastStringConversion::fixed_to_chars.
+
+    struct FixDecimal
+    {
+        static constexpr uint8_t MAX_SCALE = 18;
+        static constexpr size_t MAX_DIGITS = 19;      // Significant digits that fit the mantissa
+        // Longest format() output - the formatter's buffer contract
+        static constexpr size_t MAX_TEXT_LENGTH = fix_gateway::utils::FastStringConversion::FIXED_BUFFER_SIZE;
+        static_assert(MAX_TEXT_LENGTH >= 1 + MAX_DIGITS + 1 && MAX_TEXT_LENGTH >= 3 + MAX_SCALE,
+                      "Formatter buffer too small for a full-range FixDecimal");
+
+        int64_t mantissa = 0;
+        uint8_t scale = 0; // Digits after the decimal point
+
+        // Parse "[-]digits[.digits]"; false on empty/invalid input or overflow
+        static bool parse(std::string_view text, FixDecimal &out)
+        {
+            const char *p = text.data();
+            const char *end = p + text.size();
+            bool negative = false;
+            if (p != end && (*p == '-' || *p == '+'))
+            {
+                negative = (*p == '-');
+                ++p;
+            }
+
+            // Leading zeros carry no significance and do not count as digits
+            const char *digits_start = p;
+            while (p != end && *p == '0')
+                ++p;
+            bool seen_digit = p != digits_start;
+
+            uint64_t mantissa = 0;
+            const char *int_start = p;
+            p = scanDigits(p, end, mantissa);
+            size_t int_digits = static_cast<size_t>(p - int_start);
+
+            size_t frac_digits = 0;
+            if (p != end && *p == '.')
+            {
+                const char *frac_start = ++p;
+                p = scanDigits(p, end, mantissa);
+                frac_digits = static_cast<size_t>(p - frac_start);
+            }
+
+            // Digit counts are checked after the scan: a run past MAX_DIGITS
+            // may have wrapped the accumulator, but it is rejected here
+            if (p != end || (!seen_digit && int_digits + frac_digits == 0) ||
+                frac_digits > MAX_SCALE || int_digits + frac_digits > MAX_DIGITS ||
+                mantissa > static_cast<uint64_t>(INT64_MAX))
+                return false;
+
+            out.mantissa = negative ? -static_cast<int64_t>(mantissa) : static_cast<int64_t>(mantissa);
+            out.scale = static_cast<uint8_t>(frac_digits);
+            return true;
+        }
+
+        static FixDecimal fromInteger(int64_t value) { return FixDecimal{value, 0}; }
+
+        // Rounds half away from zero at the given scale; use at API edges only
+        static FixDecimal fromDouble(double value, uint8_t scale)
+        {
+            scale = scale > MAX_SCALE ? MAX_SCALE : scale;
+            return FixDecimal{std::llround(value * pow10(scale)), scale};
+        }
+
+        double toDouble() const { return static_cast<double>(mantissa) / pow10(scale); }
+
+        // Change the scale in place: exact when widening (false on overflow),
+        // rounds half away from zero when narrowing
+        bool rescale(uint8_t new_scale)
+        {
+            if (new_scale > MAX_SCALE)
+                return false;
+
+            if (new_scale >= scale)
+            {
+                __int128 widened = static_cast<__int128>(mantissa) * ipow10(new_scale - scale);
+                if (widened > INT64_MAX || widened < INT64_MIN)
+                    return false;
+                mantissa = static_cast<int64_t>(widened);
+            }
+            else
+            {
+                int64_t divisor = ipow10(scale - new_scale);
+                int64_t quotient = mantissa / divisor;
+                int64_t remainder = mantissa % divisor;
+                if (remainder * 2 >= divisor)
+                    ++quotient;
+                else if (remainder * 2 <= -divisor)
+                    --quotient;
+                mantissa = quotient;
+            }
+            scale = new_scale;
+            return true;
+        }
+
+        // Writes at most MAX_TEXT_LENGTH characters (not null-terminated)
+        size_t format(char *out) const
+        {
+            return fix_gateway::utils::FastStringConversion::fixed_to_chars(mantissa, scale, out);
+        }
+
+        std::string toString() const
+        {
+            char buffer[MAX_TEXT_LENGTH];
+            return std::string(buffer, format(buffer));
+        }
+
+        // Numeric ordering across scales (1.50 == 1.5)
+        static int compare(const FixDecimal &a, const FixDecimal &b)
+        {
+            __int128 lhs = a.mantissa;
+            __int128 rhs = b.mantissa;
+            if (a.scale < b.scale)
+                lhs *= ipow10(b.scale - a.scale);
+            else if (b.scale < a.scale)
+                rhs *= ipow10(a.scale - b.scale);
+            return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+        }
+
+        friend bool operator==(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) == 0; }
+        friend bool operator!=(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) != 0; }
+        friend bool operator<(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) < 0; }
+        friend bool operator>(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) > 0; }
+        friend bool operator<=(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) <= 0; }
+        friend bool operator>=(const FixDecimal &a, const FixDecimal &b) { return compare(a, b) >= 0; }
+
+    private:
+        static int64_t ipow10(unsigned exponent)
+        {
+            static constexpr int64_t POWERS[] = {
+                1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL,
+                1000000000LL, 10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL,
+                100000000000000LL, 1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+                1000000000000000000LL};
+            return POWERS[exponent];
+        }
+
+        static double pow10(unsigned exponent) { return static_cast<double>(ipow10(exponent)); }
+
+        // True if all eight bytes are ASCII digits
+        static bool allDigits8(uint64_t chunk)
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                    (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+        }
+
+        // Value of eight ASCII digits loaded little-endian (first char in the low byte)
+        static uint32_t parseDigits8(uint64_t chunk)
+        {
+            chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;     // 2-digit lanes
+            chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16; // 4-digit lanes
+            return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+        }
+
+        // Accumulate a run of digits into value, returning the first non-digit
+        static const char *scanDigits(const char *p, const char *end, uint64_t &value)
+        {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            while (end - p >= 8)
+            {
+                uint64_t chunk;
+                std::memcpy(&chunk, p, sizeof(chunk));
+                if (!allDigits8(chunk))
+                    break;
+                value = value * 100000000ULL + parseDigits8(chunk);
+                p += 8;
+            }
+#endif
+            for (; p != end; ++p)
+            {
+                unsigned digit = static_cast<unsigned char>(*p) - '0';
+                if (digit > 9)
+                    break;
+                value = value * 10 + digit;
+            }
+            return p;
+        }
+    };
+
+    // =================================================================
+    // PRICE SCALE TABLE - per-symbol tick precision for outbound prices
+    // =================================================================
+    //
+    // Filled at configuration time and read-only afterwards; lookups do
+    // not allocate (heterogeneous string_view find).
+
+    class PriceScaleTable
+    {
+    public:
+        // Default for unlisted symbols: format values at their own scale
+        static constexpr uint8_t KEEP_SCALE = 0xFF;
+
+        explicit PriceScaleTable(uint8_t default_scale = KEEP_SCALE) : default_scale_(default_scale) {}
+
+        void setScale(std::string_view symbol, uint8_t scale);
+        void setDefaultScale(uint8_t scale) { default_scale_ = scale; }
+        uint8_t scaleFor(std::string_view symbol) const; // KEEP_SCALE if unconfigured
+        size_t size() const { return scales_.size(); }
+
+        // Rescale value to the symbol's precision and format it (MAX_TEXT_LENGTH bytes)
+        size_t format(std::string_view symbol, FixDecimal value, char *out) const;
+
+    private:
+        std::map<std::string, uint8_t, std::less<>> scales_;
+        uint8_t default_scale_;
+    };
+
+} // namespace fix_gateway::protocol
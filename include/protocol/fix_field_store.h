@@ -0,0 +1,246 @@
+#pragma once
+
+#include "fix_groups.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // FIX FIELD STORE - Flat, allocation-free tag/value storage
+    // =================================================================
+    //
+    // Each field is a (tag, offset, length) entry pointing into a byte
+    // arena, and both the entry table and the arena live inline in the
+    // object. A pooled FixMessage therefore parses and serializes without
+    // touching the heap; only messages beyond the inline capacity spill
+    // to a heap buffer (kept across clear() for reuse).
+    //
+    // Lookup: tags below DIRECT_INDEX_TAGS (every tag in FixFields) hit a
+    // byte-wide slot table directly; other tags fall back to a linear scan
+    // of the entry table. Fields iterate in insertion (wire) order.
+    //
+    // Reference entries (setReference) skip the arena entirely and point
+    // into an external buffer bound with bindExternal() - the caller owns
+    // that buffer's lifetime (see FixMessage::attachSegment).
+    //
+    // Repeating group fields sit in the same entry table, in wire order
+    // right after their count field, but are flagged so the per-tag index
+    // never sees them. Each group keeps an (entry x column) cell matrix of
+    // entry indices, giving O(1) (group, index, tag) lookup with no
+    // per-entry allocation.
+
+    class FixFieldStore
+    {
+    public:
+        struct Entry
+        {
+            int tag;
+            uint32_t offset; // Offset of the value in the arena (or external buffer)
+            uint32_t length; // Value length
+        };
+
+        static constexpr size_t INLINE_FIELDS = 48;
+        static constexpr size_t INLINE_ARENA_SIZE = 512;
+        static constexpr int DIRECT_INDEX_TAGS = 384;
+        static constexpr size_t MAX_GROUPS = 8;
+        static constexpr size_t INLINE_GROUP_CELLS = 128;
+
+        enum class GroupAppend
+        {
+            Added,     // Stored as a field of the open group
+            NotMember, // Tag ends the group - store it as a regular field
+            Error      // Malformed group (see appendGroupField)
+        };
+
+        // Iterates (tag, value) pairs; values are views into the arena and
+        // are invalidated by the next modification of the store
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<int, std::string_view>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            const_iterator(const FixFieldStore *store, size_t index) : store_(store), index_(index) {}
+
+            value_type operator*() const
+            {
+                const Entry &entry = store_->entries_[index_];
+                return {entry.tag & ~GROUP_FIELD_FLAG, store_->view(entry)};
+            }
+
+            const_iterator &operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator previous = *this;
+                ++index_;
+                return previous;
+            }
+
+            bool operator==(const const_iterator &other) const { return index_ == other.index_; }
+            bool operator!=(const const_iterator &other) const { return index_ != other.index_; }
+
+        private:
+            const FixFieldStore *store_;
+            size_t index_;
+        };
+
+        FixFieldStore() noexcept;
+        FixFieldStore(const FixFieldStore &other);
+        FixFieldStore(FixFieldStore &&other) noexcept;
+        FixFieldStore &operator=(const FixFieldStore &other);
+        FixFieldStore &operator=(FixFieldStore &&other) noexcept;
+        ~FixFieldStore() = default;
+
+        // Lookup (no allocation)
+        const Entry *findEntry(int tag) const
+        {
+            if (static_cast<unsigned>(tag) < static_cast<unsigned>(DIRECT_INDEX_TAGS))
+            {
+                uint8_t slot = direct_index_[tag];
+                if (slot != SLOT_OVERFLOW)
+                {
+                    return slot ? &entries_[slot - 1] : nullptr;
+                }
+            }
+            return scan(tag);
+        }
+
+        bool get(int tag, std::string_view &value) const
+        {
+            const Entry *entry = findEntry(tag);
+            if (!entry)
+            {
+                return false;
+            }
+            value = view(*entry);
+            return true;
+        }
+
+        bool contains(int tag) const { return findEntry(tag) != nullptr; }
+
+        // Modification - set() overwrites an existing tag in place
+        void set(int tag, std::string_view value);
+        bool erase(int tag); // Refuses count tags of stored groups
+        void clear() noexcept; // Also unbinds the external buffer and drops groups
+
+        // Zero-copy entry: value must lie inside the buffer bound with bindExternal()
+        void bindExternal(const char *base) { external_base_ = base; }
+        const char *externalBase() const { return external_base_; }
+        void setReference(int tag, std::string_view value);
+
+        // Copy every referenced value into the arena and unbind the external buffer
+        void internalize();
+
+        // Repeating groups - open after storing the count field; one group is
+        // open at a time. A tag outside the definition is kept in the current
+        // entry as an extra field. It closes the group (NotMember) instead if
+        // it is a header/trailer tag or already a message-level field, or -
+        // once the last announced entry has started - if no earlier entry
+        // carried it or this entry already holds it. appendGroupField returns
+        // Error for a field before the first delimiter, a repeated member
+        // within one entry, more entries than announced, or (when closing)
+        // fewer entries than announced.
+        bool beginGroup(const FixGroupDefinition *definition, uint32_t expected_entries);
+        GroupAppend appendGroupField(int tag, std::string_view value, bool reference);
+        bool endGroup(); // False if the entry count differs from the count field
+        bool inGroup() const { return open_group_ >= 0; }
+
+        size_t groupEntryCount(int count_tag) const;
+        bool getGroupField(int count_tag, size_t index, int tag, std::string_view &value) const;
+
+        size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        // True once the entries or arena outgrew the inline buffers
+        bool spilled() const { return entries_ != inline_entries_ || arena_ != inline_arena_; }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, count_); }
+
+    private:
+        // Slot value for direct-index tags whose entry index does not fit a byte
+        static constexpr uint8_t SLOT_OVERFLOW = 0xFF;
+
+        // Offset flag marking an entry that refers to the external buffer
+        static constexpr uint32_t EXTERNAL_OFFSET = 0x80000000u;
+
+        // Tag flag marking a repeating group field (keeps it out of the tag index)
+        static constexpr int GROUP_FIELD_FLAG = 0x40000000;
+
+        struct GroupInfo
+        {
+            const FixGroupDefinition *definition;
+            uint32_t expected;   // Count field value
+            uint32_t entries;    // Entries started so far
+            uint32_t first_cell; // Start of this group's (entry x column) cells
+            uint32_t entry_start; // Entry-table index of the current entry's delimiter
+        };
+
+        static bool isExternal(const Entry &entry) { return (entry.offset & EXTERNAL_OFFSET) != 0; }
+
+        std::string_view view(const Entry &entry) const
+        {
+            if (isExternal(entry))
+            {
+                return std::string_view(external_base_ + (entry.offset & ~EXTERNAL_OFFSET), entry.length);
+            }
+            return std::string_view(arena_ + entry.offset, entry.length);
+        }
+
+        Entry *appendEntry(int tag);
+        uint32_t copyToArena(std::string_view value);
+        const GroupInfo *findGroup(int count_tag) const;
+        bool closesGroup(const GroupInfo &group, int tag) const;
+        const Entry *findExtraField(const GroupInfo &group, size_t index, int tag) const;
+        void reserveCells(size_t needed);
+
+        const Entry *scan(int tag) const;
+        void indexEntry(size_t index);
+        void reserveEntries(size_t needed);
+        void reserveArena(size_t needed);
+        void copyFrom(const FixFieldStore &other);
+
+        Entry *entries_;
+        char *arena_;
+        const char *external_base_ = nullptr;
+        uint32_t count_ = 0;
+        uint32_t entry_capacity_ = INLINE_FIELDS;
+        uint32_t arena_used_ = 0;
+        uint32_t arena_capacity_ = INLINE_ARENA_SIZE;
+
+        // Entry index + 1 per tag (0 = absent)
+        uint8_t direct_index_[DIRECT_INDEX_TAGS];
+
+        Entry inline_entries_[INLINE_FIELDS];
+        char inline_arena_[INLINE_ARENA_SIZE];
+
+        // Repeating groups
+        GroupInfo groups_[MAX_GROUPS];
+        uint32_t group_count_ = 0;
+        int open_group_ = -1;
+        uint32_t *cells_;
+        uint32_t cells_used_ = 0;
+        uint32_t cell_capacity_ = INLINE_GROUP_CELLS;
+        uint32_t inline_cells_[INLINE_GROUP_CELLS];
+
+        // Spill buffers for oversized messages
+        std::unique_ptr<Entry[]> heap_entries_;
+        std::unique_ptr<char[]> heap_arena_;
+        std::unique_ptr<uint32_t[]> heap_cells_;
+    };
+
+} // namespace fix_gateway::protocol
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace fix_gateway::protocol
@@ -20,6 +24,7 @@ namespace fix_gateway::protocol
         constexpr int MsgSeqNum = 34;        // Message sequence number
         constexpr int SenderCompID = 49;     // Sender ID
         constexpr int TargetCompID = 56;     // Target ID
+        constexpr int SenderSubID = 50;      // Sender desk/trader
         constexpr int SendingTime = 52;      // Message timestamp
         constexpr int PossDupFlag = 43;      // Possible duplicate
         constexpr int PossResend = 97;       // Possible resend
@@ -52,6 +57,10 @@ namespace fix_gateway::protocol
         constexpr int TransactTime = 60; // Transaction time
         constexpr int Text = 58;         // Free text
 
+        // Cancel Reject Fields
+        constexpr int CxlRejReason = 102;     // Cancel reject reason
+        constexpr int CxlRejResponseTo = 434; // Rejected request type
+
         // Market Data Fields
         constexpr int MDReqID = 262;                 // Market data request ID
         constexpr int SubscriptionRequestType = 263; // Subscribe/Unsubscribe
@@ -62,6 +71,8 @@ namespace fix_gateway::protocol
         constexpr int MDEntryPx = 270;               // Entry price
         constexpr int MDEntrySize = 271;             // Entry size
         constexpr int MDEntryTime = 273;             // Entry time
+        constexpr int MDEntryID = 278;               // Entry ID
+        constexpr int MDUpdateAction = 279;          // New/Change/Delete
 
         // Risk and Position Fields
         constexpr int Account = 1;     // Account
@@ -78,7 +89,8 @@ namespace fix_gateway::protocol
         constexpr int RefMsgType = 372;  // Reference message type
 
         // Repeating Group Fields
-        constexpr int NoRelatedSym = 146; // Number of related symbols
+        constexpr int NoRelatedSym = 146;   // Number of related symbols
+        constexpr int NoMDEntryTypes = 267; // Number of requested MD entry types
     }
 
     // FIX Message Types (MsgType field values) - Runtime constants
@@ -111,7 +123,7 @@ namespace fix_gateway::protocol
     }
 
     // Compile-time enum for template specialization (maps to MsgTypes above)
-    enum class FixMsgType
+    enum class FixMsgType : uint8_t
     {
         // Session messages (administrative)
         HEARTBEAT,      // "0"
@@ -194,8 +206,35 @@ namespace fix_gateway::protocol
             }
         }
 
+        constexpr size_t MSG_TYPE_COUNT = static_cast<size_t>(FixMsgType::UNKNOWN) + 1;
+        constexpr size_t MSG_TYPE_CODE_SPACE = 65536;
+
+        // 16-bit MsgType code: first byte low, second byte (0 for one-character types) high
+        constexpr uint16_t msgTypeCode(char first, char second = '\0')
+        {
+            return static_cast<uint16_t>(static_cast<uint8_t>(first) | (static_cast<uint8_t>(second) << 8));
+        }
+
+        // Every possible code maps to its enum (UNKNOWN for unassigned codes),
+        // so classification is a single load with no compares
+        extern const std::array<FixMsgType, MSG_TYPE_CODE_SPACE> MSG_TYPE_BY_CODE;
+
+        inline FixMsgType fromCode(uint16_t code) { return MSG_TYPE_BY_CODE[code]; }
+
         // Convert FIX protocol string to enum (for intelligent parsing)
         FixMsgType fromString(const char *msgTypeStr);
+        FixMsgType fromString(std::string_view msgType); // Non-terminated field values
+
+        constexpr bool isSessionMessage(FixMsgType msgType)
+        {
+            return msgType == FixMsgType::HEARTBEAT ||
+                   msgType == FixMsgType::TEST_REQUEST ||
+                   msgType == FixMsgType::RESEND_REQUEST ||
+                   msgType == FixMsgType::REJECT ||
+                   msgType == FixMsgType::SEQUENCE_RESET ||
+                   msgType == FixMsgType::LOGOUT ||
+                   msgType == FixMsgType::LOGON;
+        }
 
         // Check if message type has optimized template parser (INCOMING MESSAGES ONLY)
         constexpr bool hasOptimizedParser(FixMsgType msgType)
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "fix_fields.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // REPEATING GROUP DEFINITIONS
+    // =================================================================
+    //
+    // A group follows its NoXXX count field. Every entry starts with the
+    // delimiter tag and holds each member tag at most once, so a member's
+    // position in the definition is a fixed column of the entry - this is
+    // what lets FixFieldStore answer (group, index, tag) with one cell
+    // read. Tags outside the definition (MDEntryDate, NumberOfOrders, ...)
+    // stay in the current entry as extra fields, found by a short scan of
+    // that entry. Nested groups are not modelled.
+
+    struct FixGroupDefinition
+    {
+        static constexpr size_t MAX_MEMBERS = 12;
+
+        int count_tag;            // NoXXX
+        uint8_t member_count;     // Columns per entry
+        int members[MAX_MEMBERS]; // members[0] is the delimiter
+
+        int delimiter() const { return members[0]; }
+
+        // Column of tag within an entry, -1 if tag is not a member
+        int column(int tag) const
+        {
+            for (uint8_t i = 0; i < member_count; ++i)
+            {
+                if (members[i] == tag)
+                    return i;
+            }
+            return -1;
+        }
+    };
+
+    namespace FixGroups
+    {
+        // True if msgType carries any repeating group (lets parsers skip the lookup)
+        bool hasGroups(FixMsgType msgType);
+
+        // Group opened by count_tag in msgType, nullptr if the tag is not a group count
+        const FixGroupDefinition *find(FixMsgType msgType, int count_tag);
+
+        // False for standard header and trailer tags, which always close an open group
+        bool canBelongToEntry(int tag);
+    }
+
+} // namespace fix_gateway::protocol
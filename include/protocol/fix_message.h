@@ -1,7 +1,13 @@
 #pragma once
 
 #include "fix_fields.h"
+#include "fix_field_store.h"
+#include "fix_decimal.h"
+#include <atomic>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <chrono>
@@ -11,6 +17,11 @@ namespace fix_gateway::common
 {
     template <typename T>
     class MessagePool;
+
+    template <typename T>
+    struct PoolHeaderTraits;
+
+    class ReceiveSegment;
 }
 
 namespace fix_gateway::protocol
@@ -19,11 +30,84 @@ namespace fix_gateway::protocol
     class FixMessage;
     using FixMessagePool = fix_gateway::common::MessagePool<FixMessage>;
 
+    // One FixMessageHeader field. Only the thread that owns the message writes
+    // it, but FixMessagePool::forEachHeader() reads it from any thread, so it is
+    // a relaxed atomic: owner updates are a relaxed load + store (as cheap as a
+    // plain field) and readers always see a whole value of each field.
+    template <typename T>
+    class HeaderField
+    {
+    public:
+        static_assert(std::atomic<T>::is_always_lock_free, "Header fields live in shared slab memory");
+
+        constexpr HeaderField(T value = T{}) noexcept : value_(value) {}
+        HeaderField(const HeaderField &other) noexcept : value_(other.load()) {}
+        HeaderField &operator=(const HeaderField &other) noexcept
+        {
+            store(other.load());
+            return *this;
+        }
+        HeaderField &operator=(T value) noexcept
+        {
+            store(value);
+            return *this;
+        }
+
+        // Owner only: not atomic as a whole, like SingleWriterCounter::add
+        HeaderField &operator|=(T bits) noexcept
+        {
+            store(static_cast<T>(load() | bits));
+            return *this;
+        }
+        HeaderField &operator&=(T bits) noexcept
+        {
+            store(static_cast<T>(load() & bits));
+            return *this;
+        }
+
+        T load() const noexcept { return value_.load(std::memory_order_relaxed); }
+        operator T() const noexcept { return load(); }
+
+    private:
+        void store(T value) noexcept { value_.store(value, std::memory_order_relaxed); }
+
+        std::atomic<T> value_;
+    };
+
+    // Hot fields of a FixMessage, two per cache line. A pooled message keeps
+    // it in the pool's header array (FixMessagePool::headerOf), so routing and
+    // monitoring can read type, sequence number and priority without touching
+    // the message; an unpooled message keeps it inline. All-zero is a free slot.
+    // Fields are read individually: a monitor may see a header mid-update (new
+    // type, old sequence number) but never a torn field.
+    struct FixMessageHeader
+    {
+        static constexpr uint8_t LIVE = 0x01;            // Slot holds a constructed message
+        static constexpr uint8_t MSG_TYPE_CACHED = 0x02; // msg_type matches tag 35
+        static constexpr uint8_t SEQ_NUM_CACHED = 0x04;  // seq_num matches tag 34
+        static constexpr uint8_t PRIORITY_SET = 0x08;    // priority assigned by the router
+
+        HeaderField<FixMsgType> msg_type{FixMsgType::UNKNOWN};
+        HeaderField<uint8_t> flags;
+        HeaderField<uint8_t> priority; // Priority enum value (see PRIORITY_SET)
+        HeaderField<uint8_t> reserved;
+        HeaderField<uint32_t> session_id;
+        HeaderField<int32_t> seq_num;
+        HeaderField<uint32_t> reserved2;
+        HeaderField<uint64_t> creation_tsc;
+        HeaderField<int64_t> processing_start_ns; // steady_clock, 0 = not marked
+
+        bool isLive() const { return flags & LIVE; }
+        bool hasMsgType() const { return flags & MSG_TYPE_CACHED; }
+        bool hasPriority() const { return flags & PRIORITY_SET; }
+    };
+    static_assert(sizeof(FixMessageHeader) == 32, "Two headers per cache line");
+
     class FixMessage
     {
     public:
-        using FieldMap = std::unordered_map<int, std::string>;
-        using FieldIterator = FieldMap::const_iterator;
+        using FieldMap = std::unordered_map<int, std::string>; // Bulk-construction input only
+        using FieldIterator = FixFieldStore::const_iterator;
 
         // Construction
         FixMessage();
@@ -36,8 +120,8 @@ namespace fix_gateway::protocol
         FixMessage &operator=(const FixMessage &other);
         FixMessage &operator=(FixMessage &&other) noexcept;
 
-        // Destructor
-        ~FixMessage() = default;
+        // Destructor (releases the receive segment of a view)
+        ~FixMessage();
 
         // Core field operations (optimized for trading performance)
         void setField(int tag, const std::string &value);
@@ -45,17 +129,51 @@ namespace fix_gateway::protocol
         void setField(int tag, double value, int precision = 2);
         void setField(int tag, char value);
         void setField(int tag, std::string_view value);
+        void setField(int tag, const FixDecimal &value); // Written at the value's own scale
 
         bool getField(int tag, std::string &value) const;
+        bool getField(int tag, std::string_view &value) const; // Zero-copy, valid until the field changes
         bool getField(int tag, int &value) const;
         bool getField(int tag, double &value) const;
         bool getField(int tag, char &value) const;
+        bool getField(int tag, FixDecimal &value) const; // Exact Price / Qty / Px decode
 
-        // Direct field access (fastest)
-        const std::string *getFieldPtr(int tag) const;
+        // Direct field access (fastest) - empty optional when the tag is absent
+        std::optional<std::string_view> getFieldPtr(int tag) const;
         bool hasField(int tag) const;
         void removeField(int tag);
 
+        // =================================================================
+        // VIEW MODE - fields reference a pinned receive buffer (no copies)
+        // =================================================================
+
+        // Pin the segment for this message's lifetime (one reference per message).
+        // Re-attaching or passing nullptr copies existing view fields out first.
+        void attachSegment(fix_gateway::common::ReceiveSegment *segment);
+
+        // Store value by reference when it lies in the attached segment, else copy
+        void setFieldView(int tag, std::string_view value);
+
+        bool isView() const { return segment_ != nullptr; }
+        fix_gateway::common::ReceiveSegment *getReceiveSegment() const { return segment_; }
+
+        // =================================================================
+        // REPEATING GROUPS - contiguous entries, O(1) (group, index, tag) access
+        // =================================================================
+
+        // Store the count field and open its group (definition from FixGroups
+        // for this MsgType). Entries are then added in wire order with
+        // addGroupField, starting each entry with the delimiter tag.
+        bool beginGroup(int count_tag, uint32_t entries);
+        bool beginGroup(const FixGroupDefinition *definition, uint32_t entries);
+        FixFieldStore::GroupAppend addGroupField(int tag, std::string_view value); // View when in the segment
+        bool endGroup(); // False if fewer entries were added than announced
+        bool inGroup() const { return fields_.inGroup(); }
+
+        size_t getGroupEntryCount(int count_tag) const { return fields_.groupEntryCount(count_tag); }
+        bool getGroupField(int count_tag, size_t index, int tag, std::string_view &value) const;
+        bool getGroupField(int count_tag, size_t index, int tag, FixDecimal &value) const;
+
         // Common field accessors (trading-specific optimization)
         std::string getMsgType() const { return getFieldValue(FixFields::MsgType); }
         std::string getClOrdID() const { return getFieldValue(FixFields::ClOrdID); }
@@ -68,10 +186,33 @@ namespace fix_gateway::protocol
         // Ultra-fast message type classification (cached enum - Option 3 optimization)
         FixMsgType getMsgTypeEnum() const;
 
+        // Seed the cached enum with the type the parser classified at framing time
+        // (must match tag 35; the next field modification clears it as usual)
+        void setMsgTypeEnum(FixMsgType msgType)
+        {
+            header_->msg_type = msgType;
+            header_->flags |= FixMessageHeader::MSG_TYPE_CACHED;
+        }
+
+        // Inbound session that produced the message (0 = untagged); set by the
+        // receive worker so managers shared across sessions can tell them apart
+        void setSessionId(uint32_t sessionId) { header_->session_id = sessionId; }
+        uint32_t getSessionId() const { return header_->session_id; }
+
+        // Hot fields (in the pool's header array for pooled messages)
+        const FixMessageHeader &header() const { return *header_; }
+
+        // Called by MessagePool after construction: move the header into the
+        // slot's entry of the pool's header array
+        void attachHeader(FixMessageHeader *header);
+
         // Session-level fields
         void setSenderCompID(const std::string &senderID);
         void setTargetCompID(const std::string &targetID);
         void setMsgSeqNum(int seqNum);
+        // SendingTime is not set at construction: a message serialized without
+        // tag 52 is stamped at that moment and the stamp is stored as tag 52.
+        // Call these only to pin a value.
         void setSendingTime(); // Sets to current time
         void setSendingTime(const std::chrono::system_clock::time_point &time);
 
@@ -90,9 +231,10 @@ namespace fix_gateway::protocol
 
         // Message metadata
         size_t getFieldCount() const { return fields_.size(); }
-        const FieldMap &getAllFields() const { return fields_; }
-        std::chrono::steady_clock::time_point getCreationTime() const { return creationTime_; }
-        std::chrono::steady_clock::time_point getLastModified() const { return lastModified_; }
+        const FixFieldStore &getAllFields() const { return fields_; }
+        // Raw TSC reads (PerformanceTimer::readTsc) - compare against other TSC reads only
+        uint64_t getCreationTsc() const { return header_->creation_tsc; }
+        uint64_t getLastModifiedTsc() const { return lastModifiedTsc_; }
 
         // Iterator support for field traversal
         FieldIterator begin() const { return fields_.begin(); }
@@ -161,14 +303,20 @@ namespace fix_gateway::protocol
         std::string getFieldsSummary() const;  // One-line summary of key fields
 
     private:
-        // Core data
-        FieldMap fields_;
+        // Hot fields: ownHeader_ until a pool attaches its own entry
+        mutable FixMessageHeader ownHeader_;
+        FixMessageHeader *header_ = &ownHeader_;
+
+        // Core data - inline (tag, offset, length) table + byte arena
+        FixFieldStore fields_;
 
-        // Metadata
-        std::chrono::steady_clock::time_point creationTime_;
-        std::chrono::steady_clock::time_point lastModified_;
-        std::chrono::steady_clock::time_point processingStart_;
+        // Receive buffer referenced by view fields (nullptr for owned messages)
+        fix_gateway::common::ReceiveSegment *segment_ = nullptr;
+
+        // Metadata (cold)
+        uint64_t lastModifiedTsc_;
         std::chrono::steady_clock::time_point processingEnd_;
+        bool sendingTimeStamped_ = false; // Tag 52 stored by the lazy stamp
 
         // Cached values for performance (mutable for lazy computation)
         mutable bool checksumValid_ = false;
@@ -176,15 +324,12 @@ namespace fix_gateway::protocol
         mutable std::string cachedString_;
         mutable bool stringCacheValid_ = false;
 
-        // Cached message type enum for ultra-fast classification (Option 3 optimization)
-        mutable FixMsgType cachedMsgType_ = FixMsgType::UNKNOWN;
-        mutable bool msgTypeCached_ = false;
-
         // Helper methods
         std::string getFieldValue(int tag) const;
-        void setFieldInternal(int tag, const std::string &value);
+        void setFieldInternal(int tag, std::string_view value);
         void invalidateCache();
         void touchModified();
+        void releaseSegment();
 
         // Validation helpers
         bool hasRequiredSessionFields() const;
@@ -196,6 +341,9 @@ namespace fix_gateway::protocol
 
         // Raw pointer factory helper (avoids code duplication)
         static void setCommonSessionFields(FixMessage *msg, const std::string &senderID, const std::string &targetID);
+
+        // Copy the hot fields that travel with a copy or move (not the caches)
+        void copyHeaderFields(const FixMessageHeader &other);
     };
 
     // Utility functions for FIX protocol
@@ -214,7 +362,13 @@ namespace fix_gateway::protocol
         bool isValidExecType(const std::string &execType);
 
         // Time formatting for FIX
+        constexpr size_t FIX_TIMESTAMP_LENGTH = 21; // YYYYMMDD-HH:MM:SS.sss
+
         std::string formatFixTime(const std::chrono::system_clock::time_point &time);
+
+        // Writes FIX_TIMESTAMP_LENGTH bytes to out (no allocation). The seconds
+        // prefix is cached per thread, so most calls only rewrite ".sss".
+        size_t formatFixTime(const std::chrono::system_clock::time_point &time, char *out);
         std::chrono::system_clock::time_point parseFixTime(const std::string &fixTime);
 
         // Numeric validation
@@ -253,4 +407,15 @@ namespace fix_gateway::protocol
                                      const std::string &symbol);
     }
 
-} // namespace fix_gateway::protocol
\ No newline at end of file
+} // namespace fix_gateway::protocol
+namespace fix_gateway::common
+{
+    // Pooled FixMessages use the segregated layout (see message_pool.h)
+    template <>
+    struct PoolHeaderTraits<protocol::FixMessage>
+    {
+        static constexpr bool segregated = true;
+        using Header = protocol::FixMessageHeader;
+        static void attach(protocol::FixMessage *message, Header *header) { message->attachHeader(header); }
+    };
+}
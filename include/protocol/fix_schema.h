@@ -0,0 +1,439 @@
+#pragma once
+
+#include "fix_fields.h"
+#include "fix_decimal.h"
+#include "fix_tokenizer.h"
+#include "fix_checksum.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // COMPILE-TIME MESSAGE SCHEMAS - typed decode without FixMessage
+    // =================================================================
+    //
+    // A schema lists the tags of one message type, the struct member each
+    // tag decodes into and whether it is required, in expected wire order:
+    //
+    //   using Schema = MessageSchema<TypedNewOrderSingle, FixMsgType::NEW_ORDER_SINGLE,
+    //                                SchemaField<FixFields::ClOrdID, &TypedNewOrderSingle::cl_ord_id, true>,
+    //                                ...>;
+    //
+    // TypedDecoder<Schema> frames and checksums one message, tokenizes the
+    // body in a single SIMD sweep and decodes each value straight into the
+    // typed POD struct (fixed-point price, integer qty, enum side). Tags
+    // are matched against the declared order first, so in-order messages
+    // never search; unknown tags are skipped.
+
+    // Inline, fixed-capacity string value (trivially copyable)
+    template <size_t N>
+    struct FixString
+    {
+        static_assert(N > 0 && N <= 255, "FixString length must fit in uint8_t");
+
+        char data[N];
+        uint8_t length;
+
+        std::string_view view() const { return std::string_view(data, length); }
+        bool empty() const { return length == 0; }
+
+        bool assign(std::string_view value)
+        {
+            if (value.size() > N)
+                return false;
+            std::memcpy(data, value.data(), value.size());
+            length = static_cast<uint8_t>(value.size());
+            return true;
+        }
+    };
+
+    // Side (54) as an enum - values are the FIX wire characters
+    enum class SideCode : char
+    {
+        None = 0,
+        Buy = '1',
+        Sell = '2',
+        BuyMinus = '3',
+        SellPlus = '4',
+        SellShort = '5',
+        SellShortExempt = '6',
+        Undisclosed = '7',
+        Cross = '8',
+        CrossShort = '9'
+    };
+
+    // =================================================================
+    // VALUE CODECS - one overload per typed member kind
+    // =================================================================
+
+    namespace schema
+    {
+        template <size_t N>
+        inline bool decodeValue(std::string_view value, FixString<N> &out)
+        {
+            return out.assign(value);
+        }
+
+        inline bool decodeValue(std::string_view value, uint32_t &out)
+        {
+            if (value.empty() || value.size() > 10)
+                return false;
+
+            uint64_t result = 0;
+            for (char c : value)
+            {
+                unsigned digit = static_cast<unsigned char>(c) - '0';
+                if (digit > 9)
+                    return false;
+                result = result * 10 + digit;
+            }
+            if (result > UINT32_MAX)
+                return false;
+
+            out = static_cast<uint32_t>(result);
+            return true;
+        }
+
+        // Integer quantity - "100" and "100.00" are accepted, "100.5" is not
+        inline bool decodeValue(std::string_view value, int64_t &out)
+        {
+            FixDecimal decimal;
+            if (!FixDecimal::parse(value, decimal))
+                return false;
+
+            int64_t mantissa = decimal.mantissa;
+            for (uint8_t i = 0; i < decimal.scale; ++i)
+            {
+                if (mantissa % 10 != 0)
+                    return false;
+                mantissa /= 10;
+            }
+            out = mantissa;
+            return true;
+        }
+
+        inline bool decodeValue(std::string_view value, FixDecimal &out)
+        {
+            return FixDecimal::parse(value, out);
+        }
+
+        inline bool decodeValue(std::string_view value, SideCode &out)
+        {
+            if (value.size() != 1 || value[0] < '1' || value[0] > '9')
+                return false;
+            out = static_cast<SideCode>(value[0]);
+            return true;
+        }
+
+        // Single-character code fields (OrdType, ExecType, OrdStatus, ...)
+        inline bool decodeValue(std::string_view value, char &out)
+        {
+            if (value.size() != 1)
+                return false;
+            out = value[0];
+            return true;
+        }
+
+        // True if value is longer than the member can hold (FixString only)
+        template <typename T>
+        inline bool exceedsCapacity(std::string_view, const T &)
+        {
+            return false;
+        }
+
+        template <size_t N>
+        inline bool exceedsCapacity(std::string_view value, const FixString<N> &)
+        {
+            return value.size() > N;
+        }
+
+        // Element count of a member array `Entry (Msg::*)[N]`
+        template <typename T>
+        struct MemberArrayExtent;
+
+        template <typename Owner, typename Entry, size_t N>
+        struct MemberArrayExtent<Entry (Owner::*)[N]>
+        {
+            static constexpr size_t value = N;
+        };
+
+        // Per-decode bookkeeping for the (single) repeating group of a schema
+        struct DecodeState
+        {
+            uint32_t group_expected = 0; // NoXXX value
+            uint32_t group_seen = 0;     // Entries started by the delimiter tag
+            bool has_group = false;
+            bool overflow = false; // A value or entry did not fit the typed struct
+        };
+    }
+
+    // =================================================================
+    // FIELD DESCRIPTORS
+    // =================================================================
+
+    // Plain field: tag -> msg.*Member
+    template <int Tag, auto Member, bool Required = false>
+    struct SchemaField
+    {
+        static constexpr int tag = Tag;
+        static constexpr bool required = Required;
+
+        template <typename Msg>
+        static bool decode(std::string_view value, Msg &msg, schema::DecodeState &state)
+        {
+            if (schema::exceedsCapacity(value, msg.*Member))
+            {
+                state.overflow = true;
+                return false;
+            }
+            return schema::decodeValue(value, msg.*Member);
+        }
+    };
+
+    // Repeating group count (NoXXX); Count receives the number of decoded entries
+    template <int Tag, auto Count, bool Required = false>
+    struct SchemaGroupCount
+    {
+        static constexpr int tag = Tag;
+        static constexpr bool required = Required;
+
+        template <typename Msg>
+        static bool decode(std::string_view value, Msg &msg, schema::DecodeState &state)
+        {
+            uint32_t expected = 0;
+            if (state.has_group || !schema::decodeValue(value, expected))
+                return false;
+
+            state.has_group = true;
+            state.group_expected = expected;
+            msg.*Count = 0;
+            return true;
+        }
+    };
+
+    // Field inside a repeating group entry: (msg.*Entries)[i].*Member. The
+    // Delimiter field (first tag of every entry) starts a new entry.
+    template <int Tag, auto Entries, auto Count, auto Member, bool Delimiter = false>
+    struct SchemaGroupField
+    {
+        static constexpr int tag = Tag;
+        static constexpr bool required = false;
+
+        template <typename Msg>
+        static bool decode(std::string_view value, Msg &msg, schema::DecodeState &state)
+        {
+            constexpr size_t capacity = schema::MemberArrayExtent<decltype(Entries)>::value;
+            if (!state.has_group)
+                return false;
+
+            if (Delimiter)
+            {
+                if (state.group_seen >= state.group_expected)
+                    return false;
+                if (state.group_seen >= capacity)
+                {
+                    state.overflow = true;
+                    return false;
+                }
+                msg.*Count = static_cast<std::remove_reference_t<decltype(msg.*Count)>>(++state.group_seen);
+            }
+            else if (state.group_seen == 0)
+            {
+                return false; // Group field before the delimiter
+            }
+
+            auto &member = (msg.*Entries)[state.group_seen - 1].*Member;
+            if (schema::exceedsCapacity(value, member))
+            {
+                state.overflow = true;
+                return false;
+            }
+            return schema::decodeValue(value, member);
+        }
+    };
+
+    // =================================================================
+    // MESSAGE SCHEMA
+    // =================================================================
+
+    template <typename Msg, FixMsgType Type, typename... Fields>
+    struct MessageSchema
+    {
+        using Message = Msg;
+        static constexpr FixMsgType msg_type = Type;
+        static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+
+        static_assert(std::is_trivially_copyable_v<Msg>, "Typed messages must be POD-like");
+        static_assert(FIELD_COUNT > 0 && FIELD_COUNT <= 64, "Schema field count must fit the presence mask");
+
+        using DecodeFn = bool (*)(std::string_view, Msg &, schema::DecodeState &);
+
+        static constexpr int tags[] = {Fields::tag...};
+        static constexpr DecodeFn decoders[] = {&Fields::template decode<Msg>...};
+        static constexpr bool required[] = {Fields::required...};
+
+        static constexpr uint64_t requiredMask()
+        {
+            uint64_t mask = 0;
+            for (size_t i = 0; i < FIELD_COUNT; ++i)
+            {
+                if (required[i])
+                    mask |= uint64_t{1} << i;
+            }
+            return mask;
+        }
+
+        // Index of tag, trying the expected (next in wire order) slot first
+        static int find(int tag, size_t hint)
+        {
+            if (hint < FIELD_COUNT && tags[hint] == tag)
+                return static_cast<int>(hint);
+
+            for (size_t i = 0; i < FIELD_COUNT; ++i)
+            {
+                if (tags[i] == tag)
+                    return static_cast<int>(i);
+            }
+            return -1;
+        }
+    };
+
+    // =================================================================
+    // TYPED DECODER
+    // =================================================================
+
+    enum class TypedDecodeStatus
+    {
+        Ok,
+        NeedMoreData,    // Buffer holds less than one complete message
+        InvalidFormat,   // Framing / header / trailer / tokenizer error
+        WrongMsgType,    // MsgType (35) is not the schema's type
+        ChecksumError,   // CheckSum (10) mismatch
+        InvalidValue,    // A schema field failed to decode (see error_tag)
+        MissingRequired, // A required schema field is absent (see error_tag)
+        Overflow         // Valid message too large for the typed struct (see error_tag)
+    };
+
+    struct TypedDecodeResult
+    {
+        TypedDecodeStatus status;
+        size_t bytes_consumed; // Full message length on Ok and Overflow
+        int error_tag;         // Offending tag for InvalidValue / MissingRequired
+    };
+
+    template <typename Schema>
+    struct TypedDecoder
+    {
+        using Msg = typename Schema::Message;
+
+        // Decode the complete message at the start of buffer into out
+        static TypedDecodeResult decode(const char *buffer, size_t length, Msg &out, bool validate_checksum = true)
+        {
+            static constexpr char PREFIX[] = "8=FIX.4.4\0019=";
+            static constexpr size_t PREFIX_LENGTH = sizeof(PREFIX) - 1;
+
+            if (!buffer || length < PREFIX_LENGTH)
+                return {TypedDecodeStatus::NeedMoreData, 0, 0};
+            if (std::memcmp(buffer, PREFIX, PREFIX_LENGTH) != 0)
+                return {TypedDecodeStatus::InvalidFormat, 0, 0};
+
+            // BodyLength
+            const char *end = buffer + length;
+            const char *p = buffer + PREFIX_LENGTH;
+            size_t body_length = 0;
+            for (; p < end && *p != '\001'; ++p)
+            {
+                unsigned digit = static_cast<unsigned char>(*p) - '0';
+                if (digit > 9 || body_length > 1000000)
+                    return {TypedDecodeStatus::InvalidFormat, 0, FixFields::BodyLength};
+                body_length = body_length * 10 + digit;
+            }
+            if (p == end)
+                return {TypedDecodeStatus::NeedMoreData, 0, 0};
+
+            const char *body_start = p + 1;
+            if (static_cast<size_t>(end - body_start) < body_length + FixChecksum::TRAILER_LENGTH)
+                return {TypedDecodeStatus::NeedMoreData, 0, 0};
+
+            const char *body_end = body_start + body_length;
+            const size_t message_length = static_cast<size_t>(body_end - buffer) + FixChecksum::TRAILER_LENGTH;
+            if (body_end[0] != '1' || body_end[1] != '0' || body_end[2] != '=' || body_end[6] != '\001')
+                return {TypedDecodeStatus::InvalidFormat, 0, FixFields::CheckSum};
+
+            out = Msg{};
+            schema::DecodeState state;
+            uint64_t present = 0;
+            size_t hint = 0;
+            bool msg_type_checked = false;
+
+            uint32_t byte_sum = FixChecksum::byteSum(buffer, static_cast<size_t>(body_start - buffer));
+            FieldToken fields[FixTokenizer::DEFAULT_TABLE_SIZE];
+            const char *scan_ptr = body_start;
+
+            while (scan_ptr < body_end)
+            {
+                FixTokenizer::Result tok = FixTokenizer::tokenize(
+                    scan_ptr, static_cast<size_t>(body_end - scan_ptr), fields, FixTokenizer::DEFAULT_TABLE_SIZE,
+                    (validate_checksum && scan_ptr == body_start) ? &byte_sum : nullptr);
+                if (tok.status != FixTokenizer::Status::Ok || tok.field_count == 0)
+                    return {TypedDecodeStatus::InvalidFormat, 0, 0};
+
+                for (size_t i = 0; i < tok.field_count; ++i)
+                {
+                    std::string_view value(scan_ptr + fields[i].value_offset, fields[i].value_length);
+
+                    // MsgType must lead the body and match the schema
+                    if (!msg_type_checked)
+                    {
+                        if (fields[i].tag != FixFields::MsgType ||
+                            value != FixMsgTypeUtils::toString(Schema::msg_type))
+                            return {TypedDecodeStatus::WrongMsgType, 0, FixFields::MsgType};
+                        msg_type_checked = true;
+                        continue;
+                    }
+
+                    int index = Schema::find(fields[i].tag, hint);
+                    if (index < 0)
+                        continue; // Not in the schema
+
+                    if (!Schema::decoders[index](value, out, state))
+                    {
+                        if (state.overflow)
+                            return {TypedDecodeStatus::Overflow, message_length, fields[i].tag};
+                        return {TypedDecodeStatus::InvalidValue, 0, fields[i].tag};
+                    }
+
+                    present |= uint64_t{1} << index;
+                    hint = static_cast<size_t>(index) + 1;
+                }
+
+                scan_ptr += tok.bytes_consumed;
+            }
+
+            if (!msg_type_checked)
+                return {TypedDecodeStatus::WrongMsgType, 0, FixFields::MsgType};
+
+            if (validate_checksum)
+            {
+                uint8_t received = 0;
+                if (!FixChecksum::parse(body_end + 3, received) || static_cast<uint8_t>(byte_sum) != received)
+                    return {TypedDecodeStatus::ChecksumError, 0, FixFields::CheckSum};
+            }
+
+            constexpr uint64_t required_mask = Schema::requiredMask();
+            uint64_t missing = required_mask & ~present;
+            if (missing)
+                return {TypedDecodeStatus::MissingRequired, 0, Schema::tags[__builtin_ctzll(missing)]};
+
+            if (state.group_seen != state.group_expected)
+                return {TypedDecodeStatus::InvalidValue, 0, 0};
+
+            return {TypedDecodeStatus::Ok, message_length, 0};
+        }
+    };
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "protocol/fix_tokenizer.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // FIX STREAM SCANNER - Resumable byte-level DFA for partial messages
+    // =================================================================
+    //
+    // Walks one message a byte at a time through a table-driven state
+    // machine: each byte maps to a class (digit, '=', SOH, other) and the
+    // (state, class) pair selects the next state and an action. The whole
+    // context is fixed-size - tag accumulator, field offsets relative to the
+    // start of the frame, running checksum and body-length counter - so a
+    // message split across any number of reads resumes exactly where the
+    // previous feed() stopped, without allocating or rescanning a byte.
+    //
+    // Field values are recorded as offsets, so the frame bytes must stay
+    // where they are (retained partial buffer or receive ring) until the
+    // message completes.
+
+    class FixStreamScanner
+    {
+    public:
+        enum class Status : uint8_t
+        {
+            NeedMoreData,        // Frame incomplete - feed() again once more bytes are retained
+            Complete,            // CheckSum field terminated; frameLength() bytes form the message
+            InvalidTag,          // Empty, non-numeric or oversized tag, or SOH before '='
+            FieldOrder,          // BeginString, BodyLength, MsgType not the first three fields
+            InvalidBeginString,  // BeginString value is not "FIX..."
+            InvalidBodyLength,   // BodyLength not a positive integer within the limit
+            BodyLengthMismatch,  // CheckSum not where BodyLength puts it
+            InvalidChecksum,     // CheckSum value is not three digits
+            TooManyFields        // Field table full
+        };
+
+        // Lexical position within the current field (rows of the transition table)
+        enum class State : uint8_t
+        {
+            TAG_START, // Expecting the first digit of a tag
+            TAG,       // Accumulating tag digits
+            VALUE,     // Inside a value, waiting for SOH
+            COMPLETE,
+            ERROR
+        };
+
+        static constexpr size_t MAX_FIELDS = 256;
+        static constexpr size_t DEFAULT_MAX_BODY_LENGTH = 1024 * 1024;
+
+        explicit FixStreamScanner(size_t max_body_length = DEFAULT_MAX_BODY_LENGTH)
+            : max_body_length_(max_body_length)
+        {
+        }
+
+        // Scan [frame + scanned(), frame + available). Every call for one message
+        // must pass the same frame start; call reset() before the next message.
+        Status feed(const char *frame, size_t available);
+
+        void reset();
+        void setMaxBodyLength(size_t max_body_length) { max_body_length_ = max_body_length; }
+
+        State state() const { return state_; }
+        Status status() const { return status_; }
+        bool started() const { return scanned_ != 0; }
+        size_t scanned() const { return scanned_; }
+
+        // Tag of the field in progress (digits accumulated so far)
+        int currentTag() const { return tag_; }
+
+        // Completed fields, BeginString first; offsets are relative to the frame start
+        size_t fieldCount() const { return field_count_; }
+        const FieldToken &field(size_t index) const { return fields_[index]; }
+
+        // Valid once the BodyLength field has been scanned
+        size_t bodyLength() const { return body_length_; }
+
+        // Valid once Complete
+        size_t frameLength() const { return scanned_; }
+        uint8_t computedChecksum() const { return static_cast<uint8_t>(checksum_sum_); }
+        uint8_t receivedChecksum() const { return received_checksum_; }
+
+    private:
+        Status beginValue(size_t pos);
+        Status endField(const char *frame, size_t pos);
+        Status fail(size_t pos, Status status);
+
+        State state_ = State::TAG_START;
+        Status status_ = Status::NeedMoreData;
+        size_t scanned_ = 0; // Resume offset
+
+        // Field in progress
+        int tag_ = 0;
+        size_t field_start_ = 0;
+        size_t value_start_ = 0;
+        uint32_t field_sum_ = 0; // Byte sum before field_start_
+
+        // Running checksum and body accounting
+        uint32_t sum_ = 0;
+        uint32_t checksum_sum_ = 0; // Byte sum before "10="
+        uint8_t received_checksum_ = 0;
+        size_t body_start_ = 0; // 0 until BodyLength is scanned
+        size_t body_length_ = 0;
+        size_t max_body_length_;
+
+        size_t field_count_ = 0;
+        FieldToken fields_[MAX_FIELDS];
+    };
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // FIX TOKENIZER - Single-pass tag/value offset table
+    // =================================================================
+    //
+    // Scans a run of "tag=value<SOH>" fields once, locating every '=' and
+    // SOH delimiter with a vector compare (32 bytes per step on AVX2, 16 on
+    // SSE2) and emitting one FieldToken per field. Offsets are relative to
+    // the start of the scanned range, so the table can be reused against
+    // any buffer without pointer fix-ups.
+    //
+    // The kernel is selected once at runtime from PlatformDetector; a scalar
+    // kernel is always available for non-x86 builds and older CPUs.
+
+    // One field located by the tokenizer
+    struct FieldToken
+    {
+        int tag;               // Parsed numeric tag
+        uint32_t value_offset; // Offset of the first value byte
+        uint32_t value_length; // Value length (excluding SOH)
+    };
+
+    class FixTokenizer
+    {
+    public:
+        enum class Kernel
+        {
+            SCALAR,
+            SSE2,
+            AVX2
+        };
+
+        enum class Status
+        {
+            Ok,            // Every complete field emitted (table may have filled first)
+            Incomplete,    // Trailing bytes without a terminating SOH
+            MissingEquals, // SOH reached before the '=' of a field
+            InvalidTag     // Empty or non-numeric tag
+        };
+
+        struct Result
+        {
+            Status status;
+            size_t field_count;    // Entries written to the table
+            size_t bytes_consumed; // Bytes covered by the emitted fields (resume point)
+        };
+
+        // Fields per pass for callers that keep the table on the stack
+        static constexpr size_t DEFAULT_TABLE_SIZE = 128;
+
+        // Tokenize [buffer, buffer + length) with the best kernel for this CPU.
+        // Stops after max_fields entries; call again from bytes_consumed to continue.
+        // If byte_sum is set, the sum of ALL input bytes is added to it in the same
+        // sweep (incremental checksum) - pass it only on the first call of a resume loop.
+        static Result tokenize(const char *buffer, size_t length, FieldToken *fields, size_t max_fields,
+                               uint32_t *byte_sum = nullptr);
+
+        // Tokenize with a specific kernel (falls back to SCALAR if unsupported)
+        static Result tokenizeWith(Kernel kernel, const char *buffer, size_t length,
+                                   FieldToken *fields, size_t max_fields, uint32_t *byte_sum = nullptr);
+
+        // Kernel selection
+        static Kernel activeKernel();
+        static bool isKernelSupported(Kernel kernel);
+        static const char *kernelName(Kernel kernel);
+    };
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "fix_schema.h"
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // TYPED MESSAGES - POD views of the hot-path business messages
+    // =================================================================
+    //
+    // Decoded with StreamFixParser::parseTyped<T>() or TypedDecoder<SchemaFor<T>::type>.
+    // Field order in each schema follows the usual wire order so the
+    // decoder's cursor hint hits on every tag of a conventional message.
+    //
+    // FIX sets no length limit on String fields; capacities cover timestamps
+    // with nanoseconds (27 chars), UUID-sized IDs and option symbols. A longer
+    // value or more group entries than MAX_ENTRIES is not an error:
+    // parseTyped() decodes that message into a pooled FixMessage instead.
+
+    struct TypedHeader
+    {
+        FixString<64> sender_comp_id;
+        FixString<64> target_comp_id;
+        uint32_t msg_seq_num;
+        FixString<32> sending_time;
+    };
+
+    // Maps a typed message struct to its schema
+    template <typename TypedMessage>
+    struct SchemaFor;
+
+    // Schema with the standard header fields in front of the body fields
+    template <typename Msg, FixMsgType Type, typename... BodyFields>
+    using HeaderedSchema = MessageSchema<Msg, Type,
+                                         SchemaField<FixFields::SenderCompID, &TypedHeader::sender_comp_id, true>,
+                                         SchemaField<FixFields::TargetCompID, &TypedHeader::target_comp_id, true>,
+                                         SchemaField<FixFields::MsgSeqNum, &TypedHeader::msg_seq_num, true>,
+                                         SchemaField<FixFields::SendingTime, &TypedHeader::sending_time>,
+                                         BodyFields...>;
+
+    // =================================================================
+    // NEW ORDER SINGLE (D)
+    // =================================================================
+
+    struct TypedNewOrderSingle : TypedHeader
+    {
+        FixString<64> cl_ord_id;
+        FixString<32> account;
+        FixString<32> symbol;
+        SideCode side;
+        char ord_type;
+        char time_in_force;
+        int64_t order_qty;
+        FixDecimal price;
+        FixString<32> transact_time;
+    };
+
+    template <>
+    struct SchemaFor<TypedNewOrderSingle>
+    {
+        using M = TypedNewOrderSingle;
+        using type = HeaderedSchema<M, FixMsgType::NEW_ORDER_SINGLE,
+                                    SchemaField<FixFields::ClOrdID, &M::cl_ord_id, true>,
+                                    SchemaField<FixFields::Account, &M::account>,
+                                    SchemaField<FixFields::Symbol, &M::symbol, true>,
+                                    SchemaField<FixFields::Side, &M::side, true>,
+                                    SchemaField<FixFields::OrderQty, &M::order_qty, true>,
+                                    SchemaField<FixFields::OrdType, &M::ord_type, true>,
+                                    SchemaField<FixFields::Price, &M::price>,
+                                    SchemaField<FixFields::TimeInForce, &M::time_in_force>,
+                                    SchemaField<FixFields::TransactTime, &M::transact_time>>;
+    };
+
+    // =================================================================
+    // ORDER CANCEL REQUEST (F)
+    // =================================================================
+
+    struct TypedOrderCancelRequest : TypedHeader
+    {
+        FixString<64> orig_cl_ord_id;
+        FixString<64> order_id;
+        FixString<64> cl_ord_id;
+        FixString<32> symbol;
+        SideCode side;
+        int64_t order_qty;
+        FixString<32> transact_time;
+    };
+
+    template <>
+    struct SchemaFor<TypedOrderCancelRequest>
+    {
+        using M = TypedOrderCancelRequest;
+        using type = HeaderedSchema<M, FixMsgType::ORDER_CANCEL_REQUEST,
+                                    SchemaField<FixFields::OrigClOrdID, &M::orig_cl_ord_id, true>,
+                                    SchemaField<FixFields::OrderID, &M::order_id>,
+                                    SchemaField<FixFields::ClOrdID, &M::cl_ord_id, true>,
+                                    SchemaField<FixFields::Symbol, &M::symbol, true>,
+                                    SchemaField<FixFields::Side, &M::side, true>,
+                                    SchemaField<FixFields::OrderQty, &M::order_qty>,
+                                    SchemaField<FixFields::TransactTime, &M::transact_time>>;
+    };
+
+    // =================================================================
+    // EXECUTION REPORT (8)
+    // =================================================================
+
+    struct TypedExecutionReport : TypedHeader
+    {
+        FixString<64> order_id;
+        FixString<64> cl_ord_id;
+        FixString<64> orig_cl_ord_id;
+        FixString<64> exec_id;
+        char exec_type;
+        char ord_status;
+        SideCode side;
+        FixString<32> symbol;
+        int64_t order_qty;
+        FixDecimal price;
+        int64_t last_qty;
+        FixDecimal last_px;
+        int64_t leaves_qty;
+        int64_t cum_qty;
+        FixDecimal avg_px;
+        FixString<32> transact_time;
+        FixString<255> text;
+    };
+
+    template <>
+    struct SchemaFor<TypedExecutionReport>
+    {
+        using M = TypedExecutionReport;
+        using type = HeaderedSchema<M, FixMsgType::EXECUTION_REPORT,
+                                    SchemaField<FixFields::OrderID, &M::order_id, true>,
+                                    SchemaField<FixFields::ClOrdID, &M::cl_ord_id>,
+                                    SchemaField<FixFields::OrigClOrdID, &M::orig_cl_ord_id>,
+                                    SchemaField<FixFields::ExecID, &M::exec_id, true>,
+                                    SchemaField<FixFields::ExecType, &M::exec_type, true>,
+                                    SchemaField<FixFields::OrdStatus, &M::ord_status, true>,
+                                    SchemaField<FixFields::Symbol, &M::symbol, true>,
+                                    SchemaField<FixFields::Side, &M::side, true>,
+                                    SchemaField<FixFields::OrderQty, &M::order_qty>,
+                                    SchemaField<FixFields::Price, &M::price>,
+                                    SchemaField<FixFields::LastQty, &M::last_qty>,
+                                    SchemaField<FixFields::LastPx, &M::last_px>,
+                                    SchemaField<FixFields::LeavesQty, &M::leaves_qty, true>,
+                                    SchemaField<FixFields::CumQty, &M::cum_qty, true>,
+                                    SchemaField<FixFields::AvgPx, &M::avg_px>,
+                                    SchemaField<FixFields::TransactTime, &M::transact_time>,
+                                    SchemaField<FixFields::Text, &M::text>>;
+    };
+
+    // =================================================================
+    // ORDER CANCEL REJECT (9)
+    // =================================================================
+
+    struct TypedOrderCancelReject : TypedHeader
+    {
+        FixString<64> order_id;
+        FixString<64> cl_ord_id;
+        FixString<64> orig_cl_ord_id;
+        char ord_status;
+        char cxl_rej_response_to;
+        uint32_t cxl_rej_reason;
+        FixString<255> text;
+    };
+
+    template <>
+    struct SchemaFor<TypedOrderCancelReject>
+    {
+        using M = TypedOrderCancelReject;
+        using type = HeaderedSchema<M, FixMsgType::ORDER_CANCEL_REJECT,
+                                    SchemaField<FixFields::OrderID, &M::order_id, true>,
+                                    SchemaField<FixFields::ClOrdID, &M::cl_ord_id, true>,
+                                    SchemaField<FixFields::OrigClOrdID, &M::orig_cl_ord_id, true>,
+                                    SchemaField<FixFields::OrdStatus, &M::ord_status, true>,
+                                    SchemaField<FixFields::CxlRejResponseTo, &M::cxl_rej_response_to, true>,
+                                    SchemaField<FixFields::CxlRejReason, &M::cxl_rej_reason>,
+                                    SchemaField<FixFields::Text, &M::text>>;
+    };
+
+    // =================================================================
+    // MARKET DATA INCREMENTAL REFRESH (X)
+    // =================================================================
+
+    struct TypedMDEntry
+    {
+        char update_action; // 279 - delimiter of each entry
+        char entry_type;    // 269
+        FixString<32> entry_id;
+        FixString<32> symbol;
+        FixDecimal price;
+        int64_t size;
+        FixString<32> entry_time;
+    };
+
+    struct TypedMarketDataIncrementalRefresh : TypedHeader
+    {
+        static constexpr size_t MAX_ENTRIES = 64;
+
+        FixString<64> md_req_id;
+        uint32_t entry_count;
+        TypedMDEntry entries[MAX_ENTRIES];
+    };
+
+    template <>
+    struct SchemaFor<TypedMarketDataIncrementalRefresh>
+    {
+        using M = TypedMarketDataIncrementalRefresh;
+        using type = HeaderedSchema<M, FixMsgType::MARKET_DATA_INCREMENTAL_REFRESH,
+                                    SchemaField<FixFields::MDReqID, &M::md_req_id>,
+                                    SchemaGroupCount<FixFields::NoMDEntries, &M::entry_count, true>,
+                                    SchemaGroupField<FixFields::MDUpdateAction, &M::entries, &M::entry_count, &TypedMDEntry::update_action, true>,
+                                    SchemaGroupField<FixFields::MDEntryType, &M::entries, &M::entry_count, &TypedMDEntry::entry_type>,
+                                    SchemaGroupField<FixFields::MDEntryID, &M::entries, &M::entry_count, &TypedMDEntry::entry_id>,
+                                    SchemaGroupField<FixFields::Symbol, &M::entries, &M::entry_count, &TypedMDEntry::symbol>,
+                                    SchemaGroupField<FixFields::MDEntryPx, &M::entries, &M::entry_count, &TypedMDEntry::price>,
+                                    SchemaGroupField<FixFields::MDEntrySize, &M::entries, &M::entry_count, &TypedMDEntry::size>,
+                                    SchemaGroupField<FixFields::MDEntryTime, &M::entries, &M::entry_count, &TypedMDEntry::entry_time>>;
+    };
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "fix_fields.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // MESSAGE PREFILTER - Classify framed messages before decode
+    // =================================================================
+    //
+    // Runs on a complete frame right after framing has classified its 35=
+    // field, before a FixMessage is allocated. Each frame is decoded as usual
+    // (Parse), handed on as raw bytes (PassThrough), or skipped (Drop).
+    //
+    // The action comes from the message type, refined by field rules on a few
+    // cheaply peeked tags (Symbol, Account, SenderSubID):
+    //
+    //   prefilter.setAction(FixMsgType::HEARTBEAT, PrefilterAction::Drop);
+    //   prefilter.addFieldRule(FixMsgType::MARKET_DATA_SNAPSHOT, FixFields::Symbol,
+    //                          {"AAPL", "MSFT"}, PrefilterAction::Parse, PrefilterAction::Drop);
+    //
+    // Dropped frames are never checksummed. PassThrough frames are checked
+    // first (when the parser validates checksums); a corrupt one is decoded
+    // instead, so it fails like any other bad frame.
+    // Immutable once handed to a parser; one instance may serve many parsers.
+
+    enum class PrefilterAction : uint8_t
+    {
+        Parse,       // Full decode into a pooled FixMessage
+        PassThrough, // Raw frame to the parser's pass-through handler
+        Drop         // Counted and skipped
+    };
+
+    class MessagePrefilter
+    {
+    public:
+        // Rules per message type (one per peekable tag)
+        static constexpr size_t MAX_RULES_PER_TYPE = 3;
+
+        MessagePrefilter();
+
+        // Action for every frame of a type without field rules (default Parse)
+        void setAction(FixMsgType msg_type, PrefilterAction action);
+
+        // Frames of msg_type whose tag value is in values get on_match, all
+        // others (including frames without the tag) get otherwise. With several
+        // rules the most permissive outcome wins (Parse over PassThrough over Drop),
+        // so a frame is never dropped while any rule wants it. False if the tag
+        // cannot be peeked, the type is UNKNOWN or its rules are full.
+        bool addFieldRule(FixMsgType msg_type, int tag, std::vector<std::string> values,
+                          PrefilterAction on_match, PrefilterAction otherwise);
+
+        // Tags addFieldRule() accepts
+        static bool isPeekableTag(int tag);
+
+        // Action for one complete frame (BeginString through the CheckSum trailer)
+        PrefilterAction classify(FixMsgType msg_type, const char *frame, size_t length) const;
+
+        // True if any type is filtered at all (lets a parser skip the call)
+        bool isActive() const { return active_; }
+
+        // True if a session-level message (Heartbeat, Logon, ...) can be passed
+        // through or dropped. Such frames never reach the session's MsgSeqNum
+        // check, so a session path must not use this prefilter.
+        bool filtersSessionMessages() const;
+
+    private:
+        struct FieldRule
+        {
+            int tag = 0;
+            std::vector<std::string> values; // Sorted for binary search
+            PrefilterAction on_match = PrefilterAction::Parse;
+            PrefilterAction otherwise = PrefilterAction::Parse;
+        };
+
+        struct TypeFilter
+        {
+            PrefilterAction action = PrefilterAction::Parse;
+            uint8_t rule_count = 0;
+            std::array<FieldRule, MAX_RULES_PER_TYPE> rules;
+        };
+
+        // First occurrence of each rule tag in the body; empty views for absent tags
+        void peekFields(const TypeFilter &filter, const char *frame, size_t length,
+                        std::array<std::string_view, MAX_RULES_PER_TYPE> &values) const;
+
+        std::array<TypeFilter, FixMsgTypeUtils::MSG_TYPE_COUNT> filters_;
+        bool active_ = false;
+    };
+
+} // namespace fix_gateway::protocol
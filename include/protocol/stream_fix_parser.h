@@ -2,16 +2,25 @@
 
 #include "fix_message.h"
 #include "fix_fields.h"
+#include "fix_checksum.h"
+#include "fix_typed_messages.h"
+#include "fix_groups.h"
+#include "fix_stream_scanner.h"
+#include "message_prefilter.h"
 #include "common/message_pool.h"
+#include "common/receive_segment.h"
+#include "common/receive_ring.h"
 #include "utils/fast_string_conversion.h"
+#include "utils/latency_histogram.h"
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>  // Added for strncmp and memchr
-#include <map>    // Added for error pattern tracking
-#include <vector> // Added for parsed_fields storage
 
 namespace fix_gateway::protocol
 {
@@ -37,7 +46,7 @@ namespace fix_gateway::protocol
     // The StreamFixParser maintains mutable state including:
     // - parse_context_: Current parsing state and partial message data
     // - partial_buffer_: Buffer for incomplete messages across parse() calls
-    // - stats_: Performance statistics (non-atomic counters)
+    // - stats_: Performance statistics (single-writer atomic counters)
     // - circuit_breaker_*: Error recovery state
     //
     // SAFE USAGE PATTERNS:
@@ -48,10 +57,9 @@ namespace fix_gateway::protocol
     // UNSAFE USAGE:
     // - Sharing a single parser instance across multiple threads
     // - Concurrent calls to parse() from different threads
-    // - Reading stats_ from one thread while parse() runs on another
     //
-    // For multi-threaded applications, consider using atomic<uint64_t>
-    // for stats_ fields or implement external synchronization.
+    // getStats() is the exception: counters and the latency histogram may be
+    // read or snapshot() from a monitoring thread while parse() runs.
     //
     class StreamFixParser
     {
@@ -104,43 +112,95 @@ namespace fix_gateway::protocol
             size_t error_position;      // Position where error occurred (for recovery)
         };
 
-        // Enhanced parser statistics with state machine and error tracking
+        // Batch parse result - every message framed from one receive buffer
+        struct BatchParseResult
+        {
+            ParseStatus status;       // Success, NeedMoreData, or the error that stopped the batch
+            size_t messages_parsed;   // Number of FixMessage* written to the caller's array
+            size_t messages_dropped;  // Complete frames that failed decode and were skipped
+            size_t messages_filtered; // Complete frames passed through or dropped by the prefilter
+            size_t bytes_consumed;    // Bytes of the caller's buffer consumed (incl. retained partial tail)
+            std::string error_detail; // Last error description (empty when no frame failed)
+        };
+
+        static constexpr size_t PARSE_STATE_COUNT = static_cast<size_t>(ParseState::CORRUPTED_SKIP) + 1;
+        static constexpr size_t PARSE_STATUS_COUNT = static_cast<size_t>(ParseStatus::CorruptedData) + 1;
+
+        // Parser statistics. Written only by the parsing thread (relaxed single-writer
+        // counters, enum-indexed arrays - no allocation on the hot path); a monitoring
+        // thread reads them directly or takes a snapshot().
         struct ParserStats
         {
-            uint64_t messages_parsed = 0;
-            uint64_t parse_errors = 0;
-            uint64_t checksum_errors = 0;
-            uint64_t allocation_failures = 0;
-            uint64_t total_parse_time_ns = 0;
-            uint64_t max_parse_time_ns = 0;
-            uint64_t min_parse_time_ns = UINT64_MAX;
+            using Counter = utils::SingleWriterCounter;
+
+            Counter messages_parsed;
+            Counter parse_errors;
+            Counter checksum_errors;
+            Counter allocation_failures;
+            Counter total_parse_time_ns;
+            Counter max_parse_time_ns;
+            Counter min_parse_time_ns{UINT64_MAX};
 
             // State machine specific statistics
-            uint64_t state_transitions = 0;
-            uint64_t partial_messages_handled = 0;
-            uint64_t error_recoveries = 0;
-            uint64_t corrupted_data_skipped = 0;
-            uint64_t field_parse_errors = 0;
+            Counter state_transitions;
+            Counter partial_messages_handled;
+            Counter error_recoveries;
+            Counter corrupted_data_skipped;
+            Counter field_parse_errors;
+
+            // Prefilter outcomes (frames never decoded or allocated)
+            Counter prefilter_passed_through;
+            Counter prefilter_dropped;
+            std::array<Counter, FixMsgTypeUtils::MSG_TYPE_COUNT> prefiltered_by_type{};
 
             // Error pattern tracking
-            std::map<ParseState, uint64_t> errors_by_state;
-            std::map<ParseStatus, uint64_t> error_frequency;
+            std::array<Counter, PARSE_STATE_COUNT> errors_by_state{};
+            std::array<Counter, PARSE_STATUS_COUNT> error_frequency{};
 
-            double getAverageParseTimeNs() const
+            // Per-message parse latency (successful parses)
+            utils::LatencyHistogram parse_time_histogram;
+
+            // Point-in-time copy for reporting
+            struct Snapshot
             {
-                return messages_parsed > 0 ? static_cast<double>(total_parse_time_ns) / messages_parsed : 0.0;
-            }
+                uint64_t messages_parsed;
+                uint64_t parse_errors;
+                uint64_t checksum_errors;
+                uint64_t allocation_failures;
+                uint64_t field_parse_errors;
+                uint64_t total_parse_time_ns;
+                uint64_t max_parse_time_ns;
+                uint64_t min_parse_time_ns;
+                uint64_t state_transitions;
+                uint64_t partial_messages_handled;
+                uint64_t error_recoveries;
+                uint64_t corrupted_data_skipped;
+                uint64_t prefilter_passed_through;
+                uint64_t prefilter_dropped;
+                std::array<uint64_t, FixMsgTypeUtils::MSG_TYPE_COUNT> prefiltered_by_type;
+                std::array<uint64_t, PARSE_STATE_COUNT> errors_by_state;
+                std::array<uint64_t, PARSE_STATUS_COUNT> error_frequency;
+                utils::LatencyHistogram::Snapshot parse_time;
+
+                uint64_t p50ParseTimeNs() const { return parse_time.percentile(50.0); }
+                uint64_t p99ParseTimeNs() const { return parse_time.percentile(99.0); }
+                uint64_t p999ParseTimeNs() const { return parse_time.percentile(99.9); }
+            };
 
-            void reset()
+            double getAverageParseTimeNs() const
             {
-                messages_parsed = parse_errors = checksum_errors = allocation_failures = 0;
-                total_parse_time_ns = max_parse_time_ns = 0;
-                min_parse_time_ns = UINT64_MAX;
-                state_transitions = partial_messages_handled = error_recoveries = 0;
-                corrupted_data_skipped = field_parse_errors = 0;
-                errors_by_state.clear();
-                error_frequency.clear();
+                uint64_t parsed = messages_parsed;
+                return parsed > 0 ? static_cast<double>(total_parse_time_ns) / parsed : 0.0;
             }
+
+            uint64_t errorsInState(ParseState state) const { return errors_by_state[static_cast<size_t>(state)]; }
+            uint64_t errorCount(ParseStatus status) const { return error_frequency[static_cast<size_t>(status)]; }
+            uint64_t prefilteredCount(FixMsgType type) const { return prefiltered_by_type[static_cast<size_t>(type)]; }
+
+            Snapshot snapshot() const;
+
+            // Not synchronized with the writer - call from the parsing thread or while it is idle
+            void reset();
         };
 
         // State persistence for partial parsing across multiple calls
@@ -152,17 +212,11 @@ namespace fix_gateway::protocol
             size_t expected_body_length = 0;
             size_t current_message_length = 0;
 
-            // Message type
-            std::string msg_type;
+            // Message type (classified from the 35= peek during framing)
+            FixMsgType msg_type = FixMsgType::UNKNOWN;
 
-            // Current field being parsed
-            int current_field_tag = 0;
-            std::string partial_field_value;
-            size_t field_start_position = 0;
-
-            // Storage for parsed fields during incremental parsing
-            std::vector<std::pair<int, std::string>> parsed_fields;
-            size_t total_body_bytes_parsed = 0; // Track how much of the body we've parsed
+            // Incremental scan of the retained frame (fixed-size, resumable)
+            FixStreamScanner scanner;
 
             // Error recovery context
             size_t error_count_in_session = 0;
@@ -174,12 +228,8 @@ namespace fix_gateway::protocol
                 current_state = ParseState::IDLE;
                 buffer_position = message_start_pos = 0;
                 expected_body_length = current_message_length = 0;
-                msg_type.clear();
-                current_field_tag = 0;
-                partial_field_value.clear();
-                field_start_position = 0;
-                parsed_fields.clear();
-                total_body_bytes_parsed = 0;
+                msg_type = FixMsgType::UNKNOWN;
+                scanner.reset();
                 // Keep error tracking for circuit breaker logic
             }
         };
@@ -208,14 +258,32 @@ namespace fix_gateway::protocol
         // ENHANCED PARSING METHODS (State Machine Interface)
         // =================================================================
 
-        // Parse from raw network buffer with state machine - MAIN ENTRY POINT
+        // Parse from raw network buffer with state machine - MAIN ENTRY POINT.
+        // Returns the last message completed in buffer; earlier ones are released
+        // to the pool. Use parseBatch() when a read can carry several messages.
         ParseResult parse(const char *buffer, size_t length);
 
-        // Parse with explicit state continuation (for advanced use cases)
+        // Parse with explicit state continuation (for advanced use cases). buffer holds the
+        // retained bytes of one message from its first byte; each call scans only the bytes
+        // added since the last one and returns NeedMoreData (0 consumed) until it completes.
         ParseResult parseWithState(const char *buffer, size_t length, ParseContext &context);
 
-        // Parse multiple messages from buffer (streaming with state persistence)
-        std::vector<ParseResult> parseStream(const char *buffer, size_t length);
+        // Parse every complete message in the buffer into a caller-provided array (no allocation).
+        // Stops early when max_messages is reached: bytes_consumed < length and the caller
+        // resubmits the remainder. An incomplete tail is retained as the partial message
+        // (later calls resume scanning it where they left off, so each fragment is read
+        // once), as is everything left unparsed when the pool runs dry (AllocationFailed):
+        // it is retried ahead of the bytes passed to the next call. A tail longer than
+        // max message size plus header can never complete: it is dropped as MessageTooLarge
+        // and parsing resyncs at the next BeginString. While a partial message is held,
+        // only as much input as fits the partial buffer is taken per call.
+        BatchParseResult parseBatch(const char *buffer, size_t length,
+                                    FixMessage **out_messages, size_t max_messages);
+
+        // Same, decoding in place from a mirrored receive ring: complete frames are
+        // consumed from the ring and an incomplete tail stays there (no partial-buffer
+        // copy) unless it is too long to ever complete, which is dropped as above. Do not mix with the buffer overloads while a partial message is held.
+        BatchParseResult parseBatch(ReceiveRing &ring, FixMessage **out_messages, size_t max_messages);
 
         // =================================================================
         // TEMPLATE-OPTIMIZED PARSING (Phase 2C Enhancement)
@@ -233,6 +301,60 @@ namespace fix_gateway::protocol
         // dispatcher
         ParseResult parseIntelligent(const char *buffer, size_t length);
 
+        // =================================================================
+        // SCHEMA-TYPED PARSING (no FixMessage, no pool)
+        // =================================================================
+
+        // Decode one complete message at the start of buffer straight into a
+        // typed POD struct (see fix_typed_messages.h). parsed_message is nullptr
+        // unless a value or group is too large for the struct: that message is
+        // decoded into a pooled FixMessage instead (out is then unspecified).
+        // On NeedMoreData nothing is retained - resubmit the buffer once more
+        // bytes have arrived.
+        template <typename TypedMessage>
+        ParseResult parseTyped(const char *buffer, size_t length, TypedMessage &out)
+        {
+            using Schema = typename SchemaFor<TypedMessage>::type;
+            TypedDecodeResult decoded = TypedDecoder<Schema>::decode(buffer, length, out, validate_checksum_);
+
+            switch (decoded.status)
+            {
+            case TypedDecodeStatus::Ok:
+                stats_.messages_parsed++;
+                return {ParseStatus::Success, decoded.bytes_consumed, nullptr, "", ParseState::MESSAGE_COMPLETE, 0};
+            case TypedDecodeStatus::NeedMoreData:
+                return {ParseStatus::NeedMoreData, 0, nullptr, "", ParseState::IDLE, 0};
+            case TypedDecodeStatus::ChecksumError:
+                stats_.checksum_errors++;
+                return {ParseStatus::ChecksumError, 0, nullptr, "Checksum mismatch", ParseState::ERROR_RECOVERY, 0};
+            case TypedDecodeStatus::WrongMsgType:
+                stats_.parse_errors++;
+                return {ParseStatus::InvalidFormat, 0, nullptr, "MsgType does not match typed schema",
+                        ParseState::ERROR_RECOVERY, 0};
+            case TypedDecodeStatus::InvalidValue:
+                stats_.field_parse_errors++;
+                return {ParseStatus::FieldParseError, 0, nullptr,
+                        "Invalid value for tag " + std::to_string(decoded.error_tag), ParseState::ERROR_RECOVERY, 0};
+            case TypedDecodeStatus::MissingRequired:
+                stats_.field_parse_errors++;
+                return {ParseStatus::FieldParseError, 0, nullptr,
+                        "Missing required tag " + std::to_string(decoded.error_tag), ParseState::ERROR_RECOVERY, 0};
+            case TypedDecodeStatus::Overflow:
+            {
+                ParseResult generic = parseCompleteMessage(buffer, decoded.bytes_consumed);
+                if (generic.status == ParseStatus::Success)
+                    stats_.messages_parsed++;
+                else
+                    updateErrorStats(generic.status, generic.final_state);
+                return generic;
+            }
+            case TypedDecodeStatus::InvalidFormat:
+            default:
+                stats_.parse_errors++;
+                return {ParseStatus::InvalidFormat, 0, nullptr, "Malformed FIX framing", ParseState::ERROR_RECOVERY, 0};
+            }
+        }
+
         // =================================================================
         // STATE MACHINE MANAGEMENT
         // =================================================================
@@ -290,6 +412,16 @@ namespace fix_gateway::protocol
         // Set error recovery timeout (default: 1 second)
         void setErrorRecoveryTimeout(std::chrono::milliseconds timeout) { error_recovery_timeout_ = timeout; }
 
+        // Classify every framed message before decode (nullptr disables; not owned,
+        // must outlive the parser). Frames it does not Parse never touch the pool.
+        void setPrefilter(const MessagePrefilter *prefilter) { prefilter_ = prefilter; }
+        const MessagePrefilter *getPrefilter() const { return prefilter_; }
+
+        // Receives PassThrough frames (raw bytes, valid only during the call);
+        // without a handler they are counted and skipped like drops
+        using PassThroughHandler = std::function<void(FixMsgType, const char *, size_t)>;
+        void setPassThroughHandler(PassThroughHandler handler) { pass_through_handler_ = std::move(handler); }
+
         // =================================================================
         // PERFORMANCE MONITORING (Enhanced)
         // =================================================================
@@ -322,6 +454,14 @@ namespace fix_gateway::protocol
             return message_pool_;
         }
 
+        // Receive segment backing the buffer of the next parse()/parseBatch() call.
+        // Messages framed entirely inside it come out as views (fields reference
+        // the segment, no copies); clear it (nullptr) once the call returns.
+        void setReceiveSegment(ReceiveSegment *segment)
+        {
+            receive_segment_ = segment;
+        }
+
         // =================================================================
         // DEBUG AND DIAGNOSTICS
         // =================================================================
@@ -341,6 +481,7 @@ namespace fix_gateway::protocol
 
         // Complete message parsing (Stage 2) - public for testing
         ParseResult parseCompleteMessage(const char *buffer, size_t length);
+        ParseResult parseCompleteMessage(const char *buffer, size_t length, FixMsgType msg_type);
 
         // Message framing (Stage 1) - public for testing
         ParseResult findCompleteMessage(const char *buffer, size_t length, size_t &message_start, size_t &message_end);
@@ -360,20 +501,13 @@ namespace fix_gateway::protocol
         // STATE MACHINE IMPLEMENTATION METHODS
         // =================================================================
 
-        // State machine core processing
-        ParseResult processStateMachine(const char *buffer, size_t length, ParseContext &context);
+        // Build the message from a completed scan of buffer (field offsets, running checksum)
+        ParseResult completeScannedMessage(const char *buffer, ParseContext &context);
 
-        // Individual state handlers
-        ParseResult handleIdleState(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleParsingBeginString(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleParsingBodyLength(const char *buffer, size_t length, ParseContext &context);
+        // Mirror the scanner position into context.current_state
+        void syncScanState(ParseContext &context);
 
-        ParseResult handleParsingTag(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleExpectingEquals(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleParsingValue(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleExpectingSOH(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleParsingChecksum(const char *buffer, size_t length, ParseContext &context);
-        ParseResult handleMessageComplete(const char *buffer, size_t length, ParseContext &context);
+        // Error recovery handlers
         ParseResult handleErrorRecovery(const char *buffer, size_t length, ParseContext &context);
         ParseResult handleCorruptedSkip(const char *buffer, size_t length, ParseContext &context);
 
@@ -403,14 +537,7 @@ namespace fix_gateway::protocol
         // ENHANCED FIX PROTOCOL PARSING
         // =================================================================
 
-        // Field parsing with state awareness
-        ParseResult parseFieldTag(const char *buffer, size_t length, ParseContext &context);
-        ParseResult parseFieldValue(const char *buffer, size_t length, ParseContext &context);
-
         // Protocol validation enhanced
-        bool validateBeginString(const char *buffer, size_t length, size_t &consumed);
-        bool validateBodyLength(const char *buffer, size_t length, ParseContext &context, size_t &consumed);
-
         bool isValidFieldTag(int tag);
         bool isRequiredField(int tag);
 
@@ -424,12 +551,82 @@ namespace fix_gateway::protocol
         // Buffer management with state preservation
         void storePartialMessage(const char *buffer, size_t length);
 
+        // Release a message parse() decoded but will not return (superseded or
+        // followed by an error) and clear the pending flag
+        void releaseSuperseded(ParseResult &result, bool &pending)
+        {
+            if (pending && result.parsed_message)
+            {
+                message_pool_->deallocate(result.parsed_message);
+                result.parsed_message = nullptr;
+            }
+            pending = false;
+        }
+
         // =================================================================
         // CORE PARSING IMPLEMENTATION (Enhanced)
         // =================================================================
 
-        // Legacy methods enhanced with state machine support
-        bool extractFields(FixMessage *msg, const char *body_start, size_t body_length);
+        // Tokenize [body_start, body_end) in one SIMD sweep and store every field in msg.
+        // Error offsets are relative to message_start; msg is left to the caller to release.
+        // byte_sum (optional) receives the checksum byte sum of [message_start, body_end).
+        ParseResult extractFields(FixMessage *msg, const char *message_start,
+                                  const char *body_start, const char *body_end,
+                                  uint32_t *byte_sum = nullptr);
+
+        // Apply the prefilter to one framed message; true if it was passed
+        // through or dropped (the caller skips the frame without decoding it)
+        bool prefilterFrame(const char *frame, size_t length)
+        {
+            if (!prefilter_ || !prefilter_->isActive())
+            {
+                return false;
+            }
+            return applyPrefilter(frame, length);
+        }
+        bool applyPrefilter(const char *frame, size_t length);
+
+        // Frame and decode complete messages from buf into out_messages, filling in batch
+        // status/counts. Returns the bytes consumed; incomplete_tail is set when framing
+        // stopped at a message that needs more data (left for the caller to retain).
+        // A non-zero first_frame_length is the already-scanned length of the frame at buf.
+        size_t decodeFrames(const char *buf, size_t len, FixMessage **out_messages, size_t max_messages,
+                            BatchParseResult &batch, bool &incomplete_tail, size_t first_frame_length = 0);
+
+        // An incomplete tail at cursor longer than limit can never complete: report
+        // MessageTooLarge, skip to the next BeginString and decode on from there.
+        // Returns the new cursor; incomplete_tail then describes what is left.
+        size_t dropOversizedTail(const char *buf, size_t len, size_t cursor, size_t limit,
+                                 FixMessage **out_messages, size_t max_messages,
+                                 BatchParseResult &batch, bool &incomplete_tail);
+
+        // Per-message state for routing fields into repeating groups
+        struct GroupRouting
+        {
+            FixMsgType msg_type = FixMsgType::UNKNOWN;
+            bool has_groups = false; // msg_type defines at least one group
+        };
+
+        // Store one field as a group member, a group count or a plain field.
+        // False on a malformed group (bad count, misplaced or surplus entry).
+        bool storeField(FixMessage *msg, int tag, std::string_view value, bool as_view, GroupRouting &routing);
+
+        // =================================================================
+        // MESSAGE TYPE DISPATCH
+        // =================================================================
+
+        // Decoder for one complete message; indexed by FixMsgType so dispatch
+        // is a table load and an indirect call, never a MsgType string compare
+        using MessageDecoder = ParseResult (*)(StreamFixParser *parser, const char *buffer, size_t length);
+        static const std::array<MessageDecoder, FixMsgTypeUtils::MSG_TYPE_COUNT> DECODERS;
+
+        // Registered for every type without an OptimizedParser specialization
+        static ParseResult decodeGeneric(StreamFixParser *parser, const char *buffer, size_t length);
+
+        ParseResult dispatchMessage(FixMsgType msg_type, const char *buffer, size_t length)
+        {
+            return DECODERS[static_cast<size_t>(msg_type)](this, buffer, length);
+        }
 
         // =================================================================
         // FIX PROTOCOL HELPERS (Enhanced)
@@ -465,6 +662,13 @@ namespace fix_gateway::protocol
         // Message pool for allocation
         MessagePool<FixMessage> *message_pool_;
 
+        // Pinned receive buffer for view-mode messages (not owned)
+        ReceiveSegment *receive_segment_ = nullptr;
+
+        // Pre-decode classification (not owned)
+        const MessagePrefilter *prefilter_ = nullptr;
+        PassThroughHandler pass_through_handler_;
+
         // Enhanced configuration
         size_t max_message_size_;
         bool validate_checksum_;
@@ -475,9 +679,18 @@ namespace fix_gateway::protocol
 
         // Partial message handling (TCP fragmentation)
         static constexpr size_t PARTIAL_BUFFER_SIZE = 65536; // 64KB buffer
+        static constexpr size_t FRAME_OVERHEAD = 32;         // BeginString, BodyLength and trailer
+
+        // Longest incomplete frame worth holding: a body of max_message_size_ with
+        // its header and trailer. Anything longer can never complete.
+        size_t maxHeldFrame() const { return std::min(max_message_size_ + FRAME_OVERHEAD, PARTIAL_BUFFER_SIZE); }
         char partial_buffer_[PARTIAL_BUFFER_SIZE];
         size_t partial_buffer_size_;
 
+        // Scan state of the message held in partial_buffer_ by parseBatch(); reset
+        // whenever the held bytes start somewhere else
+        FixStreamScanner tail_scanner_;
+
         // Enhanced performance statistics
         mutable ParserStats stats_;
 
@@ -501,6 +714,13 @@ namespace fix_gateway::protocol
         // Quick message type extraction (without full parsing)
         std::string_view extractMsgType(const char *buffer, size_t length);
 
+        // Classify the MsgType field starting at field ("35=X<SOH>" or "35=XY<SOH>");
+        // UNKNOWN if the field is not tag 35 or the code is not a known type
+        FixMsgType classifyMsgTypeField(const char *field, size_t available);
+
+        // Classify a whole message by the 35= field that follows BeginString and BodyLength
+        FixMsgType peekMsgType(const char *buffer, size_t length);
+
         // Check if buffer contains complete FIX message
         bool isCompleteMessage(const char *buffer, size_t length);
 
@@ -509,6 +729,26 @@ namespace fix_gateway::protocol
 
         // Validate FIX checksum
         bool validateChecksum(const char *buffer, size_t length);
+
+        // Validate FIX BodyLength against the trailer position
+        bool validateBodyLength(const char *buffer, size_t length);
+
+        // Body end of a framed message. CheckSum is the frame's last TRAILER_LENGTH
+        // bytes whichever BodyLength reading the framer matched, so decoders take it
+        // from the frame end. nullptr unless "10=XXX<SOH>" ends the frame after body_start.
+        inline const char *frameBodyEnd(const char *frame, size_t length, const char *body_start)
+        {
+            if (length < FixChecksum::TRAILER_LENGTH)
+            {
+                return nullptr;
+            }
+            const char *body_end = frame + length - FixChecksum::TRAILER_LENGTH;
+            if (body_end < body_start || std::memcmp(body_end, "10=", 3) != 0 || frame[length - 1] != '\001')
+            {
+                return nullptr;
+            }
+            return body_end;
+        }
     }
 
     // =================================================================
@@ -593,55 +833,23 @@ namespace fix_gateway::protocol
                                                          FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;                        // Start of message body
-            const char *body_end = body_length_end + 1 + body_length; // Calculate end based on parsed body length
-
-            // Parse all fields in EXECUTION_REPORT
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                // =================================================================
-                // FAST FIELD EXTRACTION: Parse tag=value pairs
-                // =================================================================
-
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(current_ptr - buffer), nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Parse field tag
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError,
-                            static_cast<size_t>(tag_start - buffer), nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Find field value (between '=' and SOH)
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(value_start - buffer), nullptr,
-                            "Missing SOH after field " + std::to_string(field_tag),
-                            StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Extract field value (zero-copy using string_view)
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                // Move to next field
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -663,7 +871,7 @@ namespace fix_gateway::protocol
 
             if (parser->isChecksumValidationEnabled())
             {
-                const char *checksum_start = body_end; // Checksum starts right after body ends
+                const char *checksum_start = body_end;
 
                 if (checksum_start[0] != '1' || checksum_start[1] != '0' || checksum_start[2] != '=')
                 {
@@ -673,20 +881,15 @@ namespace fix_gateway::protocol
                 }
 
                 // Extract checksum value
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
                 // Calculate and validate checksum
                 // FIX checksum includes all bytes up to (but not including) the checksum field
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, static_cast<size_t>(body_end - buffer), nullptr,
@@ -696,8 +899,8 @@ namespace fix_gateway::protocol
             else
             {
                 // Still store checksum field even if not validating
-                const char *checksum_start = body_end; // Checksum starts right after body ends
-                std::string checksum_value(checksum_start + 3, 3);
+                const char *checksum_start = body_end;
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
@@ -712,7 +915,7 @@ namespace fix_gateway::protocol
             // parser->updateParseStats(StreamFixParser::ParseStatus::Success, parse_time);
 
             // Calculate total message length: header + body + checksum
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7; // +7 for "10=XXX\001"
+            size_t total_message_length = length; // The whole frame, trailer included
 
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "EXECUTION_REPORT parsed via optimized template",
@@ -798,59 +1001,23 @@ namespace fix_gateway::protocol
                                                          fix_gateway::utils::FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;                        // Start of message body
-            const char *body_end = body_length_end + 1 + body_length; // Calculate end based on parsed body length
-
-            // HEARTBEAT typically only has session-level fields (no body content)
-            // Parse any fields that might be present
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                // =================================================================
-                // FAST FIELD EXTRACTION: Parse tag=value pairs
-                // =================================================================
-
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(current_ptr - buffer), nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Parse field tag
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError,
-                            static_cast<size_t>(tag_start - buffer), nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Find field value (between '=' and SOH)
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(value_start - buffer), nullptr,
-                            "Missing SOH after field " + std::to_string(field_tag),
-                            StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Extract field value (zero-copy using string_view)
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
-
-                // HEARTBEAT can have session fields like SenderCompID, TargetCompID, etc.
-                // No specific validation needed for HEARTBEAT fields
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                // Move to next field
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -859,7 +1026,7 @@ namespace fix_gateway::protocol
 
             if (parser->isChecksumValidationEnabled())
             {
-                const char *checksum_start = body_end; // Checksum starts right after body ends
+                const char *checksum_start = body_end;
 
                 if (checksum_start[0] != '1' || checksum_start[1] != '0' || checksum_start[2] != '=')
                 {
@@ -869,20 +1036,15 @@ namespace fix_gateway::protocol
                 }
 
                 // Extract checksum value
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
                 // Calculate and validate checksum
                 // FIX checksum includes all bytes up to (but not including) the checksum field
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, static_cast<size_t>(body_end - buffer), nullptr,
@@ -892,8 +1054,8 @@ namespace fix_gateway::protocol
             else
             {
                 // Still store checksum field even if not validating
-                const char *checksum_start = body_end; // Checksum starts right after body ends
-                std::string checksum_value(checksum_start + 3, 3);
+                const char *checksum_start = body_end;
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
@@ -908,7 +1070,7 @@ namespace fix_gateway::protocol
             // parser->updateParseStats(StreamFixParser::ParseStatus::Success, parse_time);
 
             // Calculate total message length: header + body + checksum
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7; // +7 for "10=XXX\001"
+            size_t total_message_length = length; // The whole frame, trailer included
 
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "HEARTBEAT parsed via optimized template",
@@ -995,55 +1157,23 @@ namespace fix_gateway::protocol
                                                          FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;                        // Start of message body
-            const char *body_end = body_length_end + 1 + body_length; // Calculate end based on parsed body length
-
-            // Parse all fields in ORDER_CANCEL_REJECT
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                // =================================================================
-                // FAST FIELD EXTRACTION: Parse tag=value pairs
-                // =================================================================
-
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(current_ptr - buffer), nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Parse field tag
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError,
-                            static_cast<size_t>(tag_start - buffer), nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Find field value (between '=' and SOH)
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(value_start - buffer), nullptr,
-                            "Missing SOH after field " + std::to_string(field_tag),
-                            StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Extract field value (zero-copy using string_view)
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                // Move to next field
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -1065,7 +1195,7 @@ namespace fix_gateway::protocol
 
             if (parser->isChecksumValidationEnabled())
             {
-                const char *checksum_start = body_end; // Checksum starts right after body ends
+                const char *checksum_start = body_end;
 
                 if (checksum_start[0] != '1' || checksum_start[1] != '0' || checksum_start[2] != '=')
                 {
@@ -1075,20 +1205,15 @@ namespace fix_gateway::protocol
                 }
 
                 // Extract checksum value
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
                 // Calculate and validate checksum
                 // FIX checksum includes all bytes up to (but not including) the checksum field
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, static_cast<size_t>(body_end - buffer), nullptr,
@@ -1098,8 +1223,8 @@ namespace fix_gateway::protocol
             else
             {
                 // Still store checksum field even if not validating
-                const char *checksum_start = body_end; // Checksum starts right after body ends
-                std::string checksum_value(checksum_start + 3, 3);
+                const char *checksum_start = body_end;
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
@@ -1108,7 +1233,7 @@ namespace fix_gateway::protocol
             // =================================================================
 
             // Calculate total message length: header + body + checksum
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7; // +7 for "10=XXX\001"
+            size_t total_message_length = length; // The whole frame, trailer included
 
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "ORDER_CANCEL_REJECT parsed via optimized template",
@@ -1191,55 +1316,23 @@ namespace fix_gateway::protocol
                                                          FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;                        // Start of message body
-            const char *body_end = body_length_end + 1 + body_length; // Calculate end based on parsed body length
-
-            // Parse all fields in REJECT
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                // =================================================================
-                // FAST FIELD EXTRACTION: Parse tag=value pairs
-                // =================================================================
-
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(current_ptr - buffer), nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Parse field tag
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError,
-                            static_cast<size_t>(tag_start - buffer), nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Find field value (between '=' and SOH)
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat,
-                            static_cast<size_t>(value_start - buffer), nullptr,
-                            "Missing SOH after field " + std::to_string(field_tag),
-                            StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                // Extract field value (zero-copy using string_view)
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                // Move to next field
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -1248,7 +1341,7 @@ namespace fix_gateway::protocol
 
             if (parser->isChecksumValidationEnabled())
             {
-                const char *checksum_start = body_end; // Checksum starts right after body ends
+                const char *checksum_start = body_end;
 
                 if (checksum_start[0] != '1' || checksum_start[1] != '0' || checksum_start[2] != '=')
                 {
@@ -1258,19 +1351,14 @@ namespace fix_gateway::protocol
                 }
 
                 // Extract checksum value
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
                 // Calculate and validate checksum
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, static_cast<size_t>(body_end - buffer), nullptr,
@@ -1281,7 +1369,7 @@ namespace fix_gateway::protocol
             {
                 // Still store checksum field even if not validating
                 const char *checksum_start = body_end;
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
@@ -1289,7 +1377,7 @@ namespace fix_gateway::protocol
             // SUCCESS: Return parsed message
             // =================================================================
 
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7; // +7 for "10=XXX\001"
+            size_t total_message_length = length; // The whole frame, trailer included
 
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "REJECT parsed via optimized template",
@@ -1360,40 +1448,23 @@ namespace fix_gateway::protocol
                                                          FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;
-            const char *body_end = body_length_end + 1 + body_length;
-
-            // Parse all fields
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError, 0, nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
-                            "Missing SOH after field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -1410,18 +1481,13 @@ namespace fix_gateway::protocol
                             "Invalid checksum format", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
                 }
 
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, 0, nullptr,
@@ -1431,11 +1497,11 @@ namespace fix_gateway::protocol
             else
             {
                 const char *checksum_start = body_end;
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7;
+            size_t total_message_length = length; // The whole frame, trailer included
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "TEST_REQUEST parsed via optimized template", StreamFixParser::ParseState::IDLE, 0};
         }
@@ -1504,40 +1570,23 @@ namespace fix_gateway::protocol
                                                          FastStringConversion::int_to_string(body_length)));
 
             current_ptr = body_length_end + 1;
-            const char *body_end = body_length_end + 1 + body_length;
-
-            // Parse all fields
-            while (current_ptr < body_end)
+            const char *body_end = StreamParserUtils::frameBodyEnd(buffer, length, current_ptr);
+            if (!body_end)
             {
-                const char *tag_start = current_ptr;
-                const char *equals_ptr = static_cast<const char *>(memchr(current_ptr, '=', body_end - current_ptr));
-                if (!equals_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
-                            "Missing '=' in field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                int field_tag = 0;
-                if (!parser->parseInteger(tag_start, equals_ptr - tag_start, field_tag))
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::FieldParseError, 0, nullptr,
-                            "Invalid field tag", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
-
-                const char *value_start = equals_ptr + 1;
-                const char *soh_ptr = static_cast<const char *>(memchr(value_start, '\001', body_end - value_start));
-                if (!soh_ptr)
-                {
-                    parser->getMessagePool()->deallocate(message);
-                    return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
-                            "Missing SOH after field", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
-                }
+                parser->getMessagePool()->deallocate(message);
+                return {StreamFixParser::ParseStatus::InvalidFormat, 0, nullptr,
+                        "CheckSum is not the last field of the frame", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
+            }
 
-                std::string_view field_value(value_start, soh_ptr - value_start);
-                message->setField(field_tag, field_value);
-                current_ptr = soh_ptr + 1;
+            // Single-pass tokenization of the body (tag/value offset table), with the
+            // checksum byte sum folded into the same sweep
+            uint32_t byte_sum = 0;
+            StreamFixParser::ParseResult fields_result = parser->extractFields(
+                message, buffer, current_ptr, body_end, parser->isChecksumValidationEnabled() ? &byte_sum : nullptr);
+            if (fields_result.status != StreamFixParser::ParseStatus::Success)
+            {
+                parser->getMessagePool()->deallocate(message);
+                return fields_result;
             }
 
             // =================================================================
@@ -1554,18 +1603,13 @@ namespace fix_gateway::protocol
                             "Invalid checksum format", StreamFixParser::ParseState::ERROR_RECOVERY, 0};
                 }
 
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
 
-                uint8_t calculated_checksum = 0;
-                for (size_t i = 0; i < static_cast<size_t>(body_end - buffer); ++i)
-                {
-                    calculated_checksum += static_cast<uint8_t>(buffer[i]);
-                }
-                calculated_checksum %= 256;
-
-                int received_checksum = std::stoi(checksum_value);
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
+                uint8_t calculated_checksum = static_cast<uint8_t>(byte_sum);
+                uint8_t received_checksum = 0;
+                if (!FixChecksum::parse(checksum_value.data(), received_checksum) ||
+                    calculated_checksum != received_checksum)
                 {
                     parser->getMessagePool()->deallocate(message);
                     return {StreamFixParser::ParseStatus::ChecksumError, 0, nullptr,
@@ -1575,11 +1619,11 @@ namespace fix_gateway::protocol
             else
             {
                 const char *checksum_start = body_end;
-                std::string checksum_value(checksum_start + 3, 3);
+                std::string_view checksum_value(checksum_start + 3, 3);
                 message->setField(FixFields::CheckSum, checksum_value);
             }
 
-            size_t total_message_length = static_cast<size_t>(body_end - buffer) + 7;
+            size_t total_message_length = length; // The whole frame, trailer included
             return {StreamFixParser::ParseStatus::Success, total_message_length, message,
                     "RESEND_REQUEST parsed via optimized template", StreamFixParser::ParseState::IDLE, 0};
         }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <cstdio>
@@ -48,8 +50,9 @@ namespace fix_gateway::utils
          * @param precision Number of decimal places (default: 2)
          * @return string_view pointing to thread-local buffer
          * 
-         * Performance: ~20-30ns vs ~500-1000ns for ostringstream
-         * Uses snprintf for consistent formatting
+         * Scales and rounds (half away from zero) to a fixed-point integer and
+         * formats it with fixed_to_chars; snprintf is only used for magnitudes
+         * that do not fit int64 at the requested precision.
          */
         static std::string_view double_to_string(double value, int precision = 2);
         
@@ -62,6 +65,29 @@ namespace fix_gateway::utils
          */
         static std::string_view double_to_string_auto(double value);
         
+        /**
+         * @brief Format a fixed-point value mantissa / 10^scale
+         * @param mantissa Scaled integer value
+         * @param scale Digits after the decimal point (0-18)
+         * @param out Destination, at least FIXED_BUFFER_SIZE bytes (not null-terminated)
+         * @return Number of characters written
+         * 
+         * Branch-light: two digits per step from a 200-byte lookup table,
+         * no division by runtime values and no locale handling
+         */
+        static size_t fixed_to_chars(int64_t mantissa, int scale, char *out);
+
+        /**
+         * @brief Fixed-point value to string
+         * @return string_view pointing to thread-local buffer
+         */
+        static std::string_view fixed_to_string(int64_t mantissa, int scale);
+
+        /// Worst case fixed_to_chars output: "-" + 19 digits + "." (INT64_MIN at
+        /// any scale) or "-0." + 18 digits (scale 18). The one buffer contract
+        /// for formatted fixed-point values; FixDecimal::MAX_TEXT_LENGTH is this.
+        static constexpr size_t FIXED_BUFFER_SIZE = 21;
+
         /**
          * @brief Get permanent string copy (allocates memory)
          * @param view string_view from fast conversion
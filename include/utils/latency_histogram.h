@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fix_gateway::utils
+{
+    /**
+     * @brief Counter with one writing thread and any number of readers
+     *
+     * The owner updates with a relaxed load + store rather than a locked
+     * read-modify-write, so an increment costs the same as on a plain
+     * uint64_t. Readers on other threads always see a whole 64-bit value.
+     * Copying reads the current value (used when the owner is moved).
+     */
+    class SingleWriterCounter
+    {
+    public:
+        SingleWriterCounter() = default;
+        explicit SingleWriterCounter(uint64_t initial) : value_(initial) {}
+
+        SingleWriterCounter(const SingleWriterCounter &other) : value_(other.get()) {}
+        SingleWriterCounter &operator=(const SingleWriterCounter &other)
+        {
+            set(other.get());
+            return *this;
+        }
+
+        // Writer side
+        void add(uint64_t delta) noexcept
+        {
+            value_.store(value_.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+        void set(uint64_t value) noexcept { value_.store(value, std::memory_order_relaxed); }
+
+        SingleWriterCounter &operator++() noexcept
+        {
+            add(1);
+            return *this;
+        }
+        void operator++(int) noexcept { add(1); }
+        SingleWriterCounter &operator+=(uint64_t delta) noexcept
+        {
+            add(delta);
+            return *this;
+        }
+
+        // Any thread
+        uint64_t get() const noexcept { return value_.load(std::memory_order_relaxed); }
+        operator uint64_t() const noexcept { return get(); }
+
+    private:
+        std::atomic<uint64_t> value_{0};
+    };
+
+    /**
+     * @brief HDR-style log-linear latency histogram (single writer)
+     *
+     * Every power of two is split into SUB_BUCKET_COUNT linear buckets, so
+     * any recorded value is reported within 1/SUB_BUCKET_COUNT (~3%) of its
+     * true value across the whole range. Recording is a bit scan, a shift
+     * and one relaxed counter update - no allocation, no locks. Another
+     * thread takes a snapshot() to compute percentiles.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr unsigned SUB_BUCKET_BITS = 5;
+        static constexpr size_t SUB_BUCKET_COUNT = size_t{1} << SUB_BUCKET_BITS;
+
+        // Values of 2^MAX_MAGNITUDE (~18 minutes in ns) and above share the top bucket
+        static constexpr unsigned MAX_MAGNITUDE = 40;
+        static constexpr size_t BUCKET_COUNT = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        struct Snapshot
+        {
+            std::array<uint64_t, BUCKET_COUNT> counts{};
+            uint64_t total_count = 0;
+
+            // Highest value equivalent to the bucket holding the given percentile
+            // (0-100); 0 when nothing has been recorded
+            uint64_t percentile(double percent) const
+            {
+                if (total_count == 0)
+                    return 0;
+
+                double clamped = percent < 0.0 ? 0.0 : (percent > 100.0 ? 100.0 : percent);
+                uint64_t rank = static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(total_count) + 0.5);
+                if (rank == 0)
+                    rank = 1;
+
+                uint64_t seen = 0;
+                for (size_t i = 0; i < BUCKET_COUNT; ++i)
+                {
+                    seen += counts[i];
+                    if (seen >= rank)
+                        return highestEquivalentValue(i);
+                }
+                return highestEquivalentValue(BUCKET_COUNT - 1);
+            }
+        };
+
+        static size_t bucketIndex(uint64_t value)
+        {
+            if (value < SUB_BUCKET_COUNT)
+                return static_cast<size_t>(value);
+
+            unsigned magnitude = 63u - static_cast<unsigned>(__builtin_clzll(value));
+            if (magnitude >= MAX_MAGNITUDE)
+                return BUCKET_COUNT - 1;
+
+            size_t group = magnitude - SUB_BUCKET_BITS + 1;
+            size_t sub = static_cast<size_t>(value >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+            return group * SUB_BUCKET_COUNT + sub;
+        }
+
+        static uint64_t lowestEquivalentValue(size_t index)
+        {
+            size_t group = index / SUB_BUCKET_COUNT;
+            uint64_t sub = index % SUB_BUCKET_COUNT;
+            return group == 0 ? sub : (SUB_BUCKET_COUNT + sub) << (group - 1);
+        }
+
+        static uint64_t highestEquivalentValue(size_t index)
+        {
+            size_t group = index / SUB_BUCKET_COUNT;
+            uint64_t width = group == 0 ? 1 : uint64_t{1} << (group - 1);
+            return lowestEquivalentValue(index) + width - 1;
+        }
+
+        // Writer side
+        void record(uint64_t value) noexcept { counts_[bucketIndex(value)].add(1); }
+
+        // Not synchronized with record() - call from the writer or while it is idle
+        void reset() noexcept
+        {
+            for (auto &count : counts_)
+                count.set(0);
+        }
+
+        // Any thread; each bucket is read whole, records racing the copy land in
+        // this snapshot or the next one
+        Snapshot snapshot() const
+        {
+            Snapshot snap;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                snap.counts[i] = counts_[i].get();
+                snap.total_count += snap.counts[i];
+            }
+            return snap;
+        }
+
+    private:
+        std::array<SingleWriterCounter, BUCKET_COUNT> counts_{};
+    };
+
+} // namespace fix_gateway::utils
@@ -2,9 +2,13 @@
 
 #include "common/message.h"
 #include "utils/performance_counters.h"
+#include "utils/latency_histogram.h"
+#include "utils/wait_strategy.h"
 
+#include <algorithm>
 #include <atomic>
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -20,8 +24,32 @@ namespace fix_gateway::utils
     using MessagePtr = fix_gateway::common::MessagePtr;
     using RawMessagePtr = fix_gateway::common::Message *;
 
+    // Which sides of a queue may be used from several threads at once
+    enum class QueueMode : uint8_t
+    {
+        SPSC, // One producer thread, one consumer thread
+        MPSC, // Any producers, one consumer (fan-in)
+        MPMC  // Any producers, any consumers
+    };
+
     // Simple lock-free queue using atomic operations and ring buffer
     // Optimized for trading systems - no priority logic, just fast FIFO
+    //
+    // SPSC: a Lamport ring. Each side keeps a private copy of the other side's
+    // index and reloads it only when the copy says full (producer) or empty
+    // (consumer), so a steady stream costs no cross-core index read per
+    // message. The bulk calls move a whole range with one index store.
+    //
+    // MPSC / MPMC: a bounded Vyukov ring. Every cell carries a sequence number
+    // that says whether it is free for position p (== p) or holds the message
+    // of position p (== p + 1). Producers claim positions with a CAS on tail_
+    // (consumers on head_; a single MPSC consumer just stores it), then fill or
+    // empty their cells and publish each with a release store of its sequence.
+    // Bulk calls claim a whole run of ready cells with one CAS.
+    //
+    // An idle consumer waits with popWait()/popBulkWait() under the queue's
+    // WaitStrategy (spin, yield or futex park); every successful push calls
+    // its notify(), which only enters the kernel while a consumer is parked.
     template <typename T>
     class LockFreeQueue
     {
@@ -29,7 +57,8 @@ namespace fix_gateway::utils
         // Constructor
         explicit LockFreeQueue(
             size_t max_size = 2048, // Power of 2 for efficient modulo
-            const std::string &queue_name = "lockfree_queue");
+            const std::string &queue_name = "lockfree_queue",
+            QueueMode mode = QueueMode::SPSC);
 
         // Destructor
         ~LockFreeQueue() = default;
@@ -38,6 +67,32 @@ namespace fix_gateway::utils
         bool push(T message);
         bool tryPop(T &message);
 
+        // Bulk operations: copy up to count messages in FIFO order and publish
+        // them with a single release store. Return how many were moved; on a
+        // short push the rest stay with the caller (and count as dropped).
+        size_t pushBulk(const T *messages, size_t count);
+        size_t popBulk(T *out, size_t max);
+
+        // tryPop / popBulk that run one round of the wait strategy when the
+        // queue is empty. False / 0 after the round or on shutdown, so the
+        // caller checks its own stop flag and calls again.
+        bool popWait(T &message);
+        size_t popBulkWait(T *out, size_t max);
+
+        // Consumer wait policy; set before the consumer thread starts
+        void setWaitStrategy(const WaitConfig &config) { wait_->configure(config); }
+        const WaitConfig &getWaitConfig() const { return wait_->config(); }
+        const WaitStrategy &getWaitStrategy() const { return *wait_; }
+
+        // Notify (and wait on) a strategy shared with other queues, so one
+        // consumer draining several queues can park until any of them gets a
+        // push; nullptr goes back to the queue's own. Switch only while no
+        // producer or consumer runs; the shared one must outlive that use.
+        void shareWaitStrategy(WaitStrategy *shared) { wait_ = shared ? shared : &own_wait_; }
+
+        // End the current wait round of parked consumers (stop requests)
+        void wakeConsumers() { wait_->wakeAll(); }
+
         // Queue management
         void shutdown();
         bool isShutdown() const;
@@ -46,8 +101,10 @@ namespace fix_gateway::utils
         size_t size() const;
         bool empty() const;
         size_t capacity() const;
+        QueueMode mode() const { return mode_; }
 
-        // Performance metrics
+        // Performance metrics (updated once per call; single-writer counters on
+        // the single-threaded sides, shared atomics on the multi-threaded ones)
         uint64_t getTotalPushed() const;
         uint64_t getTotalPopped() const;
         uint64_t getTotalDropped() const;
@@ -59,21 +116,42 @@ namespace fix_gateway::utils
         // Atomic ring buffer implementation
         static constexpr size_t CACHE_LINE_SIZE = 64;
 
-        // Align to cache line to prevent false sharing
+        // Consumer line: its index, its copy of tail_ and its counter
         alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+        size_t cached_tail_ = 0;
+        SingleWriterCounter pop_count_;
+
+        // Producer line: its index, its copy of head_ and its counters
         alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+        size_t cached_head_ = 0;
+        SingleWriterCounter push_count_;
+        SingleWriterCounter drop_count_;
+
+        // Counters of the multi-threaded sides
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> shared_push_count_{0};
+        std::atomic<uint64_t> shared_drop_count_{0};
+        std::atomic<uint64_t> shared_pop_count_{0};
+
+        // Consumer wait policy and parking state (own cache lines); wait_
+        // points at own_wait_ unless the queue shares another strategy
+        WaitStrategy own_wait_;
+        WaitStrategy *wait_ = &own_wait_;
 
         size_t capacity_;
         size_t mask_; // capacity - 1 for fast modulo (requires power of 2)
+        QueueMode mode_;
 
         // Message storage (aligned to prevent false sharing)
         // For non-trivially copyable types like shared_ptr, store them normally
-        alignas(CACHE_LINE_SIZE) std::unique_ptr<T[]> messages_;
+        alignas(CACHE_LINE_SIZE) std::unique_ptr<T[]> messages_; // SPSC
 
-        // Statistics
-        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> push_count_{0};
-        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> pop_count_{0};
-        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> drop_count_{0};
+        // Vyukov cells (MPSC / MPMC); head_ and tail_ are unmasked positions
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+        std::unique_ptr<Cell[]> cells_;
 
         // Configuration
         std::string queue_name_;
@@ -83,6 +161,19 @@ namespace fix_gateway::utils
 
         // Helper methods
         size_t nextPowerOfTwo(size_t n) const noexcept;
+
+        // Free slots seen by the producer / filled slots seen by the consumer,
+        // reloading the peer index only when the cached one shows fewer than wanted
+        size_t producerSpace(size_t tail, size_t wanted);
+        size_t consumerAvailable(size_t head, size_t wanted);
+
+        // Consumer-side check used as the wait predicate (may be stale-true
+        // under MPMC; the following pop then simply comes back empty)
+        bool hasMessage();
+
+        // Vyukov ring paths (MPSC / MPMC)
+        size_t enqueueCells(const T *messages, size_t count);
+        size_t dequeueCells(T *out, size_t max);
     };
 
     // Type aliases for convenience
@@ -91,9 +182,19 @@ namespace fix_gateway::utils
 
     // Template implementation for LockFreeQueue (header-only)
     template <typename T>
-    LockFreeQueue<T>::LockFreeQueue(size_t max_size, const std::string &queue_name)
-        : capacity_(nextPowerOfTwo(max_size)), mask_(capacity_ - 1), queue_name_(queue_name), is_shutdown_(false)
+    LockFreeQueue<T>::LockFreeQueue(size_t max_size, const std::string &queue_name, QueueMode mode)
+        : capacity_(nextPowerOfTwo(max_size)), mask_(capacity_ - 1), mode_(mode), queue_name_(queue_name), is_shutdown_(false)
     {
+        if (mode_ != QueueMode::SPSC)
+        {
+            cells_ = std::make_unique<Cell[]>(capacity_);
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            return;
+        }
+
         messages_ = std::make_unique<T[]>(capacity_);
         // Initialize with default values
         for (size_t i = 0; i < capacity_; ++i)
@@ -102,24 +203,53 @@ namespace fix_gateway::utils
         }
     }
 
+    template <typename T>
+    size_t LockFreeQueue<T>::producerSpace(size_t tail, size_t wanted)
+    {
+        // One slot stays empty to tell full from empty
+        size_t space = (cached_head_ - tail - 1) & mask_;
+        if (space < wanted)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            space = (cached_head_ - tail - 1) & mask_;
+        }
+        return space;
+    }
+
+    template <typename T>
+    size_t LockFreeQueue<T>::consumerAvailable(size_t head, size_t wanted)
+    {
+        size_t available = (cached_tail_ - head) & mask_;
+        if (available < wanted)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = (cached_tail_ - head) & mask_;
+        }
+        return available;
+    }
+
     template <typename T>
     bool LockFreeQueue<T>::push(T message)
     {
         if (is_shutdown_.load(std::memory_order_acquire))
             return false;
 
-        size_t current_tail = tail_.load(std::memory_order_relaxed);
-        size_t next_tail = (current_tail + 1) & mask_;
+        if (mode_ != QueueMode::SPSC)
+        {
+            return enqueueCells(&message, 1) == 1;
+        }
 
-        if (next_tail == head_.load(std::memory_order_acquire))
+        size_t current_tail = tail_.load(std::memory_order_relaxed);
+        if (producerSpace(current_tail, 1) == 0)
         {
-            drop_count_.fetch_add(1, std::memory_order_relaxed);
+            drop_count_++;
             return false; // Queue full
         }
 
         messages_[current_tail] = message;
-        tail_.store(next_tail, std::memory_order_release);
-        push_count_.fetch_add(1, std::memory_order_relaxed);
+        tail_.store((current_tail + 1) & mask_, std::memory_order_release);
+        push_count_++;
+        wait_->notify();
         return true;
     }
 
@@ -132,9 +262,18 @@ namespace fix_gateway::utils
             return false;
         }
 
-        size_t current_head = head_.load(std::memory_order_relaxed);
+        if (mode_ != QueueMode::SPSC)
+        {
+            if (dequeueCells(&message, 1) == 0)
+            {
+                message = T{};
+                return false; // Queue empty
+            }
+            return true;
+        }
 
-        if (current_head == tail_.load(std::memory_order_acquire))
+        size_t current_head = head_.load(std::memory_order_relaxed);
+        if (consumerAvailable(current_head, 1) == 0)
         {
             message = T{};
             return false; // Queue empty
@@ -142,14 +281,223 @@ namespace fix_gateway::utils
 
         message = messages_[current_head];
         head_.store((current_head + 1) & mask_, std::memory_order_release);
-        pop_count_.fetch_add(1, std::memory_order_relaxed);
+        pop_count_++;
         return true;
     }
 
+    template <typename T>
+    size_t LockFreeQueue<T>::pushBulk(const T *messages, size_t count)
+    {
+        if (count == 0 || is_shutdown_.load(std::memory_order_acquire))
+            return 0;
+
+        if (mode_ != QueueMode::SPSC)
+            return enqueueCells(messages, count);
+
+        size_t current_tail = tail_.load(std::memory_order_relaxed);
+        size_t pushed = std::min(count, producerSpace(current_tail, count));
+
+        // The range may wrap: copy up to the end of the ring, then from the start
+        size_t first = std::min(pushed, capacity_ - current_tail);
+        std::copy(messages, messages + first, &messages_[current_tail]);
+        std::copy(messages + first, messages + pushed, &messages_[0]);
+
+        if (pushed > 0)
+        {
+            tail_.store((current_tail + pushed) & mask_, std::memory_order_release);
+            push_count_ += pushed;
+            wait_->notify();
+        }
+        if (pushed < count)
+        {
+            drop_count_ += count - pushed;
+        }
+        return pushed;
+    }
+
+    template <typename T>
+    size_t LockFreeQueue<T>::popBulk(T *out, size_t max)
+    {
+        if (max == 0 || is_shutdown_.load(std::memory_order_acquire))
+            return 0;
+
+        if (mode_ != QueueMode::SPSC)
+            return dequeueCells(out, max);
+
+        size_t current_head = head_.load(std::memory_order_relaxed);
+        size_t popped = std::min(max, consumerAvailable(current_head, max));
+        if (popped == 0)
+            return 0; // Queue empty
+
+        size_t first = std::min(popped, capacity_ - current_head);
+        std::copy(&messages_[current_head], &messages_[current_head] + first, out);
+        std::copy(&messages_[0], &messages_[0] + (popped - first), out + first);
+
+        head_.store((current_head + popped) & mask_, std::memory_order_release);
+        pop_count_ += popped;
+        return popped;
+    }
+
+    template <typename T>
+    bool LockFreeQueue<T>::hasMessage()
+    {
+        if (mode_ != QueueMode::SPSC)
+        {
+            size_t pos = head_.load(std::memory_order_relaxed);
+            size_t sequence = cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+            return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) >= 0;
+        }
+        return consumerAvailable(head_.load(std::memory_order_relaxed), 1) > 0;
+    }
+
+    template <typename T>
+    bool LockFreeQueue<T>::popWait(T &message)
+    {
+        if (tryPop(message))
+        {
+            return true;
+        }
+        wait_->waitFor([this]()
+                       { return hasMessage() || is_shutdown_.load(std::memory_order_acquire); });
+        return tryPop(message);
+    }
+
+    template <typename T>
+    size_t LockFreeQueue<T>::popBulkWait(T *out, size_t max)
+    {
+        size_t popped = popBulk(out, max);
+        if (popped > 0 || max == 0)
+        {
+            return popped;
+        }
+        wait_->waitFor([this]()
+                       { return hasMessage() || is_shutdown_.load(std::memory_order_acquire); });
+        return popBulk(out, max);
+    }
+
+    template <typename T>
+    size_t LockFreeQueue<T>::enqueueCells(const T *messages, size_t count)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        size_t claimed = 0;
+        while (true)
+        {
+            // Run of cells free for positions pos, pos + 1, ...
+            bool stale = false;
+            claimed = 0;
+            while (claimed < count)
+            {
+                size_t sequence = cells_[(pos + claimed) & mask_].sequence.load(std::memory_order_acquire);
+                intptr_t dif = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + claimed);
+                if (dif != 0)
+                {
+                    stale = dif > 0; // Another producer took pos already; < 0 means full
+                    break;
+                }
+                ++claimed;
+            }
+
+            if (claimed == 0)
+            {
+                if (!stale)
+                {
+                    break; // Queue full
+                }
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+            else if (tail_.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < claimed; ++i)
+        {
+            Cell &cell = cells_[(pos + i) & mask_];
+            cell.value = messages[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+
+        if (claimed > 0)
+        {
+            shared_push_count_.fetch_add(claimed, std::memory_order_relaxed);
+            wait_->notify();
+        }
+        if (claimed < count)
+        {
+            shared_drop_count_.fetch_add(count - claimed, std::memory_order_relaxed);
+        }
+        return claimed;
+    }
+
+    template <typename T>
+    size_t LockFreeQueue<T>::dequeueCells(T *out, size_t max)
+    {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        size_t ready = 0;
+        while (true)
+        {
+            // Run of cells holding the messages of positions pos, pos + 1, ...
+            bool stale = false;
+            ready = 0;
+            while (ready < max)
+            {
+                size_t sequence = cells_[(pos + ready) & mask_].sequence.load(std::memory_order_acquire);
+                intptr_t dif = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + ready + 1);
+                if (dif != 0)
+                {
+                    stale = dif > 0; // Another consumer took pos already; < 0 means empty
+                    break;
+                }
+                ++ready;
+            }
+
+            if (ready == 0)
+            {
+                if (!stale)
+                {
+                    break; // Queue empty
+                }
+                pos = head_.load(std::memory_order_relaxed);
+            }
+            else if (mode_ == QueueMode::MPSC)
+            {
+                head_.store(pos + ready, std::memory_order_release); // Sole consumer
+                break;
+            }
+            else if (head_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < ready; ++i)
+        {
+            // Hand the cell back for the position one lap later
+            Cell &cell = cells_[(pos + i) & mask_];
+            out[i] = cell.value;
+            cell.sequence.store(pos + i + capacity_, std::memory_order_release);
+        }
+
+        if (ready > 0)
+        {
+            if (mode_ == QueueMode::MPSC)
+            {
+                pop_count_ += ready;
+            }
+            else
+            {
+                shared_pop_count_.fetch_add(ready, std::memory_order_relaxed);
+            }
+        }
+        return ready;
+    }
+
     template <typename T>
     void LockFreeQueue<T>::shutdown()
     {
         is_shutdown_.store(true, std::memory_order_release);
+        wait_->wakeAll();
     }
 
     template <typename T>
@@ -161,12 +509,23 @@ namespace fix_gateway::utils
     template <typename T>
     size_t LockFreeQueue<T>::size() const
     {
+        if (mode_ != QueueMode::SPSC)
+        {
+            // Claimed positions; a snapshot, so clamp what racing claims can skew
+            size_t head = head_.load(std::memory_order_acquire);
+            size_t tail = tail_.load(std::memory_order_acquire);
+            return tail > head ? std::min(tail - head, capacity_) : 0;
+        }
         return (tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire)) & mask_;
     }
 
     template <typename T>
     bool LockFreeQueue<T>::empty() const
     {
+        if (mode_ != QueueMode::SPSC)
+        {
+            return size() == 0;
+        }
         return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
     }
 
@@ -179,19 +538,19 @@ namespace fix_gateway::utils
     template <typename T>
     uint64_t LockFreeQueue<T>::getTotalPushed() const
     {
-        return push_count_.load(std::memory_order_acquire);
+        return push_count_.get() + shared_push_count_.load(std::memory_order_relaxed);
     }
 
     template <typename T>
     uint64_t LockFreeQueue<T>::getTotalPopped() const
     {
-        return pop_count_.load(std::memory_order_acquire);
+        return pop_count_.get() + shared_pop_count_.load(std::memory_order_relaxed);
     }
 
     template <typename T>
     uint64_t LockFreeQueue<T>::getTotalDropped() const
     {
-        return drop_count_.load(std::memory_order_acquire);
+        return drop_count_.get() + shared_drop_count_.load(std::memory_order_relaxed);
     }
 
     template <typename T>
@@ -7,6 +7,11 @@
 #include <atomic>
 #include <functional>
 #include <limits>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 namespace fix_gateway::utils
 {
@@ -64,6 +69,23 @@ namespace fix_gateway::utils
          * @return Formatted string "YYYY-MM-DD HH:MM:SS.microseconds"
          */
         static std::string formatTimestamp(const Timestamp &timestamp);
+
+        /**
+         * @brief Read the raw CPU timestamp counter (RDTSC)
+         * @return Unscaled cycle count on x86; steady_clock nanoseconds elsewhere
+         *
+         * A few cycles instead of a clock_gettime() call - meant for latency
+         * metadata captured on every message. Only differences between two
+         * reads on the same machine are meaningful.
+         */
+        static uint64_t readTsc() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
     };
 
     /**
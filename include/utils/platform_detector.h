@@ -125,6 +125,10 @@ namespace fix_gateway::utils
         static bool supportsHugePages();
         static bool isContainerEnvironment();
 
+        // CPU instruction set detection (used to pick SIMD kernels at runtime)
+        static bool supportsSSE2();
+        static bool supportsAVX2();
+
         // System information
         static int getNumberOfCores();
         static std::string getKernelVersion();
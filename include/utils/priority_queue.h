@@ -2,10 +2,10 @@
 
 #include "common/message.h"
 #include "utils/performance_counters.h"
+#include "utils/lockfree_queue.h"
+#include "utils/wait_strategy.h"
 
-#include <queue>
-#include <mutex>
-#include <condition_variable>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <memory>
@@ -14,7 +14,6 @@
 namespace fix_gateway::utils
 {
     using MessagePtr = fix_gateway::common::MessagePtr;
-    using MessagePriorityComparator = fix_gateway::common::MessagePriorityComparator;
 
     // Queue overflow policies for when queue reaches capacity
     enum class OverflowPolicy
@@ -38,37 +37,56 @@ namespace fix_gateway::utils
         std::string overflow_policy_str;
     };
 
+    // =================================================================
+    // PRIORITY QUEUE - Lock-free multi-level scheduler
+    // =================================================================
+    //
+    // One bounded ring per Priority level plus an occupancy bitmap with a bit
+    // per level that may hold messages. The consumer takes the most urgent
+    // level with a count-trailing-zeros over the bitmap (CRITICAL is bit 0),
+    // so pop never compares messages and messages of one level come out in
+    // FIFO order (per producer), which the old heap did not guarantee.
+    //
+    // max_size bounds all levels together; a push reserves its slot in size_
+    // first and applies the overflow policy when none is left:
+    //   DROP_OLDEST - evict the oldest message of the least urgent non-empty
+    //                 level, never one more urgent than the incoming message
+    //                 (the incoming one is dropped instead)
+    //   DROP_NEWEST / REJECT - drop the incoming message
+    //   BLOCK       - wait for space (WaitStrategy park) up to the timeout
+    //
+    // Producers may be any threads; there is one consumer thread. DROP_OLDEST
+    // queues use MPMC rings because producers evict from the ring heads, and
+    // then several consumers are fine too. A rejected message is destroyed.
+
     class PriorityQueue
     {
-        // TODO: Phase 3 Lock-Free Migration Plan:
-        // 1. Replace STL priority_queue with boost::lockfree::priority_queue
-        // 2. Replace mutex with lock-free atomics for all operations
-        // 3. Replace condition_variable with lock-free wait/notify mechanisms
-        // 4. Use memory ordering for cross-thread synchronization
-        // 5. Target: <100ns per queue operation for sub-10μs latency
-
     public:
-        // Constructor
+        static constexpr size_t LEVEL_COUNT = 4; // One per Priority value
+
+        // Constructor. max_capacity sizes the rings for later setMaxSize()
+        // growth (0: max_size, i.e. no headroom).
         explicit PriorityQueue(
             size_t max_size = 10000,
             OverflowPolicy overflow_policy = OverflowPolicy::DROP_OLDEST,
-            const std::string &queue_name = "priority_queue");
+            const std::string &queue_name = "priority_queue",
+            size_t max_capacity = 0);
 
         // Destructor
         ~PriorityQueue();
 
-        // Core operations
+        // Core operations (lock-free; BLOCK waits only while the queue is full)
         bool push(MessagePtr message);
         bool push(MessagePtr message, std::chrono::milliseconds timeout);
 
-        // Blocking pop - waits for message
+        // Blocking pop - waits for message (spin / yield / park per setWaitStrategy)
         bool pop(MessagePtr &message);
         bool pop(MessagePtr &message, std::chrono::milliseconds timeout);
 
         // Non-blocking pop - returns immediately
         bool tryPop(MessagePtr &message);
 
-        // Queue management
+        // Queue management (clear() is a consumer-side call)
         void clear();
         void shutdown();
         bool isShutdown() const;
@@ -77,6 +95,7 @@ namespace fix_gateway::utils
         size_t size() const;
         bool empty() const;
         size_t capacity() const;
+        size_t levelSize(Priority priority) const;
         QueueStats getStats() const;
 
         // Performance metrics
@@ -86,32 +105,45 @@ namespace fix_gateway::utils
         size_t getPeakSize() const;
         double getAverageLatency() const;
 
-        // Configuration
+        // Configuration (before producers and consumer start). Switching to
+        // DROP_OLDEST needs the MPMC rings, i.e. a queue built with it.
         void setOverflowPolicy(OverflowPolicy policy);
         OverflowPolicy getOverflowPolicy() const;
-        void setMaxSize(size_t max_size);
+        // Up to the ring capacity set at construction; a larger value is
+        // clamped, logged as an error and reported by returning false
+        bool setMaxSize(size_t max_size);
+        void setWaitStrategy(const WaitConfig &config); // How an empty pop() waits
 
         // Utility methods
         std::string toString() const;
         std::string getOverflowPolicyString() const;
 
     private:
-        // Core queue data structure
-        std::priority_queue<MessagePtr, std::vector<MessagePtr>, MessagePriorityComparator> queue_;
+        using LevelRing = LockFreeQueue<MessagePtr>;
+        static constexpr size_t CACHE_LINE_SIZE = 64;
 
-        // Thread synchronization
-        mutable std::mutex mutex_;
-        std::condition_variable not_empty_cv_;
-        std::condition_variable not_full_cv_;
+        // Per-level rings, each sized for the whole queue
+        std::array<std::unique_ptr<LevelRing>, LEVEL_COUNT> levels_;
+
+        // Bit p set: level p may hold messages (set by producers, cleared by the consumer)
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> occupancy_{0};
+
+        // Messages in (or reserved for) the rings, across all levels
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> size_{0};
 
         // Configuration
-        size_t max_size_;
-        OverflowPolicy overflow_policy_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> max_size_;
+        std::atomic<OverflowPolicy> overflow_policy_;
+        size_t ring_capacity_;
         std::string queue_name_;
 
         // State management
         std::atomic<bool> is_shutdown_;
 
+        // Empty-queue wait of the consumer / full-queue wait of BLOCK producers
+        WaitStrategy not_empty_;
+        WaitStrategy not_full_;
+
         // Performance tracking
         std::atomic<uint64_t> total_pushed_;
         std::atomic<uint64_t> total_popped_;
@@ -123,9 +155,14 @@ namespace fix_gateway::utils
         std::atomic<uint64_t> latency_samples_;
 
         // Helper methods
-        bool pushInternal(MessagePtr message);
-        bool handleOverflow(MessagePtr message);
-        void updateStats(MessagePtr message);
+        static size_t levelOf(MessagePtr message);
+        bool reserveSlot(size_t level, std::chrono::steady_clock::time_point deadline);
+        bool evictLessUrgent(size_t level);
+        bool popLevels(MessagePtr &message);
+        void markOccupied(size_t level);
+        void releaseSlots(size_t count);
+        void configureBlockingWait();
+        void updatePeak(size_t current_size);
         void recordLatency(const std::chrono::steady_clock::time_point &start_time);
         std::string formatStats() const;
     };
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace fix_gateway::utils
+{
+    // =================================================================
+    // WAIT STRATEGY - How an idle queue consumer waits for the next message
+    // =================================================================
+    //
+    // A consumer that finds its queue empty calls waitFor(ready) instead of
+    // sleeping. Each call is one bounded wait round and returns ready(), so
+    // the caller loops and still sees its own stop flag:
+    //
+    //   BusySpin  - pause loop only; lowest wake-up latency, burns its core
+    //   SpinYield - pause loop, then sched_yield rounds
+    //   SpinPark  - pause loop, yield rounds, then a futex park of at most
+    //               park_timeout; no CPU while parked
+    //
+    // Parking is an eventcount: the consumer registers in waiters_, re-checks
+    // ready() and sleeps on epoch_. Producers call notify() after publishing;
+    // it is a no-op unless the policy parks, and even then costs a fence and
+    // one load - the futex wake syscall happens only while a consumer is
+    // actually parked. Configure before the consumer thread starts.
+
+    enum class WaitPolicy : uint8_t
+    {
+        BusySpin,
+        SpinYield,
+        SpinPark
+    };
+
+    struct WaitConfig
+    {
+        WaitPolicy policy = WaitPolicy::SpinPark;
+        uint32_t spin_iterations = 1024; // Pause loops before yielding / parking
+        uint32_t yield_iterations = 16;  // sched_yield rounds before parking
+        std::chrono::microseconds park_timeout{1000}; // Upper bound of one park
+
+        static WaitConfig busySpin(uint32_t spins = 1u << 16)
+        {
+            return WaitConfig{WaitPolicy::BusySpin, spins, 0, std::chrono::microseconds(0)};
+        }
+        static WaitConfig spinYield(uint32_t spins = 1024, uint32_t yields = 64)
+        {
+            return WaitConfig{WaitPolicy::SpinYield, spins, yields, std::chrono::microseconds(0)};
+        }
+        static WaitConfig spinPark(uint32_t spins = 1024, uint32_t yields = 16,
+                                   std::chrono::microseconds timeout = std::chrono::microseconds(1000))
+        {
+            return WaitConfig{WaitPolicy::SpinPark, spins, yields, timeout};
+        }
+
+        // Default for priority lane `lane` (0 = most urgent): urgent lanes spin
+        // longer before parking, the last lane parks almost at once. All of
+        // them park eventually; BusySpin is for lanes with an isolated core.
+        static WaitConfig forLane(size_t lane)
+        {
+            switch (lane)
+            {
+            case 0:
+                return spinPark(1u << 14, 64);
+            case 1:
+                return spinPark(4096, 32);
+            case 2:
+                return spinPark(1024, 16);
+            default:
+                return spinPark(64, 0);
+            }
+        }
+    };
+
+    const char *waitPolicyToString(WaitPolicy policy);
+
+    class WaitStrategy
+    {
+    public:
+        explicit WaitStrategy(const WaitConfig &config = WaitConfig{}) { configure(config); }
+
+        WaitStrategy(const WaitStrategy &) = delete;
+        WaitStrategy &operator=(const WaitStrategy &) = delete;
+
+        void configure(const WaitConfig &config)
+        {
+            config_ = config;
+            parks_ = config.policy == WaitPolicy::SpinPark;
+        }
+        const WaitConfig &config() const { return config_; }
+
+        // Consumer side: one wait round, returns ready()
+        template <typename Ready>
+        bool waitFor(Ready &&ready);
+
+        // Producer side, after a message is published
+        void notify()
+        {
+            if (!parks_)
+            {
+                return;
+            }
+            // Pairs with the fence in waitFor(): either the consumer sees the
+            // message in its re-check or we see it registered in waiters_
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+            {
+                wakeAll();
+            }
+        }
+
+        // Wake every parked consumer unconditionally (shutdown, stop flags)
+        void wakeAll();
+
+        // Statistics (parks by the consumer, futex wakes by producers)
+        uint64_t getParkCount() const { return park_count_.load(std::memory_order_relaxed); }
+        uint64_t getWakeCount() const { return wake_count_.load(std::memory_order_relaxed); }
+
+        // Spin-loop hint: PAUSE on x86, YIELD on ARM
+        static void cpuRelax()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield" ::: "memory");
+#endif
+        }
+
+    private:
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        // Sleep on epoch_ while it still equals key, at most park_timeout
+        void park(uint32_t key);
+
+        // Written by parking consumers and waking producers; kept off the
+        // queue's index lines
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> epoch_{0};
+        std::atomic<uint32_t> waiters_{0};
+        std::atomic<uint64_t> park_count_{0};
+        std::atomic<uint64_t> wake_count_{0};
+
+        // Read-mostly
+        alignas(CACHE_LINE_SIZE) WaitConfig config_;
+        bool parks_ = true;
+    };
+
+    template <typename Ready>
+    bool WaitStrategy::waitFor(Ready &&ready)
+    {
+        for (uint32_t i = 0; i < config_.spin_iterations; ++i)
+        {
+            if (ready())
+            {
+                return true;
+            }
+            cpuRelax();
+        }
+
+        if (config_.policy == WaitPolicy::BusySpin)
+        {
+            return ready();
+        }
+
+        for (uint32_t i = 0; i < config_.yield_iterations; ++i)
+        {
+            if (ready())
+            {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+
+        if (config_.policy == WaitPolicy::SpinYield)
+        {
+            return ready();
+        }
+
+        // Register, then re-check: a producer that published before seeing
+        // us in waiters_ is caught here, one that publishes after bumps epoch_
+        uint32_t key = epoch_.load(std::memory_order_acquire);
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ready())
+        {
+            park_count_.fetch_add(1, std::memory_order_relaxed);
+            park(key);
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return ready();
+    }
+
+} // namespace fix_gateway::utils
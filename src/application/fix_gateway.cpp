@@ -45,6 +45,30 @@ namespace fix_gateway::application
                 onTcpDataReceived(buffer, length); // Raw buffer → FIX parser
             });
 
+        // Default receive path: a mirrored ring the parser frames in place, so a
+        // message split across reads is never copied into the parser
+        try
+        {
+            receive_ring_ = std::make_unique<ReceiveRing>();
+            tcp_connection_->setReceiveRing(receive_ring_.get());
+            tcp_connection_->setRingCallback(
+                [this](ReceiveRing &ring)
+                {
+                    onTcpRingData(ring);
+                });
+        }
+        catch (const std::exception &e)
+        {
+            LOG_WARN("Receive ring unavailable, using copied partial buffers: " + std::string(e.what()));
+        }
+
+        // View mode only: same flow, but the parser may pin the receive segment
+        tcp_connection_->setSegmentCallback(
+            [this](ReceiveSegment *segment, size_t length)
+            {
+                onTcpSegmentReceived(segment, length);
+            });
+
         // Set TCP error callback
         tcp_connection_->setErrorCallback(
             [this](const std::string &error)
@@ -86,6 +110,10 @@ namespace fix_gateway::application
         if (tcp_connection_->connect(host, port))
         {
             connected_ = true;
+            if (receive_ring_)
+            {
+                receive_ring_->reset(); // Nothing from a previous session carries over
+            }
             tcp_connection_->startReceiveLoop(); // Start receiving data
             LOG_INFO("Connected to FIX server successfully");
             return true;
@@ -122,68 +150,61 @@ namespace fix_gateway::application
         LOG_DEBUG("Received " + std::to_string(length) + " bytes from TCP");
 
         // =================================================================
-        // ZERO-COPY PARSING: Raw Buffer → FixMessage* (from pool)
+        // ZERO-COPY BATCH PARSING: Raw Buffer → FixMessage*[] (from pool)
+        // One recv() often carries several coalesced messages - every one of
+        // them is framed and handed to the router as a single burst.
         // =================================================================
 
+        FixMessage *batch[MAX_PARSE_BATCH];
+        size_t offset = 0;
+
         try
         {
-            // Parse the buffer - this is where the magic happens!
-            auto parse_result = fix_parser_->parse(buffer, length);
-
-            switch (parse_result.status)
-            {
-            case StreamFixParser::ParseStatus::Success:
+            while (offset < length)
             {
-                LOG_DEBUG("Successfully parsed FIX message");
-
-                // Process the parsed message
-                processParsedMessage(parse_result.parsed_message);
-
-                // NOTE: Message deallocation is now handled by business logic components
-                // after they finish processing the message from the priority queues
-                break;
-            }
+                auto batch_result = fix_parser_->parseBatch(buffer + offset, length - offset,
+                                                            batch, MAX_PARSE_BATCH);
 
-            case StreamFixParser::ParseStatus::NeedMoreData:
-            {
-                LOG_DEBUG("Partial message received, waiting for more data");
-                // Parser automatically handles partial messages internally
-                break;
-            }
+                handleBatchResult(batch, batch_result);
 
-            case StreamFixParser::ParseStatus::InvalidFormat:
-            {
-                LOG_ERROR("Invalid FIX message format: " + parse_result.error_detail);
-                if (error_callback_)
+                // No progress (circuit breaker) - give up on this buffer. Frames the
+                // exhausted pool could not take are held by the parser for the next read
+                if (batch_result.bytes_consumed == 0)
                 {
-                    error_callback_("Parse error: " + parse_result.error_detail);
+                    break;
                 }
-                break;
+                offset += batch_result.bytes_consumed;
             }
-
-            case StreamFixParser::ParseStatus::ChecksumError:
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("Exception during FIX parsing: " + std::string(e.what()));
+            if (error_callback_)
             {
-                LOG_ERROR("FIX message checksum error");
-                if (error_callback_)
-                {
-                    error_callback_("Checksum validation failed");
-                }
-                break;
+                error_callback_("Parse exception: " + std::string(e.what()));
             }
+        }
+    }
+
+    void FixGateway::onTcpRingData(ReceiveRing &ring)
+    {
+        // Frames are decoded where recv() put them; an incomplete tail is left
+        // in the ring and completed in place by the next read
+        FixMessage *batch[MAX_PARSE_BATCH];
 
-            case StreamFixParser::ParseStatus::AllocationFailed:
+        try
+        {
+            while (ring.readable() > 0)
             {
-                LOG_ERROR("MessagePool allocation failed - pool exhausted?");
-                if (error_callback_)
+                auto batch_result = fix_parser_->parseBatch(ring, batch, MAX_PARSE_BATCH);
+                handleBatchResult(batch, batch_result);
+
+                // Incomplete tail, pool exhausted or circuit breaker - wait for the next read
+                if (batch_result.bytes_consumed == 0 ||
+                    batch_result.status == StreamFixParser::ParseStatus::NeedMoreData)
                 {
-                    error_callback_("Message pool allocation failed");
+                    break;
                 }
-                break;
-            }
-
-            default:
-                LOG_ERROR("Unknown parse error");
-                break;
             }
         }
         catch (const std::exception &e)
@@ -196,44 +217,104 @@ namespace fix_gateway::application
         }
     }
 
-    void FixGateway::processParsedMessage(FixMessage *message)
+    void FixGateway::handleBatchResult(FixMessage **batch, const StreamFixParser::BatchParseResult &batch_result)
     {
-        if (!message)
+        if (batch_result.messages_parsed > 0)
         {
-            LOG_ERROR("Null message passed to processParsedMessage");
-            return;
+            processParsedBatch(batch, batch_result.messages_parsed);
+        }
+
+        if (batch_result.messages_dropped > 0)
+        {
+            LOG_ERROR("Dropped " + std::to_string(batch_result.messages_dropped) +
+                      " malformed FIX message(s): " + batch_result.error_detail);
+            if (error_callback_)
+            {
+                error_callback_("Parse error: " + batch_result.error_detail);
+            }
         }
 
-        // Log message details
-        LOG_INFO("Processed FIX message: " + message->getFieldsSummary());
+        switch (batch_result.status)
+        {
+        case StreamFixParser::ParseStatus::Success:
+        case StreamFixParser::ParseStatus::NeedMoreData:
+            // Partial tail (if any) is kept by the parser or left in the ring for the next call
+            break;
 
-        // Route message through MessageRouter to priority queues
-        if (message_router_)
+        case StreamFixParser::ParseStatus::AllocationFailed:
         {
-            try
+            LOG_ERROR("MessagePool allocation failed - pool exhausted?");
+            if (error_callback_)
             {
-                message_router_->routeMessage(message);
-                LOG_DEBUG("Message routed to priority queue successfully");
+                error_callback_("Message pool allocation failed");
             }
-            catch (const std::exception &e)
+            break;
+        }
+
+        default:
+        {
+            // Already reported above when the failure was a skipped frame
+            if (batch_result.messages_dropped == 0)
             {
-                LOG_ERROR("Exception routing message: " + std::string(e.what()));
-                // If routing fails, deallocate message immediately
-                message_pool_->deallocate(message);
-                return;
+                LOG_ERROR("FIX framing error: " + batch_result.error_detail);
+                if (error_callback_)
+                {
+                    error_callback_("Parse error: " + batch_result.error_detail);
+                }
             }
+            break;
+        }
+        }
+    }
+
+    void FixGateway::onTcpSegmentReceived(ReceiveSegment *segment, size_t length)
+    {
+        // Messages framed inside the segment come out as views on it; a tail
+        // carried into the next read is copied by the parser as usual
+        fix_parser_->setReceiveSegment(segment);
+        onTcpDataReceived(segment->data(), length);
+        fix_parser_->setReceiveSegment(nullptr);
+    }
+
+    void FixGateway::processParsedBatch(FixMessage **messages, size_t count)
+    {
+        LOG_DEBUG("Parsed " + std::to_string(count) + " FIX message(s) from buffer");
+
+        // Route the whole burst through MessageRouter to priority queues
+        // NOTE: Message deallocation is handled by business logic components
+        // after they finish processing the message from the priority queues.
+        // Messages a full lane could not take stay ours and are released below.
+        FixMessage *dropped[MAX_PARSE_BATCH];
+        size_t dropped_count = 0;
+        if (message_router_)
+        {
+            dropped_count = message_router_->routeMessages(messages, count, dropped);
         }
 
         // Call user callback if set (optional - for backwards compatibility)
         if (message_callback_)
         {
-            try
+            for (size_t i = 0; i < count; ++i)
             {
-                message_callback_(message); // Pass raw pointer to user code
+                try
+                {
+                    message_callback_(messages[i]); // Pass raw pointer to user code
+                }
+                catch (const std::exception &e)
+                {
+                    LOG_ERROR("Exception in message callback: " + std::string(e.what()));
+                }
             }
-            catch (const std::exception &e)
+        }
+
+        if (dropped_count > 0)
+        {
+            // Counted per lane in the router's stats (messages_dropped)
+            LOG_WARN("Priority queue full - dropped " + std::to_string(dropped_count) + " of " +
+                     std::to_string(count) + " FIX message(s)");
+            for (size_t i = 0; i < dropped_count; ++i)
             {
-                LOG_ERROR("Exception in message callback: " + std::string(e.what()));
+                message_pool_->deallocate(dropped[i]);
             }
         }
     }
@@ -356,4 +437,40 @@ namespace fix_gateway::application
         fix_parser_->setStrictValidation(strict);
     }
 
+    bool FixGateway::setPrefilter(const MessagePrefilter &prefilter, StreamFixParser::PassThroughHandler handler)
+    {
+        if (connected_)
+        {
+            LOG_WARN("Prefilter must be set before connecting");
+            return false;
+        }
+
+        if (prefilter.filtersSessionMessages())
+        {
+            LOG_ERROR("Prefilter rejected - session-level messages must be parsed for MsgSeqNum tracking");
+            return false;
+        }
+
+        prefilter_ = std::make_unique<MessagePrefilter>(prefilter);
+        fix_parser_->setPrefilter(prefilter_.get());
+        fix_parser_->setPassThroughHandler(std::move(handler));
+        return true;
+    }
+
+    void FixGateway::enableMessageViews(size_t segment_count)
+    {
+        if (connected_)
+        {
+            LOG_WARN("Message views must be enabled before connecting");
+            return;
+        }
+        if (segment_pool_)
+        {
+            return; // Live messages may still pin the current segments
+        }
+
+        segment_pool_ = std::make_unique<ReceiveSegmentPool>(segment_count);
+        tcp_connection_->setReceiveSegmentPool(segment_pool_.get());
+    }
+
 } // namespace fix_gateway::application
\ No newline at end of file
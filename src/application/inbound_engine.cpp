@@ -0,0 +1,539 @@
+#include "application/inbound_engine.h"
+#include "manager/async_sender_manager.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <poll.h>
+
+namespace fix_gateway::application
+{
+    using namespace fix_gateway::network;
+    using namespace fix_gateway::protocol;
+    using namespace fix_gateway::common;
+
+    InboundEngine::InboundEngine()
+        : InboundEngine(Config())
+    {
+    }
+
+    InboundEngine::InboundEngine(const Config &config)
+        : config_(config)
+    {
+        size_t worker_count = std::max<size_t>(config_.worker_count, 1);
+        workers_.reserve(worker_count);
+
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            auto worker = std::make_unique<Worker>();
+            worker->index = i;
+            worker->core = coreForWorker(i);
+
+            // Pages are first touched by the worker itself (prewarm in workerLoop),
+            // so they land on the NUMA node of the core it is pinned to
+            PoolConfig pool_config;
+            pool_config.initial_size = config_.worker_pool_size;
+            pool_config.max_size = config_.worker_pool_max_size;
+            pool_config.huge_pages = config_.worker_pool_huge_pages;
+            worker->pool = std::make_unique<MessagePool<FixMessage>>(
+                pool_config, "inbound_worker_" + std::to_string(i) + "_pool");
+            // The worker is the only producer of its lanes (and one thread per lane consumes)
+            worker->queues = std::make_shared<PriorityQueueContainer>(PriorityQueueContainer::QueueMode::SPSC);
+            worker->router = std::make_unique<manager::MessageRouter>(worker->queues);
+            worker->router->setHeaderPool(worker->pool.get());
+            worker->router->start();
+            workers_.push_back(std::move(worker));
+        }
+
+        LOG_INFO("InboundEngine created with " + std::to_string(workers_.size()) + " worker(s)");
+    }
+
+    InboundEngine::~InboundEngine()
+    {
+        stop();
+    }
+
+    // =================================================================
+    // LIFECYCLE
+    // =================================================================
+
+    void InboundEngine::start()
+    {
+        if (running_.exchange(true, std::memory_order_acq_rel))
+        {
+            LOG_WARN("InboundEngine already running");
+            return;
+        }
+
+        unsigned hardware_cores = std::thread::hardware_concurrency();
+        for (auto &worker : workers_)
+        {
+            worker->thread = std::thread(&InboundEngine::workerLoop, this, std::ref(*worker));
+            placeWorker(*worker, hardware_cores);
+            worker->placed.store(true, std::memory_order_release);
+        }
+
+        LOG_INFO("InboundEngine started");
+    }
+
+    void InboundEngine::stop()
+    {
+        if (!running_.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        for (auto &worker : workers_)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        LOG_INFO("InboundEngine stopped");
+    }
+
+    // =================================================================
+    // SESSIONS
+    // =================================================================
+
+    InboundEngine::SessionId InboundEngine::addSession(const std::string &host, int port)
+    {
+        auto connection = std::make_unique<TcpConnection>();
+        try
+        {
+            if (!connection->connect(host, port))
+            {
+                LOG_ERROR("InboundEngine: failed to connect session to " + host + ":" + std::to_string(port));
+                return 0;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("InboundEngine: failed to connect session to " + host + ":" + std::to_string(port) +
+                      " - " + e.what());
+            return 0;
+        }
+
+        return addSession(std::move(connection));
+    }
+
+    InboundEngine::SessionId InboundEngine::addSession(std::unique_ptr<TcpConnection> connection, int worker_index)
+    {
+        if (!connection || !connection->isConnected())
+        {
+            LOG_ERROR("InboundEngine: session connection is not connected");
+            return 0;
+        }
+
+        size_t index = worker_index >= 0 ? static_cast<size_t>(worker_index) % workers_.size() : leastLoadedWorker();
+        Worker &worker = *workers_[index];
+
+        auto session = std::make_unique<Session>();
+        session->id = next_session_id_.fetch_add(1, std::memory_order_relaxed);
+        session->remote = connection->getRemoteHost() + ":" + std::to_string(connection->getRemotePort());
+        session->ring = std::make_unique<ReceiveRing>(config_.session_ring_capacity);
+        session->parser = std::make_unique<StreamFixParser>(worker.pool.get());
+        session->parser->setPrefilter(config_.prefilter.get());
+        session->connection = std::move(connection);
+
+        // The worker drives reads through receiveOnce(); frames are decoded in
+        // place in the session ring, exactly as FixGateway does on its own thread
+        Session *raw = session.get();
+        if (pass_through_callback_)
+        {
+            session->parser->setPassThroughHandler(
+                [this, raw](FixMsgType msg_type, const char *frame, size_t length)
+                {
+                    pass_through_callback_(raw->id, msg_type, frame, length);
+                });
+        }
+        session->connection->setReceiveRing(raw->ring.get());
+        session->connection->setRingCallback(
+            [this, &worker, raw](ReceiveRing &ring)
+            {
+                onSessionData(worker, *raw, ring);
+            });
+        session->connection->setErrorCallback(
+            [this, raw](const std::string &error)
+            {
+                reportError(*raw, "TCP error: " + error);
+            });
+        session->connection->setDisconnectCallback(
+            [this, raw]()
+            {
+                raw->active.store(false, std::memory_order_release);
+                reportError(*raw, "Connection lost");
+            });
+
+        SessionId id = session->id;
+        {
+            std::lock_guard<std::mutex> lock(worker.pending_mutex);
+            worker.pending.push_back(std::move(session));
+        }
+        worker.session_count.fetch_add(1, std::memory_order_relaxed);
+        worker.has_pending.store(true, std::memory_order_release);
+
+        LOG_INFO("InboundEngine: session " + std::to_string(id) + " (" + raw->remote + ") assigned to worker " +
+                 std::to_string(index));
+        return id;
+    }
+
+    size_t InboundEngine::leastLoadedWorker() const
+    {
+        size_t best = 0;
+        for (size_t i = 1; i < workers_.size(); ++i)
+        {
+            if (workers_[i]->session_count.load(std::memory_order_relaxed) <
+                workers_[best]->session_count.load(std::memory_order_relaxed))
+            {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    void InboundEngine::placeWorker(Worker &worker, unsigned hardware_cores)
+    {
+        if (worker.core < 0)
+        {
+            return;
+        }
+        if (hardware_cores != 0 && static_cast<unsigned>(worker.core) >= hardware_cores)
+        {
+            LOG_WARN("Inbound worker " + std::to_string(worker.index) + ": core " +
+                     std::to_string(worker.core) + " does not exist - running unpinned");
+            return;
+        }
+
+        // Same affinity logic as the AsyncSender threads
+        bool pinned = manager::AsyncSenderManager::pinThreadToCore(worker.thread, worker.core);
+        worker.pinned.store(pinned, std::memory_order_relaxed);
+    }
+
+    int InboundEngine::coreForWorker(size_t index) const
+    {
+        if (!config_.enable_core_pinning)
+        {
+            return -1;
+        }
+        if (!config_.worker_cores.empty())
+        {
+            return index < config_.worker_cores.size() ? config_.worker_cores[index] : -1;
+        }
+        return config_.first_core + static_cast<int>(index);
+    }
+
+    // =================================================================
+    // WORKER THREAD
+    // =================================================================
+
+    void InboundEngine::workerLoop(Worker &worker)
+    {
+        LOG_DEBUG("Inbound worker " + std::to_string(worker.index) + " running");
+        size_t idle_passes = 0;
+
+        // First touch of the pool from the pinned worker puts it on the local node
+        while (!worker.placed.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+        worker.pool->prewarm();
+
+        while (running_.load(std::memory_order_acquire))
+        {
+            if (worker.has_pending.load(std::memory_order_acquire))
+            {
+                adoptPendingSessions(worker);
+            }
+
+            bool progressed = false;
+            bool closed = false;
+            for (auto &session : worker.sessions)
+            {
+                if (session->active.load(std::memory_order_acquire))
+                {
+                    progressed |= pollSession(worker, *session);
+                }
+                closed |= !session->active.load(std::memory_order_acquire);
+            }
+
+            if (closed)
+            {
+                removeClosedSessions(worker);
+            }
+
+            if (progressed)
+            {
+                idle_passes = 0;
+                continue;
+            }
+
+            // Spin a little (the next packet is usually close), then block
+            if (++idle_passes >= config_.idle_spins)
+            {
+                // Idle is the place to grow: the new slab is faulted in before the next burst
+                worker.pool->maintain();
+                waitForData(worker);
+                worker.idle_waits++;
+                idle_passes = 0;
+            }
+        }
+
+        LOG_DEBUG("Inbound worker " + std::to_string(worker.index) + " exiting");
+    }
+
+    void InboundEngine::adoptPendingSessions(Worker &worker)
+    {
+        std::lock_guard<std::mutex> lock(worker.pending_mutex);
+        for (auto &session : worker.pending)
+        {
+            worker.sessions.push_back(std::move(session));
+        }
+        worker.pending.clear();
+        worker.has_pending.store(false, std::memory_order_relaxed);
+    }
+
+    void InboundEngine::removeClosedSessions(Worker &worker)
+    {
+        // Closed sessions take their connection, ring and parser with them;
+        // whatever they already published lives in the worker pool
+        size_t removed = 0;
+        {
+            std::lock_guard<std::mutex> lock(worker.pending_mutex);
+            auto closed = std::remove_if(worker.sessions.begin(), worker.sessions.end(),
+                                         [](const std::unique_ptr<Session> &session)
+                                         {
+                                             return !session->active.load(std::memory_order_acquire);
+                                         });
+            removed = static_cast<size_t>(worker.sessions.end() - closed);
+            worker.sessions.erase(closed, worker.sessions.end());
+        }
+        worker.session_count.fetch_sub(removed, std::memory_order_relaxed);
+    }
+
+    bool InboundEngine::pollSession(Worker &worker, Session &session)
+    {
+        // Frames left behind while the pool was exhausted get another try
+        // first. Until they are parsed the socket is not read: the ring would
+        // fill up, and leaving the bytes in the kernel lets TCP flow control
+        // push back on the sender.
+        if (session.retry_parse)
+        {
+            onSessionData(worker, session, *session.ring);
+            if (session.retry_parse)
+            {
+                return false;
+            }
+        }
+
+        switch (session.connection->receiveOnce())
+        {
+        case TcpConnection::ReceiveStatus::Data:
+            return true;
+
+        case TcpConnection::ReceiveStatus::Closed:
+            // The disconnect callback already reported it; the worker loop
+            // removes the session
+            if (session.active.exchange(false, std::memory_order_acq_rel))
+            {
+                reportError(session, "Connection closed");
+            }
+            return false;
+
+        default:
+            return false;
+        }
+    }
+
+    void InboundEngine::onSessionData(Worker &worker, Session &session, ReceiveRing &ring)
+    {
+        FixMessage *batch[MAX_PARSE_BATCH];
+        session.retry_parse = false;
+
+        while (ring.readable() > 0)
+        {
+            auto result = session.parser->parseBatch(ring, batch, MAX_PARSE_BATCH);
+
+            if (result.messages_parsed > 0)
+            {
+                publish(worker, session, batch, result.messages_parsed);
+            }
+            session.messages_filtered += result.messages_filtered;
+            if (result.messages_dropped > 0)
+            {
+                session.messages_dropped += result.messages_dropped;
+                reportError(session, "Dropped " + std::to_string(result.messages_dropped) +
+                                         " malformed FIX message(s): " + result.error_detail);
+            }
+
+            switch (result.status)
+            {
+            case StreamFixParser::ParseStatus::Success:
+            case StreamFixParser::ParseStatus::NeedMoreData:
+                break;
+
+            case StreamFixParser::ParseStatus::AllocationFailed:
+                // Worker pool exhausted - keep the frames and retry on the next pass
+                session.retry_parse = true;
+                break;
+
+            default:
+                if (result.messages_dropped == 0)
+                {
+                    session.parse_errors++;
+                    reportError(session, "Parse error: " + result.error_detail);
+                }
+                break;
+            }
+
+            // Incomplete tail, pool exhausted or circuit breaker - wait for the next read
+            if (result.bytes_consumed == 0 || result.status == StreamFixParser::ParseStatus::NeedMoreData ||
+                session.retry_parse)
+            {
+                break;
+            }
+        }
+    }
+
+    void InboundEngine::publish(Worker &worker, Session &session, FixMessage **messages, size_t count)
+    {
+        session.messages_parsed += count;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            messages[i]->setSessionId(session.id);
+        }
+
+        // This worker is the only producer of its lanes: the batch goes out
+        // with one bulk push per lane
+        FixMessage *dropped[MAX_PARSE_BATCH];
+        size_t dropped_count = worker.router->routeMessages(messages, count, dropped);
+        for (size_t i = 0; i < dropped_count; ++i)
+        {
+            worker.pool->deallocate(dropped[i]);
+        }
+        worker.messages_published += count - dropped_count;
+        worker.queue_full_drops += dropped_count;
+    }
+
+    void InboundEngine::waitForData(Worker &worker)
+    {
+        std::vector<pollfd> fds;
+        fds.reserve(worker.sessions.size());
+        for (auto &session : worker.sessions)
+        {
+            // A session waiting for pool space is readable but must not be read
+            if (session->active.load(std::memory_order_acquire) && !session->retry_parse)
+            {
+                fds.push_back({session->connection->getSocketFd(), POLLIN, 0});
+            }
+        }
+
+        // With no sessions this is a bounded sleep
+        ::poll(fds.data(), fds.size(), config_.idle_poll_timeout_ms);
+    }
+
+    void InboundEngine::reportError(Session &session, const std::string &error)
+    {
+        LOG_ERROR("InboundEngine session " + std::to_string(session.id) + ": " + error);
+        if (error_callback_)
+        {
+            error_callback_(session.id, error);
+        }
+    }
+
+    // =================================================================
+    // CONSUMER SIDE
+    // =================================================================
+
+    size_t InboundEngine::pollMessages(Priority priority, FixMessage **out, size_t max)
+    {
+        size_t lane = static_cast<size_t>(priority);
+        size_t start = poll_cursor_[lane];
+        poll_cursor_[lane] = (start + 1) % workers_.size();
+
+        size_t count = 0;
+        for (size_t n = 0; n < workers_.size() && count < max; ++n)
+        {
+            const auto &queue = workers_[(start + n) % workers_.size()]->queues->getQueues()[lane];
+            count += queue->popBulk(out + count, max - count);
+        }
+        return count;
+    }
+
+    bool InboundEngine::releaseMessage(FixMessage *message)
+    {
+        if (!message)
+        {
+            return false;
+        }
+
+        for (auto &worker : workers_)
+        {
+            if (worker->pool->owns(message))
+            {
+                worker->pool->deallocate(message);
+                return true;
+            }
+        }
+
+        LOG_WARN("InboundEngine: released message does not belong to any worker pool");
+        return false;
+    }
+
+    std::shared_ptr<PriorityQueueContainer> InboundEngine::getWorkerQueues(size_t worker) const
+    {
+        return worker < workers_.size() ? workers_[worker]->queues : nullptr;
+    }
+
+    // =================================================================
+    // MONITORING
+    // =================================================================
+
+    std::vector<InboundEngine::SessionStats> InboundEngine::getSessionStats() const
+    {
+        std::vector<SessionStats> result;
+        for (const auto &worker : workers_)
+        {
+            std::lock_guard<std::mutex> lock(worker->pending_mutex);
+            for (const auto *list : {&worker->sessions, &worker->pending})
+            {
+                for (const auto &session : *list)
+                {
+                    SessionStats stats;
+                    stats.session_id = session->id;
+                    stats.worker = worker->index;
+                    stats.active = session->active.load(std::memory_order_acquire);
+                    stats.remote = session->remote;
+                    stats.messages_parsed = session->messages_parsed;
+                    stats.messages_dropped = session->messages_dropped;
+                    stats.messages_filtered = session->messages_filtered;
+                    stats.parse_errors = session->parse_errors;
+                    result.push_back(std::move(stats));
+                }
+            }
+        }
+        return result;
+    }
+
+    InboundEngine::WorkerStats InboundEngine::getWorkerStats(size_t index) const
+    {
+        WorkerStats stats;
+        if (index >= workers_.size())
+        {
+            return stats;
+        }
+
+        const Worker &worker = *workers_[index];
+        stats.worker = worker.index;
+        stats.core = worker.core;
+        stats.pinned = worker.pinned.load(std::memory_order_relaxed);
+        stats.sessions = worker.session_count.load(std::memory_order_relaxed);
+        stats.messages_published = worker.messages_published;
+        stats.queue_full_drops = worker.queue_full_drops;
+        stats.idle_waits = worker.idle_waits;
+        stats.pool = worker.pool->getStats();
+        return stats;
+    }
+
+} // namespace fix_gateway::application
@@ -0,0 +1,76 @@
+#include "common/receive_ring.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace fix_gateway::common
+{
+    namespace
+    {
+        std::runtime_error mappingError(const char *step)
+        {
+            return std::runtime_error(std::string("ReceiveRing: ") + step + " failed: " + std::strerror(errno));
+        }
+    }
+
+    ReceiveRing::ReceiveRing(size_t capacity)
+    {
+        // Both mappings must start on a page boundary; a power of two keeps
+        // the index wrap a mask
+        size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t rounded = page_size;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+
+        int fd = ::memfd_create("fix_receive_ring", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            throw mappingError("memfd_create");
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(rounded)) != 0)
+        {
+            ::close(fd);
+            throw mappingError("ftruncate");
+        }
+
+        // Reserve the full 2x window first so the two halves are guaranteed adjacent
+        void *reserved = ::mmap(nullptr, 2 * rounded, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED)
+        {
+            ::close(fd);
+            throw mappingError("mmap reserve");
+        }
+
+        char *base = static_cast<char *>(reserved);
+        if (::mmap(base, rounded, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+            ::mmap(base + rounded, rounded, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+        {
+            std::runtime_error error = mappingError("mmap mirror");
+            ::munmap(base, 2 * rounded);
+            ::close(fd);
+            throw error;
+        }
+
+        // The mappings keep the memory alive
+        ::close(fd);
+
+        base_ = base;
+        capacity_ = rounded;
+        mask_ = rounded - 1;
+    }
+
+    ReceiveRing::~ReceiveRing()
+    {
+        if (base_)
+        {
+            ::munmap(base_, 2 * capacity_);
+        }
+    }
+
+} // namespace fix_gateway::common
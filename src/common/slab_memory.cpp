@@ -0,0 +1,154 @@
+#include "common/slab_memory.h"
+#include "utils/platform_detector.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <new>
+
+namespace fix_gateway::common
+{
+    namespace
+    {
+        constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+        // <numaif.h> is part of libnuma; the syscall itself needs no library
+        constexpr int MPOL_PREFERRED_POLICY = 1;
+
+        size_t roundUp(size_t bytes, size_t granularity)
+        {
+            return (bytes + granularity - 1) / granularity * granularity;
+        }
+
+        void *mapAnonymous(size_t bytes, int extra_flags)
+        {
+            void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+            return base == MAP_FAILED ? nullptr : base;
+        }
+
+        void bindToNode(void *base, size_t bytes, int node)
+        {
+#ifdef SYS_mbind
+            if (node < 0 || node >= static_cast<int>(sizeof(unsigned long) * 8))
+            {
+                return;
+            }
+            unsigned long node_mask = 1UL << node;
+            // Best effort: kernels without NUMA support reject it and first touch applies
+            ::syscall(SYS_mbind, base, bytes, MPOL_PREFERRED_POLICY, &node_mask, sizeof(node_mask) * 8, 0);
+#else
+            (void)base;
+            (void)bytes;
+            (void)node;
+#endif
+        }
+    }
+
+    SlabMemory::SlabMemory(size_t bytes, const SlabOptions &options)
+    {
+        size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+#ifdef MAP_HUGETLB
+        if (options.huge_pages && hugePagesAvailable())
+        {
+            // Reserved hugepages first: fails cleanly when none are configured
+            mapped_ = roundUp(bytes, HUGE_PAGE_SIZE);
+            base_ = mapAnonymous(mapped_, MAP_HUGETLB);
+            if (base_)
+            {
+                backing_ = SlabBacking::HugePages;
+            }
+        }
+#endif
+
+        if (!base_)
+        {
+            mapped_ = roundUp(bytes, options.huge_pages ? HUGE_PAGE_SIZE : page_size);
+            base_ = mapAnonymous(mapped_, 0);
+            if (!base_)
+            {
+                throw std::bad_alloc();
+            }
+#ifdef MADV_HUGEPAGE
+            if (options.huge_pages && ::madvise(base_, mapped_, MADV_HUGEPAGE) == 0)
+            {
+                backing_ = SlabBacking::TransparentHugePages;
+            }
+#endif
+        }
+
+        bindToNode(base_, mapped_, options.numa_node);
+
+        if (options.prefault)
+        {
+            prefault();
+        }
+    }
+
+    SlabMemory::~SlabMemory()
+    {
+        release();
+    }
+
+    SlabMemory::SlabMemory(SlabMemory &&other) noexcept
+        : base_(other.base_), mapped_(other.mapped_), backing_(other.backing_)
+    {
+        other.base_ = nullptr;
+        other.mapped_ = 0;
+    }
+
+    SlabMemory &SlabMemory::operator=(SlabMemory &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            base_ = other.base_;
+            mapped_ = other.mapped_;
+            backing_ = other.backing_;
+            other.base_ = nullptr;
+            other.mapped_ = 0;
+        }
+        return *this;
+    }
+
+    void SlabMemory::release()
+    {
+        if (base_)
+        {
+            ::munmap(base_, mapped_);
+            base_ = nullptr;
+            mapped_ = 0;
+        }
+    }
+
+    void SlabMemory::prefault() const
+    {
+        // Touch with the regular page stride: it also faults every 4K page of a
+        // THP range that the kernel has not collapsed into a hugepage
+        size_t stride = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        volatile char *bytes = static_cast<volatile char *>(base_);
+        for (size_t offset = 0; offset < mapped_; offset += stride)
+        {
+            bytes[offset] = 0;
+        }
+    }
+
+    int SlabMemory::currentNumaNode()
+    {
+#ifdef SYS_getcpu
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        {
+            return static_cast<int>(node);
+        }
+#endif
+        return -1;
+    }
+
+    bool SlabMemory::hugePagesAvailable()
+    {
+        static const bool available = utils::PlatformDetector::supportsHugePages();
+        return available;
+    }
+
+} // namespace fix_gateway::common
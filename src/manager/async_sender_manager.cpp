@@ -56,7 +56,7 @@ namespace fix_gateway::manager
         config_.high_queue_size = 2048;
         config_.medium_queue_size = 4096;
         config_.low_queue_size = 8192;
-        config_.queue_type = QueueType::MUTEX_BASED;
+        config_.queue_type = QueueType::PRIORITY_SCHEDULER;
 
         // Initialize core mapping
         priority_to_core_[Priority::CRITICAL] = config_.critical_core;
@@ -134,7 +134,8 @@ namespace fix_gateway::manager
 
         stop();
 
-        // Clean up resources
+        // Clean up resources (the scheduler first: it hands the lanes back their own wait)
+        egress_scheduler_.reset();
         priority_queues_.clear();
         lockfree_queues_.clear();
         async_senders_.clear();
@@ -214,6 +215,18 @@ namespace fix_gateway::manager
             }
         }
 
+        // Single-writer egress: one sender for every lane
+        if (egress_scheduler_)
+        {
+            auto egress_stats = egress_scheduler_->getStats();
+            stats.total_messages_sent = egress_stats.messages_sent;
+            stats.total_messages_failed = egress_stats.messages_failed;
+            stats.critical_count = egress_stats.lane_sent[static_cast<size_t>(Priority::CRITICAL)];
+            stats.high_count = egress_stats.lane_sent[static_cast<size_t>(Priority::HIGH)];
+            stats.medium_count = egress_stats.lane_sent[static_cast<size_t>(Priority::MEDIUM)];
+            stats.low_count = egress_stats.lane_sent[static_cast<size_t>(Priority::LOW)];
+        }
+
         // Calculate aggregate metrics
         for (const auto &[priority, priority_stats] : stats.priority_stats)
         {
@@ -305,6 +318,11 @@ namespace fix_gateway::manager
             return false;
         }
 
+        if (egress_scheduler_ && !egress_scheduler_->isRunning())
+        {
+            return false;
+        }
+
         // Check if all AsyncSenders are running
         for (const auto &[priority, sender] : async_senders_)
         {
@@ -357,11 +375,17 @@ namespace fix_gateway::manager
     void AsyncSenderManager::createQueuesAndSenders()
     {
         std::cout << "[AsyncSenderManager] Creating queues and senders..." << std::endl;
+
+        if (config_.single_writer_egress && config_.queue_type != QueueType::LOCK_FREE)
+        {
+            std::cout << "[AsyncSenderManager] Single-writer egress drains lock-free lanes - using LOCK_FREE" << std::endl;
+            config_.queue_type = QueueType::LOCK_FREE;
+        }
         std::cout << "[AsyncSenderManager] Queue type: " << getQueueTypeString() << std::endl;
 
-        if (config_.queue_type == QueueType::MUTEX_BASED)
+        if (config_.queue_type == QueueType::PRIORITY_SCHEDULER)
         {
-            // Create mutex-based priority queues
+            // Create multi-level priority schedulers
             priority_queues_[Priority::CRITICAL] = std::make_shared<PriorityQueue>(
                 config_.critical_queue_size, fix_gateway::utils::OverflowPolicy::DROP_OLDEST, "critical_queue");
 
@@ -374,14 +398,14 @@ namespace fix_gateway::manager
             priority_queues_[Priority::LOW] = std::make_shared<PriorityQueue>(
                 config_.low_queue_size, fix_gateway::utils::OverflowPolicy::DROP_OLDEST, "low_queue");
 
-            // Create AsyncSenders with mutex-based queues
+            // Create AsyncSenders with priority schedulers
             for (const auto &[priority, queue] : priority_queues_)
             {
                 async_senders_[priority] = std::make_shared<AsyncSender>(queue, tcp_connection_);
             }
 
             std::cout << "[AsyncSenderManager] Created " << priority_queues_.size()
-                      << " mutex-based queues and " << async_senders_.size() << " senders" << std::endl;
+                      << " priority schedulers and " << async_senders_.size() << " senders" << std::endl;
         }
         else // LOCK_FREE
         {
@@ -398,6 +422,27 @@ namespace fix_gateway::manager
             lockfree_queues_[Priority::LOW] = std::make_shared<LockFreeQueue>(
                 config_.low_queue_size, "low_lockfree_queue");
 
+            lockfree_queues_[Priority::CRITICAL]->setWaitStrategy(config_.critical_wait);
+            lockfree_queues_[Priority::HIGH]->setWaitStrategy(config_.high_wait);
+            lockfree_queues_[Priority::MEDIUM]->setWaitStrategy(config_.medium_wait);
+            lockfree_queues_[Priority::LOW]->setWaitStrategy(config_.low_wait);
+
+            if (config_.single_writer_egress)
+            {
+                // One scheduler thread for all lanes instead of a sender per lane
+                fix_gateway::network::EgressScheduler::LaneArray lanes;
+                for (const auto &[priority, queue] : lockfree_queues_)
+                {
+                    lanes[static_cast<size_t>(priority)] = queue;
+                }
+                egress_scheduler_ = std::make_shared<fix_gateway::network::EgressScheduler>(
+                    lanes, tcp_connection_, config_.egress);
+
+                std::cout << "[AsyncSenderManager] Created " << lockfree_queues_.size()
+                          << " lock-free lanes and a single-writer egress scheduler" << std::endl;
+                return;
+            }
+
             // Create AsyncSenders with lock-free queues
             for (const auto &[priority, queue] : lockfree_queues_)
             {
@@ -479,9 +524,36 @@ namespace fix_gateway::manager
             }
         }
 
+        startEgressScheduler();
+
         std::cout << "[AsyncSenderManager] All AsyncSenders started" << std::endl;
     }
 
+    void AsyncSenderManager::startEgressScheduler()
+    {
+        if (!egress_scheduler_)
+        {
+            return;
+        }
+
+        egress_scheduler_->start();
+
+        // The one writer gets the critical lane's core
+        if (config_.enable_core_pinning)
+        {
+            int core_id = getCoreForPriority(Priority::CRITICAL);
+            bool pinned = pinThreadToCore(egress_scheduler_->getSchedulerThread(), core_id);
+            std::cout << "[AsyncSenderManager] Egress scheduler thread "
+                      << (pinned ? "pinned to core " : "could not be pinned to core ") << core_id << std::endl;
+
+            if (config_.enable_real_time_priority && !setThreadRealTimePriority(egress_scheduler_->getSchedulerThread()))
+            {
+                std::cout << "[AsyncSenderManager] Failed to set real-time priority for the egress scheduler thread"
+                          << " (try running as root)" << std::endl;
+            }
+        }
+    }
+
     void AsyncSenderManager::stopAsyncSenders()
     {
         std::cout << "[AsyncSenderManager] Stopping AsyncSenders..." << std::endl;
@@ -494,6 +566,11 @@ namespace fix_gateway::manager
             }
         }
 
+        if (egress_scheduler_)
+        {
+            egress_scheduler_->stop();
+        }
+
         std::cout << "[AsyncSenderManager] All AsyncSenders stopped" << std::endl;
     }
 
@@ -673,7 +750,7 @@ namespace fix_gateway::manager
     // Queue interface abstraction methods
     bool AsyncSenderManager::pushToQueue(Priority priority, MessagePtr message)
     {
-        if (config_.queue_type == QueueType::MUTEX_BASED)
+        if (config_.queue_type == QueueType::PRIORITY_SCHEDULER)
         {
             auto it = priority_queues_.find(priority);
             if (it != priority_queues_.end() && it->second)
@@ -694,7 +771,7 @@ namespace fix_gateway::manager
 
     size_t AsyncSenderManager::getQueueSize(Priority priority) const
     {
-        if (config_.queue_type == QueueType::MUTEX_BASED)
+        if (config_.queue_type == QueueType::PRIORITY_SCHEDULER)
         {
             auto it = priority_queues_.find(priority);
             return (it != priority_queues_.end() && it->second) ? it->second->size() : 0;
@@ -710,8 +787,8 @@ namespace fix_gateway::manager
     {
         switch (config_.queue_type)
         {
-        case QueueType::MUTEX_BASED:
-            return "MUTEX_BASED";
+        case QueueType::PRIORITY_SCHEDULER:
+            return "PRIORITY_SCHEDULER";
         case QueueType::LOCK_FREE:
             return "LOCK_FREE";
         default:
@@ -785,7 +862,7 @@ namespace fix_gateway::manager
         config.high_queue_size = 2048;
         config.medium_queue_size = 4096;
         config.low_queue_size = 8192;
-        config.queue_type = AsyncSenderManager::QueueType::MUTEX_BASED;
+        config.queue_type = AsyncSenderManager::QueueType::PRIORITY_SCHEDULER;
 
         return config;
     }
@@ -808,7 +885,7 @@ namespace fix_gateway::manager
         config.high_queue_size = 2048;
         config.medium_queue_size = 4096;
         config.low_queue_size = 8192;
-        config.queue_type = AsyncSenderManager::QueueType::MUTEX_BASED;
+        config.queue_type = AsyncSenderManager::QueueType::PRIORITY_SCHEDULER;
 
         return config;
     }
@@ -825,6 +902,9 @@ namespace fix_gateway::manager
 
         config.enable_real_time_priority = true; // Requires root
 
+        // Critical sender owns its pinned core: never park it
+        config.critical_wait = fix_gateway::utils::WaitConfig::busySpin();
+
         return config;
     }
 
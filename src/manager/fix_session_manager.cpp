@@ -4,8 +4,6 @@
 #include "common/message_pool.h"
 #include "utils/logger.h"
 
-#include <sstream>
-#include <iomanip>
 #include <thread>
 
 using namespace fix_gateway::manager;
@@ -148,12 +146,12 @@ bool FixSessionManager::handleMessage(FixMessage *message)
     last_message_received_ = std::chrono::steady_clock::now();
 
     // Extract message type
-    std::string msg_type_str;
-    if (!message->getField(FixFields::MsgType, msg_type_str))
+    if (!message->hasField(FixFields::MsgType))
     {
         logError("Message missing MsgType field");
         return false;
     }
+    FixMsgType msg_type = message->getMsgTypeEnum();
 
     // Validate session-level fields
     if (!validateSessionMessage(message))
@@ -173,23 +171,31 @@ bool FixSessionManager::handleMessage(FixMessage *message)
     bool handled = false;
     try
     {
-        if (msg_type_str == "A")
+        switch (msg_type)
+        {
+        case FixMsgType::LOGON:
             handled = handleLogon(message);
-        else if (msg_type_str == "5")
+            break;
+        case FixMsgType::LOGOUT:
             handled = handleLogout(message);
-        else if (msg_type_str == "0")
+            break;
+        case FixMsgType::HEARTBEAT:
             handled = handleHeartbeat(message);
-        else if (msg_type_str == "1")
+            break;
+        case FixMsgType::TEST_REQUEST:
             handled = handleTestRequest(message);
-        else if (msg_type_str == "2")
+            break;
+        case FixMsgType::RESEND_REQUEST:
             handled = handleResendRequest(message);
-        else if (msg_type_str == "4")
+            break;
+        case FixMsgType::SEQUENCE_RESET:
             handled = handleSequenceReset(message);
-        else if (msg_type_str == "3")
+            break;
+        case FixMsgType::REJECT:
             handled = handleReject(message);
-        else
-        {
-            logWarning("Unsupported session message type: " + msg_type_str);
+            break;
+        default:
+            logWarning("Unsupported session message type: " + message->getMsgType());
             return false;
         }
     }
@@ -209,15 +215,8 @@ bool FixSessionManager::isMessageSupported(const FixMessage *message) const
         return false;
     }
 
-    std::string msg_type;
-    if (!message->getField(FixFields::MsgType, msg_type))
-    {
-        return false;
-    }
-
     // Check if it's a session-level message
-    return (msg_type == "A" || msg_type == "5" || msg_type == "0" ||
-            msg_type == "1" || msg_type == "2" || msg_type == "4" || msg_type == "3");
+    return FixMsgTypeUtils::isSessionMessage(message->getMsgTypeEnum());
 }
 
 std::vector<FixMsgType> FixSessionManager::getHandledMessageTypes() const
@@ -602,12 +601,7 @@ FixMessage *FixSessionManager::createLogonMessage()
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time - simplified format
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Logon-specific fields
     msg->setField(FixFields::HeartBtInt, std::to_string(config_.heartbeat_interval));
@@ -641,12 +635,7 @@ FixMessage *FixSessionManager::createLogoutMessage(const std::string &reason)
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Logout reason
     if (!reason.empty())
@@ -679,12 +668,7 @@ FixMessage *FixSessionManager::createHeartbeatMessage(const std::string &test_re
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Test request ID if this is a response
     if (!test_req_id.empty())
@@ -717,12 +701,7 @@ FixMessage *FixSessionManager::createTestRequestMessage()
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Generate unique test request ID
     std::string test_req_id = createTestRequestId();
@@ -754,12 +733,7 @@ FixMessage *FixSessionManager::createRejectMessage(int ref_seq_num, const std::s
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Reject-specific fields
     msg->setField(FixFields::RefSeqNum, std::to_string(ref_seq_num));
@@ -793,12 +767,7 @@ FixMessage *FixSessionManager::createSequenceResetMessage(int new_seq_num, bool
     msg->setField(FixFields::TargetCompID, std::string(config_.target_comp_id));
     msg->setField(FixFields::MsgSeqNum, std::to_string(getNextOutgoingSeqNum()));
 
-    // Sending time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream oss;
-    oss << std::put_time(std::gmtime(&time_t), "%Y%m%d-%H:%M:%S");
-    msg->setField(FixFields::SendingTime, oss.str());
+    // SendingTime (52) is stamped when the message is serialized
 
     // Sequence reset-specific fields
     msg->setField(FixFields::NewSeqNo, std::to_string(new_seq_num));
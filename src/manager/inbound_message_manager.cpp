@@ -49,6 +49,10 @@ void InboundMessageManager::stop()
     }
 
     running_.store(false);
+    if (inbound_queue_)
+    {
+        inbound_queue_->wakeConsumers(); // End a parked wait in processMessages()
+    }
     logInfo("InboundMessageManager stopped: " + manager_name_);
 }
 
@@ -86,23 +90,15 @@ void InboundMessageManager::processMessages()
     {
         FixMessage *message = nullptr;
 
-        // Poll inbound queue for messages
-        if (inbound_queue_->tryPop(message))
+        // Pop, or wait one round of the queue's wait strategy when it is empty
+        if (inbound_queue_->popWait(message) && message)
         {
-            if (message)
+            bool processed = processMessage(message);
+            if (!processed)
             {
-                bool processed = processMessage(message);
-                if (!processed)
-                {
-                    logWarning("Failed to process message");
-                }
+                logWarning("Failed to process message");
             }
         }
-        else
-        {
-            // No messages available - short sleep to prevent busy waiting
-            std::this_thread::sleep_for(std::chrono::microseconds(10));
-        }
     }
 
     logDebug("Message processing loop ended for " + manager_name_);
@@ -122,27 +118,8 @@ bool InboundMessageManager::processMessage(FixMessage *message)
     // Record processing start
     recordProcessingStart();
 
-    // Extract message type for logging and stats
-    std::string msg_type_str;
-    FixMsgType msg_type = FixMsgType::UNKNOWN;
-
-    if (message->getField(FixFields::MsgType, msg_type_str))
-    {
-        // Convert string to enum - simplified mapping
-        if (msg_type_str == "A")
-            msg_type = FixMsgType::LOGON;
-        else if (msg_type_str == "5")
-            msg_type = FixMsgType::LOGOUT;
-        else if (msg_type_str == "0")
-            msg_type = FixMsgType::HEARTBEAT;
-        else if (msg_type_str == "1")
-            msg_type = FixMsgType::TEST_REQUEST;
-        else if (msg_type_str == "D")
-            msg_type = FixMsgType::NEW_ORDER_SINGLE;
-        else if (msg_type_str == "F")
-            msg_type = FixMsgType::ORDER_CANCEL_REQUEST;
-        // Add more mappings as needed
-    }
+    // Message type for logging and stats (classified once, cached on the message)
+    FixMsgType msg_type = message->getMsgTypeEnum();
 
     bool success = false;
     bool routed = false;
@@ -160,7 +137,7 @@ bool InboundMessageManager::processMessage(FixMessage *message)
         // Check if this manager can handle the message
         if (!canHandleMessage(message))
         {
-            logWarning("Message type not supported by " + manager_name_ + ": " + msg_type_str);
+            logWarning("Message type not supported by " + manager_name_ + ": " + message->getMsgType());
             recordProcessingEnd(msg_type, false, false);
             return false;
         }
@@ -176,7 +153,7 @@ bool InboundMessageManager::processMessage(FixMessage *message)
         else
         {
             stats_.total_processing_errors++;
-            logError("Message handling failed for message type: " + msg_type_str);
+            logError("Message handling failed for message type: " + message->getMsgType());
         }
     }
     catch (const std::exception &e)
@@ -13,7 +13,7 @@ namespace fix_gateway::network
     using LockFreeQueue = fix_gateway::utils::LockFreeQueue<MessagePtr>;
     using TcpConnection = fix_gateway::network::TcpConnection;
 
-    // Constructor for mutex-based queue (Phase 2)
+    // Constructor for the multi-level priority scheduler
     AsyncSender::AsyncSender(std::shared_ptr<PriorityQueue> priority_queue,
                              std::shared_ptr<TcpConnection> tcp_connection)
         : priority_queue_(priority_queue),
@@ -78,6 +78,10 @@ namespace fix_gateway::network
     void AsyncSender::stop()
     {
         running_.store(false);
+        if (use_lockfree_queue_)
+        {
+            lockfree_queue_->wakeConsumers(); // Cut a parked wait round short
+        }
 
         if (sender_thread_.joinable())
         {
@@ -94,6 +98,10 @@ namespace fix_gateway::network
 
         shutdown_requested_.store(true);
         running_.store(false);
+        if (use_lockfree_queue_)
+        {
+            lockfree_queue_->wakeConsumers(); // Cut a parked wait round short
+        }
 
         // Wait for sender thread to finish with timeout
         if (sender_thread_.joinable())
@@ -168,11 +176,11 @@ namespace fix_gateway::network
         }
         else
         {
-            senderLoopMutex();
+            senderLoopScheduler();
         }
     }
 
-    void AsyncSender::senderLoopMutex()
+    void AsyncSender::senderLoopScheduler()
     {
         fix_gateway::common::MessagePtr message = nullptr;
 
@@ -195,7 +203,7 @@ namespace fix_gateway::network
             }
             catch (const std::exception &e)
             {
-                std::cerr << "AsyncSender error in mutex loop: " << e.what() << std::endl;
+                std::cerr << "AsyncSender error in scheduler loop: " << e.what() << std::endl;
                 // Continue running despite errors
             }
         }
@@ -219,22 +227,25 @@ namespace fix_gateway::network
     void AsyncSender::senderLoopLockFree()
     {
         fix_gateway::common::MessagePtr message = nullptr;
+        fix_gateway::common::MessagePtr batch[SEND_BATCH];
 
         while (running_.load())
         {
             try
             {
-                // Lock-free queue only supports tryPop - use busy wait with sleep
-                if (tryPopMessage(message))
+                // Drain a burst per index exchange; when empty, wait one round of
+                // the queue's wait strategy (spin / yield / park until a push)
+                size_t count = lockfree_queue_->popBulkWait(batch, SEND_BATCH);
+                for (size_t i = 0; i < count; ++i)
                 {
-                    sendMessage(message);
-                    message = nullptr;
-                }
-                else
-                {
-                    // No message available - sleep briefly to avoid busy waiting
-                    // This is much shorter than mutex timeout but still CPU-friendly
-                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    try
+                    {
+                        sendMessage(batch[i]);
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::cerr << "AsyncSender error in lock-free loop: " << e.what() << std::endl;
+                    }
                 }
 
                 // Check for shutdown request
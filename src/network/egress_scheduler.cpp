@@ -0,0 +1,246 @@
+#include "network/egress_scheduler.h"
+#include "utils/logger.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <sys/uio.h>
+
+namespace fix_gateway::network
+{
+    EgressScheduler::EgressScheduler(LaneArray lanes, std::shared_ptr<TcpConnection> tcp_connection,
+                                     const EgressConfig &config)
+        : lanes_(std::move(lanes)),
+          tcp_connection_(std::move(tcp_connection)),
+          config_(config),
+          wait_(config.idle_wait)
+    {
+        if (!tcp_connection_)
+        {
+            throw std::invalid_argument("TcpConnection cannot be null");
+        }
+
+        config_.batch_messages = std::clamp<size_t>(config_.batch_messages, 1, MAX_BATCH);
+        size_t shares = std::accumulate(config_.min_share.begin(), config_.min_share.end(), size_t{0});
+        if (shares >= config_.batch_messages)
+        {
+            LOG_WARN("EgressScheduler: lane shares (" + std::to_string(shares) + ") fill the whole batch of " +
+                     std::to_string(config_.batch_messages) + " - urgent lanes may be held back");
+        }
+
+        for (auto &lane : lanes_)
+        {
+            if (lane)
+            {
+                lane->shareWaitStrategy(&wait_);
+            }
+        }
+    }
+
+    EgressScheduler::~EgressScheduler()
+    {
+        stop();
+        for (auto &lane : lanes_)
+        {
+            if (lane)
+            {
+                lane->shareWaitStrategy(nullptr);
+            }
+        }
+    }
+
+    void EgressScheduler::start()
+    {
+        if (running_.load())
+        {
+            return; // Already running
+        }
+
+        running_.store(true);
+        scheduler_thread_ = std::thread(&EgressScheduler::schedulerLoop, this);
+    }
+
+    void EgressScheduler::stop()
+    {
+        running_.store(false);
+        wait_.wakeAll();
+
+        if (scheduler_thread_.joinable())
+        {
+            scheduler_thread_.join();
+        }
+    }
+
+    size_t EgressScheduler::selectBatch(MessagePtr *out, size_t max)
+    {
+        // Slots held for lanes that have messages, taken from what more urgent lanes may fill
+        std::array<size_t, LANE_COUNT> reserve{};
+        size_t reserved = 0;
+        for (size_t lane = 0; lane < LANE_COUNT; ++lane)
+        {
+            if (lanes_[lane] && config_.min_share[lane] > 0)
+            {
+                reserve[lane] = std::min<size_t>(config_.min_share[lane], lanes_[lane]->size());
+                reserved += reserve[lane];
+            }
+        }
+
+        size_t count = 0;
+        for (size_t lane = 0; lane < LANE_COUNT && count < max; ++lane)
+        {
+            if (!lanes_[lane])
+            {
+                continue;
+            }
+
+            reserved -= reserve[lane]; // Our own reserve is ours to fill
+            size_t free_slots = max - count;
+            size_t want = free_slots > reserved ? free_slots - reserved : 0;
+            if (want > 0)
+            {
+                count += lanes_[lane]->popBulk(out + count, want);
+            }
+        }
+        return count;
+    }
+
+    size_t EgressScheduler::drainOnce()
+    {
+        MessagePtr batch[MAX_BATCH];
+
+        size_t count = selectBatch(batch, config_.batch_messages);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        // Retry what is left unsent, in the selected order; a stopping
+        // scheduler makes one attempt only
+        size_t done = 0;
+        std::string error;
+        for (size_t attempt = 0; done < count; ++attempt)
+        {
+            if (attempt > 0)
+            {
+                if (attempt > config_.max_retries || !running_.load())
+                {
+                    break;
+                }
+                batch_retries_++;
+                std::this_thread::sleep_for(config_.retry_delay * attempt);
+            }
+
+            if (!tcp_connection_->isConnected())
+            {
+                error = "TCP connection is not available";
+                continue;
+            }
+
+            bool ok = false;
+            done += writeBatch(batch + done, count - done, ok);
+            if (!ok)
+            {
+                error = tcp_connection_->getLastError();
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i >= done)
+            {
+                messages_failed_++;
+                if (error_callback_)
+                {
+                    error_callback_(batch[i], "Max retries exceeded: " + error);
+                }
+            }
+            fix_gateway::common::Message::destroy(batch[i]);
+        }
+        return count;
+    }
+
+    size_t EgressScheduler::writeBatch(MessagePtr *batch, size_t count, bool &ok)
+    {
+        struct iovec iov[MAX_BATCH];
+        for (size_t i = 0; i < count; ++i)
+        {
+            const std::string &payload = batch[i]->getPayload();
+            iov[i].iov_base = const_cast<char *>(payload.data());
+            iov[i].iov_len = payload.size();
+        }
+
+        // One gather write for the whole batch; on failure only the messages
+        // written in full count as sent (sendv drops the connection if it cut one)
+        size_t written = 0;
+        ok = tcp_connection_->sendv(iov, count, &written);
+        if (ok)
+        {
+            batches_written_++;
+        }
+
+        messages_sent_ += written;
+        for (size_t i = 0; i < written; ++i)
+        {
+            size_t lane = std::min(static_cast<size_t>(batch[i]->getPriority()), LANE_COUNT - 1);
+            lane_sent_[lane]++;
+            bytes_sent_ += batch[i]->getPayload().size();
+        }
+        return written;
+    }
+
+    EgressStats EgressScheduler::getStats() const
+    {
+        EgressStats stats;
+        stats.messages_sent = messages_sent_.get();
+        stats.messages_failed = messages_failed_.get();
+        stats.batches_written = batches_written_.get();
+        stats.batch_retries = batch_retries_.get();
+        stats.bytes_sent = bytes_sent_.get();
+        for (size_t lane = 0; lane < LANE_COUNT; ++lane)
+        {
+            stats.lane_sent[lane] = lane_sent_[lane].get();
+        }
+        return stats;
+    }
+
+    size_t EgressScheduler::getQueueDepth() const
+    {
+        size_t depth = 0;
+        for (const auto &lane : lanes_)
+        {
+            depth += lane ? lane->size() : 0;
+        }
+        return depth;
+    }
+
+    void EgressScheduler::schedulerLoop()
+    {
+        while (running_.load())
+        {
+            if (drainOnce() == 0)
+            {
+                // Parks until a push to any lane (they all notify wait_) or stop()
+                wait_.waitFor([this]()
+                              { return anyLaneReady() || !running_.load(); });
+            }
+        }
+
+        // Write what is still queued
+        while (drainOnce() > 0)
+        {
+        }
+    }
+
+    bool EgressScheduler::anyLaneReady() const
+    {
+        for (const auto &lane : lanes_)
+        {
+            if (lane && !lane->empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace fix_gateway::network
@@ -6,6 +6,9 @@
 #include <fcntl.h>
 #include <netinet/tcp.h>
 #include <netdb.h>
+#include <poll.h>
+#include <algorithm>
+#include <climits>
 #include <cstring>
 #include <cerrno>
 #include <stdexcept>
@@ -149,11 +152,29 @@ namespace fix_gateway::network
 
     bool TcpConnection::handleConnectionResult(int result)
     {
+        // The socket is non-blocking by now, so the handshake usually completes
+        // asynchronously: wait for it to become writable and read the outcome
+        if (result < 0 && errno == EINPROGRESS)
+        {
+            struct pollfd pfd = {socket_fd_, POLLOUT, 0};
+            int error = 0;
+            socklen_t error_length = sizeof(error);
+            if (::poll(&pfd, 1, CONNECTION_TIMEOUT_MS) == 1 &&
+                getsockopt(socket_fd_, SOL_SOCKET, SO_ERROR, &error, &error_length) == 0 && error == 0)
+            {
+                result = 0;
+            }
+        }
+
         if (result < 0)
         {
             LOG_ERROR("Failed to connect to server");
+            ::close(socket_fd_);
+            socket_fd_ = INVALID_SOCKET;
             return false;
         }
+
+        connected_ = true;
         LOG_INFO("Connected to server successfully");
         return true;
     }
@@ -272,6 +293,112 @@ namespace fix_gateway::network
         return result;
     }
 
+    bool TcpConnection::sendv(struct iovec *iov, size_t count, size_t *written)
+    {
+        if (written)
+        {
+            *written = 0;
+        }
+
+        if (!connected_)
+        {
+            LOG_ERROR("Cannot send: not connected");
+            PERF_COUNTER_INC(CONNECTION_ERRORS);
+            return false;
+        }
+
+        if (socket_fd_ == INVALID_SOCKET)
+        {
+            LOG_ERROR("Invalid socket for sending");
+            return false;
+        }
+
+        size_t total_bytes = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            total_bytes += iov[i].iov_len;
+        }
+
+        size_t index = 0;
+        bool mid_entry = false; // iov[index] is partly written
+        while (index < count)
+        {
+            if (written)
+            {
+                *written = index;
+            }
+
+            struct msghdr msg = {};
+            msg.msg_iov = iov + index;
+            msg.msg_iovlen = std::min<size_t>(count - index, IOV_MAX);
+
+            // sendmsg() rather than writev() for MSG_NOSIGNAL
+            ssize_t result = ::sendmsg(socket_fd_, &msg, MSG_NOSIGNAL);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    struct pollfd pfd = {socket_fd_, POLLOUT, 0};
+                    if (::poll(&pfd, 1, SEND_TIMEOUT_MS) > 0)
+                    {
+                        continue;
+                    }
+                    LOG_ERROR("Send buffer stayed full during a batch write");
+                    PERF_COUNTER_INC(CONNECTION_ERRORS);
+                    abortPartialWrite(mid_entry);
+                    return false;
+                }
+                handleSocketError(errno);
+                PERF_COUNTER_INC(CONNECTION_ERRORS);
+                abortPartialWrite(mid_entry);
+                return false;
+            }
+
+            // Skip the entries written in full, trim the one written in part
+            size_t sent = static_cast<size_t>(result);
+            while (index < count && sent >= iov[index].iov_len)
+            {
+                sent -= iov[index].iov_len;
+                ++index;
+                mid_entry = false;
+            }
+            if (index < count && sent > 0)
+            {
+                iov[index].iov_base = static_cast<char *>(iov[index].iov_base) + sent;
+                iov[index].iov_len -= sent;
+                mid_entry = true;
+            }
+        }
+
+        if (written)
+        {
+            *written = count;
+        }
+
+        PERF_COUNTER_ADD(BYTES_SENT, total_bytes);
+        PERF_COUNTER_ADD(MESSAGES_SENT, count);
+        PERF_RATE_RECORD(SEND_RATE);
+        return true;
+    }
+
+    void TcpConnection::abortPartialWrite(bool mid_entry)
+    {
+        if (!mid_entry || !connected_)
+        {
+            return;
+        }
+
+        // The peer would read the next message glued to a truncated one
+        LOG_ERROR("Batch write failed mid-message - shutting the connection down");
+        onError("Partial message written");
+        ::shutdown(socket_fd_, SHUT_RDWR);
+        handleConnectionLost();
+    }
+
     bool TcpConnection::handlePartialSend(const void *data, size_t length, ssize_t bytesSent)
     {
         LOG_WARN("Partial send detected: " + std::to_string(bytesSent) + "/" + std::to_string(length) + " bytes sent");
@@ -360,6 +487,19 @@ namespace fix_gateway::network
         }
     }
 
+    void TcpConnection::onError(const std::string &errorMessage)
+    {
+        {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = errorMessage;
+        }
+
+        if (error_callback_)
+        {
+            error_callback_(errorMessage);
+        }
+    }
+
     void TcpConnection::startReceiveLoop()
     {
         if (receiving_)
@@ -382,69 +522,196 @@ namespace fix_gateway::network
     void TcpConnection::receiveLoop()
     {
         std::vector<char> buffer(BUFFER_SIZE);
+        common::ReceiveSegment *segment = nullptr;
 
         LOG_DEBUG("Entering receive loop");
 
+        uint32_t idle_rounds = 0;
+        std::chrono::steady_clock::time_point ring_full_since{};
+        bool ring_stall_reported = false;
         while (receiving_ && connected_)
         {
-            // Receive data from socket
-            ssize_t bytes_received = ::recv(socket_fd_, buffer.data(), buffer.size(), MSG_DONTWAIT);
-
-            if (bytes_received > 0)
+            // Zero-copy mode: read straight into a pinned segment the parser can reference
+            if (!segment && segment_pool_)
             {
-                // Got data - process it with timing
-                PERF_TIMER_START(receive_processing);
-
-                LOG_DEBUG("Received " + std::to_string(bytes_received) + " bytes");
-                onDataReceived(buffer.data(), bytes_received);
+                segment = segment_pool_->acquire();
+            }
 
-                PERF_TIMER_END(receive_processing);
+            ReceiveStatus status = receiveChunk(buffer, segment);
+            if (status != ReceiveStatus::RingFull)
+            {
+                ring_full_since = {};
+                ring_stall_reported = false;
+            }
 
-                // Record receive metrics
-                PERF_COUNTER_ADD(BYTES_RECEIVED, bytes_received);
-                PERF_COUNTER_INC(MESSAGES_RECEIVED);
-                PERF_RATE_RECORD(RECEIVE_RATE);
+            if (status == ReceiveStatus::WouldBlock)
+            {
+                // No data available right now - normal for non-blocking sockets
+                waitReadable(idle_rounds++);
             }
-            else if (bytes_received == 0)
+            else if (status == ReceiveStatus::Data)
             {
-                // Connection closed by peer
-                LOG_INFO("Connection closed by peer");
-                connected_ = false;
-                handleConnectionLost();
-                break;
+                idle_rounds = 0;
             }
-            else
+            else if (status == ReceiveStatus::RingFull)
             {
-                // Error occurred - use our centralized error handler
-                int error = errno;
-                handleSocketError(error);
-
-                // Check if we should continue based on the error type
-                if (error == EWOULDBLOCK || error == EAGAIN)
+                // A ring that stays full means the consumer cannot make progress
+                // (pool exhausted, stuck frame); report it once per stall
+                auto now = std::chrono::steady_clock::now();
+                if (ring_full_since == std::chrono::steady_clock::time_point{})
                 {
-                    // No data available right now - normal for non-blocking sockets
-                    // Sleep briefly to avoid busy waiting
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                    continue;
+                    ring_full_since = now;
                 }
-                else if (error == EINTR)
+                else if (!ring_stall_reported &&
+                         now - ring_full_since >= std::chrono::milliseconds(RING_STALL_TIMEOUT_MS))
                 {
-                    // Interrupted by signal - continue
-                    continue;
-                }
-                else
-                {
-                    // For all other errors (including connection lost), exit the loop
-                    // handleSocketError already handled state changes and callbacks
-                    break;
+                    ring_stall_reported = true;
+                    onError("Receive ring full for " + std::to_string(RING_STALL_TIMEOUT_MS) +
+                            " ms - consumer is not draining it");
                 }
+
+                // Socket is likely readable, so polling would not wait; give the
+                // consumer time to free ring space instead
+                std::this_thread::sleep_for(std::max(receive_wait_.park_timeout, std::chrono::microseconds(1)));
             }
+            else
+            {
+                // Peer closed or socket error - state changes and callbacks are done
+                break;
+            }
+        }
+
+        if (segment)
+        {
+            segment->release();
         }
 
         LOG_DEBUG("Exiting receive loop");
         receiving_ = false;
     }
 
+    void TcpConnection::waitReadable(uint32_t idle_rounds)
+    {
+        const utils::WaitConfig &wait = receive_wait_;
+        if (idle_rounds < wait.spin_iterations || wait.policy == utils::WaitPolicy::BusySpin)
+        {
+            utils::WaitStrategy::cpuRelax();
+            return;
+        }
+        if (idle_rounds - wait.spin_iterations < wait.yield_iterations || wait.policy == utils::WaitPolicy::SpinYield)
+        {
+            std::this_thread::yield();
+            return;
+        }
+
+        // Park in the kernel until the socket is readable (poll has ms resolution)
+        auto timeout_us = wait.park_timeout.count();
+        int timeout_ms = static_cast<int>(std::max<decltype(timeout_us)>(1, (timeout_us + 999) / 1000));
+        struct pollfd pfd = {socket_fd_, POLLIN, 0};
+        ::poll(&pfd, 1, timeout_ms);
+    }
+
+    TcpConnection::ReceiveStatus TcpConnection::receiveOnce()
+    {
+        if (!connected_)
+        {
+            return ReceiveStatus::Closed;
+        }
+
+        if (receive_buffer_.size() < BUFFER_SIZE)
+        {
+            receive_buffer_.resize(BUFFER_SIZE);
+        }
+
+        // Segment mode needs a segment held across reads - only receiveLoop() does that
+        common::ReceiveSegment *no_segment = nullptr;
+        return receiveChunk(receive_buffer_, no_segment);
+    }
+
+    TcpConnection::ReceiveStatus TcpConnection::receiveChunk(std::vector<char> &buffer, common::ReceiveSegment *&segment)
+    {
+        // Ring mode: append after the unconsumed tail, which stays in place
+        common::ReceiveRing *ring = segment_pool_ ? nullptr : receive_ring_;
+        if (ring && ring->writable() == 0)
+        {
+            // The consumer left a full ring (e.g. its message pool ran dry).
+            // Offer it the buffered bytes again; if it still cannot free space,
+            // stop reading so TCP flow control holds the peer back
+            onRingDataReceived(*ring);
+            if (ring->writable() == 0)
+            {
+                return ReceiveStatus::RingFull;
+            }
+        }
+
+        char *destination = segment ? segment->data() : (ring ? ring->writePtr() : buffer.data());
+        size_t capacity = segment ? segment->capacity() : (ring ? ring->writable() : buffer.size());
+
+        // Receive data from socket (retrying reads interrupted by a signal)
+        ssize_t bytes_received;
+        do
+        {
+            bytes_received = ::recv(socket_fd_, destination, capacity, MSG_DONTWAIT);
+        } while (bytes_received < 0 && errno == EINTR);
+
+        if (bytes_received > 0)
+        {
+            // Got data - process it with timing
+            PERF_TIMER_START(receive_processing);
+
+            LOG_DEBUG("Received " + std::to_string(bytes_received) + " bytes");
+            if (segment)
+            {
+                onSegmentReceived(segment, bytes_received);
+
+                // Still referenced by message views: leave it to them and
+                // read the next chunk into a fresh segment
+                if (segment->refCount() > 1)
+                {
+                    segment->release();
+                    segment = nullptr;
+                }
+            }
+            else if (ring)
+            {
+                ring->commit(static_cast<size_t>(bytes_received));
+                onRingDataReceived(*ring);
+            }
+            else
+            {
+                onDataReceived(buffer.data(), bytes_received);
+            }
+
+            PERF_TIMER_END(receive_processing);
+
+            // Record receive metrics
+            PERF_COUNTER_ADD(BYTES_RECEIVED, bytes_received);
+            PERF_COUNTER_INC(MESSAGES_RECEIVED);
+            PERF_RATE_RECORD(RECEIVE_RATE);
+            return ReceiveStatus::Data;
+        }
+
+        if (bytes_received == 0)
+        {
+            // Connection closed by peer
+            LOG_INFO("Connection closed by peer");
+            connected_ = false;
+            handleConnectionLost();
+            return ReceiveStatus::Closed;
+        }
+
+        int error = errno;
+        if (error == EWOULDBLOCK || error == EAGAIN)
+        {
+            return ReceiveStatus::WouldBlock;
+        }
+
+        // For all other errors (including connection lost), our centralized
+        // error handler does the state changes and callbacks
+        handleSocketError(error);
+        return connected_ ? ReceiveStatus::Error : ReceiveStatus::Closed;
+    }
+
     void TcpConnection::stopReceiveLoop()
     {
         if (!receiving_)
@@ -491,6 +758,60 @@ namespace fix_gateway::network
         }
     }
 
+    void TcpConnection::onSegmentReceived(common::ReceiveSegment *segment, size_t length)
+    {
+        {
+            std::lock_guard<std::mutex> lock(callback_mutex_);
+            if (segment_callback_)
+            {
+                try
+                {
+                    segment_callback_(segment, length);
+                }
+                catch (const std::exception &e)
+                {
+                    LOG_ERROR("Exception in segment callback: " + std::string(e.what()));
+                }
+                catch (...)
+                {
+                    LOG_ERROR("Unknown exception in segment callback");
+                }
+                return;
+            }
+        }
+
+        // No segment consumer - plain data callback still works
+        onDataReceived(segment->data(), length);
+    }
+
+    void TcpConnection::onRingDataReceived(common::ReceiveRing &ring)
+    {
+        {
+            std::lock_guard<std::mutex> lock(callback_mutex_);
+            if (ring_callback_)
+            {
+                try
+                {
+                    ring_callback_(ring);
+                }
+                catch (const std::exception &e)
+                {
+                    LOG_ERROR("Exception in ring callback: " + std::string(e.what()));
+                }
+                catch (...)
+                {
+                    LOG_ERROR("Unknown exception in ring callback");
+                }
+                return;
+            }
+        }
+
+        // No ring consumer - hand everything to the plain data callback
+        size_t length = ring.readable();
+        onDataReceived(ring.readPtr(), length);
+        ring.consume(length);
+    }
+
     void TcpConnection::handleConnectionLost()
     {
         LOG_WARN("Handling connection lost");
@@ -577,6 +898,8 @@ namespace fix_gateway::network
             data_callback_ = nullptr;
             error_callback_ = nullptr;
             disconnect_callback_ = nullptr;
+            segment_callback_ = nullptr;
+            ring_callback_ = nullptr;
         }
 
         LOG_DEBUG("TCP connection cleanup completed");
@@ -604,6 +927,35 @@ namespace fix_gateway::network
         LOG_DEBUG("Disconnect callback set");
     }
 
+    void TcpConnection::setSegmentCallback(SegmentCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        segment_callback_ = callback;
+        LOG_DEBUG("Segment callback set");
+    }
+
+    void TcpConnection::setRingCallback(RingCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        ring_callback_ = callback;
+        LOG_DEBUG("Ring callback set");
+    }
+
+    void TcpConnection::setReceiveSegmentPool(common::ReceiveSegmentPool *pool)
+    {
+        segment_pool_ = pool;
+    }
+
+    void TcpConnection::setReceiveRing(common::ReceiveRing *ring)
+    {
+        receive_ring_ = ring;
+    }
+
+    void TcpConnection::setReceiveWait(const utils::WaitConfig &config)
+    {
+        receive_wait_ = config;
+    }
+
     // Connection info getters
     std::string TcpConnection::getRemoteHost() const
     {
@@ -1,5 +1,6 @@
 #include "protocol/fix_builder.h"
 #include "protocol/fix_fields.h"
+#include "protocol/fix_checksum.h"
 #include "utils/logger.h"
 #include "utils/performance_timer.h"
 #include <sstream>
@@ -147,7 +148,16 @@ namespace fix_gateway::protocol
             workingMessage.updateLengthAndChecksum();
         }
 
-        return workingMessage.toString();
+        // Serialize header + body once and append the trailer directly - the
+        // working copy is discarded, so FixMessage's string cache is not needed
+        std::string wire = workingMessage.toStringWithoutChecksum();
+        std::string checksum = calculateChecksum(wire);
+
+        wire.reserve(wire.size() + FixChecksum::TRAILER_LENGTH);
+        wire.append("10=", 3);
+        wire.append(checksum);
+        wire.push_back(FIX_SOH);
+        return wire;
     }
 
     void FixBuilder::addStandardHeader(FixMessage &message, const std::string &msgType)
@@ -247,6 +257,24 @@ namespace fix_gateway::protocol
         return {};
     }
 
+    // =================================================================
+    // Utility Methods
+    // =================================================================
+
+    std::string FixBuilder::calculateChecksum(const std::string &message) const
+    {
+        char checksum[3];
+        FixChecksum::format(FixChecksum::compute(message.data(), message.size()), checksum);
+        return std::string(checksum, 3);
+    }
+
+    void FixBuilder::setScaledPrice(FixMessage &message, int tag, std::string_view symbol,
+                                    const FixDecimal &price) const
+    {
+        char buffer[FixDecimal::MAX_TEXT_LENGTH];
+        message.setField(tag, std::string_view(buffer, priceScales_.format(symbol, price, buffer)));
+    }
+
     // =================================================================
     // Performance Helpers
     // =================================================================
@@ -401,6 +429,38 @@ namespace fix_gateway::protocol
         return buildMessage(message);
     }
 
+    std::string FixBuilder::buildNewOrderSingle(const std::string &clOrdID,
+                                                const std::string &symbol,
+                                                const std::string &side,
+                                                const FixDecimal &orderQty,
+                                                const FixDecimal &price,
+                                                const std::string &orderType,
+                                                const std::string &timeInForce,
+                                                const std::string &account)
+    {
+        FixMessage message;
+        message.setField(FixFields::MsgType, std::string_view(MsgTypes::NewOrderSingle));
+        message.setField(FixFields::ClOrdID, clOrdID);
+        message.setField(FixFields::Symbol, symbol);
+        message.setField(FixFields::Side, side);
+        message.setField(FixFields::OrderQty, orderQty);
+        message.setField(FixFields::OrdType, orderType);
+
+        if (orderType == OrderType::Limit || orderType == OrderType::StopLimit)
+        {
+            setScaledPrice(message, FixFields::Price, symbol, price);
+        }
+
+        message.setField(FixFields::TimeInForce, timeInForce);
+
+        if (!account.empty())
+        {
+            message.setField(FixFields::Account, account);
+        }
+
+        return buildMessage(message);
+    }
+
     std::string FixBuilder::buildExecutionReport(const std::string &orderID,
                                                  const std::string &execID,
                                                  const std::string &execType,
@@ -466,6 +526,12 @@ namespace fix_gateway::protocol
         return *this;
     }
 
+    FixBuilder::MessageBuilder &FixBuilder::MessageBuilder::setField(int tag, const FixDecimal &value)
+    {
+        message_.setField(tag, value);
+        return *this;
+    }
+
     FixBuilder::MessageBuilder &FixBuilder::MessageBuilder::setClOrdID(const std::string &clOrdID)
     {
         return setField(FixFields::ClOrdID, clOrdID);
@@ -491,6 +557,19 @@ namespace fix_gateway::protocol
         return setField(FixFields::Price, price);
     }
 
+    FixBuilder::MessageBuilder &FixBuilder::MessageBuilder::setOrderQty(const FixDecimal &qty)
+    {
+        return setField(FixFields::OrderQty, qty);
+    }
+
+    FixBuilder::MessageBuilder &FixBuilder::MessageBuilder::setPrice(const FixDecimal &price)
+    {
+        std::string_view symbol;
+        message_.getField(FixFields::Symbol, symbol);
+        parent_.setScaledPrice(message_, FixFields::Price, symbol, price);
+        return *this;
+    }
+
     FixBuilder::MessageBuilder &FixBuilder::MessageBuilder::setAccount(const std::string &account)
     {
         return setField(FixFields::Account, account);
@@ -0,0 +1,202 @@
+#include "protocol/fix_checksum.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define FIX_CHECKSUM_X86 1
+#endif
+
+namespace fix_gateway::protocol
+{
+    namespace
+    {
+        // =================================================================
+        // SCALAR KERNEL
+        // =================================================================
+
+        uint32_t byteSumScalar(const char *buffer, size_t length)
+        {
+            const unsigned char *p = reinterpret_cast<const unsigned char *>(buffer);
+            uint32_t sum = 0;
+            for (size_t i = 0; i < length; ++i)
+            {
+                sum += p[i];
+            }
+            return sum;
+        }
+
+#ifdef FIX_CHECKSUM_X86
+        // =================================================================
+        // SSE2 KERNEL - PSADBW against zero sums 16 bytes into two u64 lanes
+        // =================================================================
+
+        uint32_t byteSumSse2(const char *buffer, size_t length)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i acc0 = zero;
+            __m128i acc1 = zero;
+
+            size_t i = 0;
+            for (; i + 32 <= length; i += 32)
+            {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i + 16));
+                acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(a, zero));
+                acc1 = _mm_add_epi64(acc1, _mm_sad_epu8(b, zero));
+            }
+            if (i + 16 <= length)
+            {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+                acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(a, zero));
+                i += 16;
+            }
+
+            __m128i acc = _mm_add_epi64(acc0, acc1);
+            acc = _mm_add_epi64(acc, _mm_srli_si128(acc, 8));
+            return static_cast<uint32_t>(_mm_cvtsi128_si32(acc)) + byteSumScalar(buffer + i, length - i);
+        }
+
+        // =================================================================
+        // AVX2 KERNEL - VPSADBW, 32 bytes per instruction
+        // =================================================================
+
+        __attribute__((target("avx2"))) uint32_t byteSumAvx2(const char *buffer, size_t length)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i acc0 = zero;
+            __m256i acc1 = zero;
+
+            size_t i = 0;
+            for (; i + 64 <= length; i += 64)
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer + i + 32));
+                acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+                acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(b, zero));
+            }
+            if (i + 32 <= length)
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer + i));
+                acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(a, zero));
+                i += 32;
+            }
+
+            __m256i acc256 = _mm256_add_epi64(acc0, acc1);
+            __m128i acc = _mm_add_epi64(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+            acc = _mm_add_epi64(acc, _mm_srli_si128(acc, 8));
+            uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(acc));
+
+            // Remaining < 32 bytes: one SSE step, then scalar
+            if (i + 16 <= length)
+            {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+                __m128i s = _mm_sad_epu8(a, _mm_setzero_si128());
+                s = _mm_add_epi64(s, _mm_srli_si128(s, 8));
+                sum += static_cast<uint32_t>(_mm_cvtsi128_si32(s));
+                i += 16;
+            }
+            return sum + byteSumScalar(buffer + i, length - i);
+        }
+#endif
+
+        using ByteSumFn = uint32_t (*)(const char *, size_t);
+
+        ByteSumFn kernelFunction(FixChecksum::Kernel kernel)
+        {
+            switch (kernel)
+            {
+#ifdef FIX_CHECKSUM_X86
+            case FixChecksum::Kernel::AVX2:
+                return byteSumAvx2;
+            case FixChecksum::Kernel::SSE2:
+                return byteSumSse2;
+#endif
+            default:
+                return byteSumScalar;
+            }
+        }
+
+        // Same kernel the tokenizer runs with - resolved once at load time
+        const ByteSumFn g_byte_sum = kernelFunction(FixTokenizer::activeKernel());
+    }
+
+    uint32_t FixChecksum::byteSum(const char *buffer, size_t length)
+    {
+        if (!buffer || length == 0)
+        {
+            return 0;
+        }
+        return g_byte_sum(buffer, length);
+    }
+
+    uint32_t FixChecksum::byteSumWith(Kernel kernel, const char *buffer, size_t length)
+    {
+        if (!buffer || length == 0)
+        {
+            return 0;
+        }
+        if (!FixTokenizer::isKernelSupported(kernel))
+        {
+            kernel = Kernel::SCALAR;
+        }
+        return kernelFunction(kernel)(buffer, length);
+    }
+
+    bool FixChecksum::validate(const char *message, size_t length)
+    {
+        if (!message || length < TRAILER_LENGTH)
+        {
+            return false;
+        }
+
+        const char *trailer = message + length - TRAILER_LENGTH;
+        if (trailer[0] != '1' || trailer[1] != '0' || trailer[2] != '=' || trailer[6] != '\001')
+        {
+            return false;
+        }
+
+        uint8_t received = 0;
+        if (!parse(trailer + 3, received))
+        {
+            return false;
+        }
+
+        return compute(message, length - TRAILER_LENGTH) == received;
+    }
+
+    bool FixChecksum::validateBodyLength(const char *message, size_t length)
+    {
+        if (!message || length < TRAILER_LENGTH)
+        {
+            return false;
+        }
+
+        // "8=...<SOH>" then "9=<digits><SOH>"
+        const char *end = message + length - TRAILER_LENGTH;
+        const char *p = static_cast<const char *>(std::memchr(message, '\001', static_cast<size_t>(end - message)));
+        if (!p || end - p < 4 || p[1] != '9' || p[2] != '=')
+        {
+            return false;
+        }
+
+        size_t declared = 0;
+        size_t digits = 0;
+        for (p += 3; p < end && *p != '\001'; ++p, ++digits)
+        {
+            unsigned digit = static_cast<unsigned char>(*p) - '0';
+            if (digit > 9 || digits == 9)
+            {
+                return false;
+            }
+            declared = declared * 10 + digit;
+        }
+        if (p == end || digits == 0)
+        {
+            return false;
+        }
+
+        const char *body_start = p + 1;
+        return static_cast<size_t>(end - body_start) == declared && end[0] == '1' && end[1] == '0' && end[2] == '=';
+    }
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,44 @@
+#include "protocol/fix_decimal.h"
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // PRICE SCALE TABLE
+    // =================================================================
+
+    void PriceScaleTable::setScale(std::string_view symbol, uint8_t scale)
+    {
+        if (scale > FixDecimal::MAX_SCALE)
+        {
+            scale = FixDecimal::MAX_SCALE;
+        }
+
+        auto it = scales_.find(symbol);
+        if (it != scales_.end())
+        {
+            it->second = scale;
+        }
+        else
+        {
+            scales_.emplace(std::string(symbol), scale);
+        }
+    }
+
+    uint8_t PriceScaleTable::scaleFor(std::string_view symbol) const
+    {
+        auto it = scales_.find(symbol);
+        return it != scales_.end() ? it->second : default_scale_;
+    }
+
+    size_t PriceScaleTable::format(std::string_view symbol, FixDecimal value, char *out) const
+    {
+        // Keep the value's own scale if the tick precision would overflow it
+        uint8_t scale = scaleFor(symbol);
+        if (scale != KEEP_SCALE)
+        {
+            value.rescale(scale);
+        }
+        return value.format(out);
+    }
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,579 @@
+#include "protocol/fix_field_store.h"
+#include <string>
+
+namespace fix_gateway::protocol
+{
+    // =================================================================
+    // CONSTRUCTION / COPY / MOVE
+    // =================================================================
+
+    FixFieldStore::FixFieldStore() noexcept
+        : entries_(inline_entries_),
+          arena_(inline_arena_),
+          cells_(inline_cells_)
+    {
+        std::memset(direct_index_, 0, sizeof(direct_index_));
+    }
+
+    FixFieldStore::FixFieldStore(const FixFieldStore &other)
+        : FixFieldStore()
+    {
+        copyFrom(other);
+    }
+
+    FixFieldStore::FixFieldStore(FixFieldStore &&other) noexcept
+        : FixFieldStore()
+    {
+        *this = std::move(other);
+    }
+
+    FixFieldStore &FixFieldStore::operator=(const FixFieldStore &other)
+    {
+        if (this != &other)
+        {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    FixFieldStore &FixFieldStore::operator=(FixFieldStore &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+
+        // Spilled buffers change owner; inline buffers are copied
+        if (other.entries_ != other.inline_entries_)
+        {
+            heap_entries_ = std::move(other.heap_entries_);
+            entries_ = heap_entries_.get();
+            entry_capacity_ = other.entry_capacity_;
+        }
+        else
+        {
+            std::memcpy(entries_, other.entries_, other.count_ * sizeof(Entry));
+        }
+
+        if (other.arena_ != other.inline_arena_)
+        {
+            heap_arena_ = std::move(other.heap_arena_);
+            arena_ = heap_arena_.get();
+            arena_capacity_ = other.arena_capacity_;
+        }
+        else
+        {
+            std::memcpy(arena_, other.arena_, other.arena_used_);
+        }
+
+        if (other.cells_ != other.inline_cells_)
+        {
+            heap_cells_ = std::move(other.heap_cells_);
+            cells_ = heap_cells_.get();
+            cell_capacity_ = other.cell_capacity_;
+        }
+        else
+        {
+            std::memcpy(cells_, other.cells_, other.cells_used_ * sizeof(uint32_t));
+        }
+
+        count_ = other.count_;
+        arena_used_ = other.arena_used_;
+        external_base_ = other.external_base_;
+        std::memcpy(groups_, other.groups_, other.group_count_ * sizeof(GroupInfo));
+        group_count_ = other.group_count_;
+        open_group_ = other.open_group_;
+        cells_used_ = other.cells_used_;
+        for (size_t i = 0; i < count_; ++i)
+        {
+            indexEntry(i);
+        }
+
+        // Leave the source empty on its inline buffers
+        other.clear();
+        other.heap_entries_.reset();
+        other.heap_arena_.reset();
+        other.heap_cells_.reset();
+        other.entries_ = other.inline_entries_;
+        other.arena_ = other.inline_arena_;
+        other.cells_ = other.inline_cells_;
+        other.entry_capacity_ = INLINE_FIELDS;
+        other.arena_capacity_ = INLINE_ARENA_SIZE;
+        other.cell_capacity_ = INLINE_GROUP_CELLS;
+
+        return *this;
+    }
+
+    void FixFieldStore::copyFrom(const FixFieldStore &other)
+    {
+        clear();
+        reserveEntries(other.count_);
+        reserveArena(other.arena_used_);
+        reserveCells(other.cells_used_);
+
+        std::memcpy(entries_, other.entries_, other.count_ * sizeof(Entry));
+        std::memcpy(arena_, other.arena_, other.arena_used_);
+        std::memcpy(cells_, other.cells_, other.cells_used_ * sizeof(uint32_t));
+        std::memcpy(groups_, other.groups_, other.group_count_ * sizeof(GroupInfo));
+        count_ = other.count_;
+        arena_used_ = other.arena_used_;
+        external_base_ = other.external_base_;
+        cells_used_ = other.cells_used_;
+        group_count_ = other.group_count_;
+        open_group_ = other.open_group_;
+
+        for (size_t i = 0; i < count_; ++i)
+        {
+            indexEntry(i);
+        }
+    }
+
+    // =================================================================
+    // MODIFICATION
+    // =================================================================
+
+    void FixFieldStore::set(int tag, std::string_view value)
+    {
+        const uint32_t length = static_cast<uint32_t>(value.size());
+        Entry *entry = const_cast<Entry *>(findEntry(tag));
+
+        // Overwrite in place when the new value fits the old arena slot
+        if (entry && !isExternal(*entry) && length <= entry->length)
+        {
+            std::memmove(arena_ + entry->offset, value.data(), length);
+            entry->length = length;
+            return;
+        }
+
+        if (!entry)
+        {
+            entry = appendEntry(tag);
+        }
+
+        // Longer value (or new field): append to the arena
+        entry->offset = copyToArena(value);
+        entry->length = length;
+    }
+
+    void FixFieldStore::setReference(int tag, std::string_view value)
+    {
+        Entry *entry = const_cast<Entry *>(findEntry(tag));
+        if (!entry)
+        {
+            entry = appendEntry(tag);
+        }
+
+        // A replaced arena value is reclaimed by the next compaction
+        entry->offset = static_cast<uint32_t>(value.data() - external_base_) | EXTERNAL_OFFSET;
+        entry->length = static_cast<uint32_t>(value.size());
+    }
+
+    bool FixFieldStore::erase(int tag)
+    {
+        // A count field cannot be dropped from under its group entries
+        const Entry *entry = findEntry(tag);
+        if (!entry || findGroup(tag))
+        {
+            return false;
+        }
+
+        // Preserve wire order: shift the tail down and re-index it.
+        // The value bytes are reclaimed by the next arena compaction.
+        size_t index = static_cast<size_t>(entry - entries_);
+        std::memmove(entries_ + index, entries_ + index + 1, (count_ - index - 1) * sizeof(Entry));
+        --count_;
+
+        if (static_cast<unsigned>(tag) < static_cast<unsigned>(DIRECT_INDEX_TAGS))
+        {
+            direct_index_[tag] = 0;
+        }
+        for (size_t i = index; i < count_; ++i)
+        {
+            indexEntry(i);
+        }
+
+        // Group cells hold entry index + 1 - follow the shift
+        for (size_t i = 0; i < cells_used_; ++i)
+        {
+            if (cells_[i] > index + 1)
+            {
+                --cells_[i];
+            }
+        }
+        return true;
+    }
+
+    void FixFieldStore::internalize()
+    {
+        if (!external_base_)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (isExternal(entries_[i]))
+            {
+                entries_[i].offset = copyToArena(view(entries_[i]));
+            }
+        }
+        external_base_ = nullptr;
+    }
+
+    // =================================================================
+    // REPEATING GROUPS
+    // =================================================================
+
+    bool FixFieldStore::beginGroup(const FixGroupDefinition *definition, uint32_t expected_entries)
+    {
+        if (!definition || inGroup() || group_count_ == MAX_GROUPS || findGroup(definition->count_tag))
+        {
+            return false;
+        }
+
+        GroupInfo &group = groups_[group_count_];
+        group.definition = definition;
+        group.expected = expected_entries;
+        group.entries = 0;
+        group.first_cell = cells_used_;
+        group.entry_start = count_;
+        open_group_ = static_cast<int>(group_count_++);
+        return true;
+    }
+
+    FixFieldStore::GroupAppend FixFieldStore::appendGroupField(int tag, std::string_view value, bool reference)
+    {
+        if (!inGroup())
+        {
+            return GroupAppend::NotMember;
+        }
+
+        GroupInfo &group = groups_[open_group_];
+        const int column = group.definition->column(tag);
+        if (column < 0)
+        {
+            if (group.entries == 0 || closesGroup(group, tag))
+            {
+                return endGroup() ? GroupAppend::NotMember : GroupAppend::Error;
+            }
+
+            // Extra field of the current entry: stored in wire order, no cell
+            const uint32_t offset = reference ? static_cast<uint32_t>(value.data() - external_base_) | EXTERNAL_OFFSET
+                                              : copyToArena(value);
+            Entry *entry = appendEntry(tag | GROUP_FIELD_FLAG);
+            entry->offset = offset;
+            entry->length = static_cast<uint32_t>(value.size());
+            return GroupAppend::Added;
+        }
+
+        const uint32_t columns = group.definition->member_count;
+        if (column == 0)
+        {
+            // Delimiter opens the next entry with an empty row of cells
+            if (group.entries == group.expected)
+            {
+                return GroupAppend::Error;
+            }
+            reserveCells(cells_used_ + columns);
+            std::memset(cells_ + cells_used_, 0, columns * sizeof(uint32_t));
+            cells_used_ += columns;
+            group.entries++;
+            group.entry_start = count_;
+        }
+        else if (group.entries == 0)
+        {
+            return GroupAppend::Error;
+        }
+
+        uint32_t &cell = cells_[group.first_cell + (group.entries - 1) * columns + static_cast<uint32_t>(column)];
+        if (cell != 0)
+        {
+            return GroupAppend::Error;
+        }
+
+        const uint32_t offset = reference ? static_cast<uint32_t>(value.data() - external_base_) | EXTERNAL_OFFSET
+                                          : copyToArena(value);
+        Entry *entry = appendEntry(tag | GROUP_FIELD_FLAG);
+        entry->offset = offset;
+        entry->length = static_cast<uint32_t>(value.size());
+        cell = count_; // Index of the new entry + 1
+        return GroupAppend::Added;
+    }
+
+    bool FixFieldStore::endGroup()
+    {
+        if (!inGroup())
+        {
+            return true;
+        }
+
+        const GroupInfo &group = groups_[open_group_];
+        open_group_ = -1;
+        return group.entries == group.expected;
+    }
+
+    size_t FixFieldStore::groupEntryCount(int count_tag) const
+    {
+        const GroupInfo *group = findGroup(count_tag);
+        return group ? group->entries : 0;
+    }
+
+    bool FixFieldStore::getGroupField(int count_tag, size_t index, int tag, std::string_view &value) const
+    {
+        const GroupInfo *group = findGroup(count_tag);
+        if (!group || index >= group->entries)
+        {
+            return false;
+        }
+
+        const int column = group->definition->column(tag);
+        if (column < 0)
+        {
+            const Entry *extra = findExtraField(*group, index, tag);
+            if (!extra)
+            {
+                return false;
+            }
+            value = view(*extra);
+            return true;
+        }
+
+        const uint32_t slot = cells_[group->first_cell + index * group->definition->member_count + column];
+        if (slot == 0)
+        {
+            return false;
+        }
+        value = view(entries_[slot - 1]);
+        return true;
+    }
+
+    void FixFieldStore::clear() noexcept
+    {
+        // Only touch the slots that are in use - cheaper than a full memset
+        for (size_t i = 0; i < count_; ++i)
+        {
+            int tag = entries_[i].tag;
+            if (static_cast<unsigned>(tag) < static_cast<unsigned>(DIRECT_INDEX_TAGS))
+            {
+                direct_index_[tag] = 0;
+            }
+        }
+        count_ = 0;
+        arena_used_ = 0;
+        external_base_ = nullptr;
+        group_count_ = 0;
+        open_group_ = -1;
+        cells_used_ = 0;
+    }
+
+    // =================================================================
+    // INTERNAL HELPERS
+    // =================================================================
+
+    const FixFieldStore::Entry *FixFieldStore::scan(int tag) const
+    {
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (entries_[i].tag == tag)
+            {
+                return &entries_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    const FixFieldStore::GroupInfo *FixFieldStore::findGroup(int count_tag) const
+    {
+        for (size_t i = 0; i < group_count_; ++i)
+        {
+            if (groups_[i].definition->count_tag == count_tag)
+            {
+                return &groups_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    bool FixFieldStore::closesGroup(const GroupInfo &group, int tag) const
+    {
+        if (!FixGroups::canBelongToEntry(tag) || findEntry(tag))
+        {
+            return true;
+        }
+        if (group.entries < group.expected)
+        {
+            return false;
+        }
+
+        // Declared count complete: the tag belongs to the last entry only if an
+        // earlier entry carried it too and this one does not hold it yet
+        const int flagged = tag | GROUP_FIELD_FLAG;
+        bool seen_before = false;
+        for (size_t i = cells_[group.first_cell] - 1; i < count_; ++i)
+        {
+            if (entries_[i].tag == flagged)
+            {
+                if (i >= group.entry_start)
+                {
+                    return true;
+                }
+                seen_before = true;
+            }
+        }
+        return !seen_before;
+    }
+
+    const FixFieldStore::Entry *FixFieldStore::findExtraField(const GroupInfo &group, size_t index, int tag) const
+    {
+        // An entry runs from its delimiter to the next delimiter (or the end
+        // of the group's fields); extra fields have no cell, so scan that span
+        const uint32_t columns = group.definition->member_count;
+        const uint32_t delimiter = cells_[group.first_cell + index * columns];
+        if (delimiter == 0)
+        {
+            return nullptr;
+        }
+
+        const int flagged = tag | GROUP_FIELD_FLAG;
+        const int delimiter_tag = group.definition->delimiter() | GROUP_FIELD_FLAG;
+        for (size_t i = delimiter; i < count_; ++i)
+        {
+            const int entry_tag = entries_[i].tag;
+            if (entry_tag == delimiter_tag || !(entry_tag & GROUP_FIELD_FLAG))
+            {
+                break;
+            }
+            if (entry_tag == flagged)
+            {
+                return &entries_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    uint32_t FixFieldStore::copyToArena(std::string_view value)
+    {
+        const uint32_t length = static_cast<uint32_t>(value.size());
+
+        // A value viewing our own arena would dangle if the arena grows
+        std::string aliased;
+        if (arena_used_ + length > arena_capacity_ &&
+            value.data() >= arena_ && value.data() < arena_ + arena_capacity_)
+        {
+            aliased.assign(value.data(), value.size());
+            value = aliased;
+        }
+
+        reserveArena(length);
+        const uint32_t offset = arena_used_;
+        std::memcpy(arena_ + offset, value.data(), length);
+        arena_used_ += length;
+        return offset;
+    }
+
+    FixFieldStore::Entry *FixFieldStore::appendEntry(int tag)
+    {
+        reserveEntries(count_ + 1);
+        Entry *entry = &entries_[count_];
+        entry->tag = tag;
+        entry->offset = 0;
+        entry->length = 0;
+        indexEntry(count_++);
+        return entry;
+    }
+
+    void FixFieldStore::indexEntry(size_t index)
+    {
+        int tag = entries_[index].tag;
+        if (static_cast<unsigned>(tag) < static_cast<unsigned>(DIRECT_INDEX_TAGS))
+        {
+            direct_index_[tag] = (index + 1 < SLOT_OVERFLOW) ? static_cast<uint8_t>(index + 1) : SLOT_OVERFLOW;
+        }
+    }
+
+    void FixFieldStore::reserveEntries(size_t needed)
+    {
+        if (needed <= entry_capacity_)
+        {
+            return;
+        }
+
+        size_t capacity = entry_capacity_;
+        while (capacity < needed)
+        {
+            capacity *= 2;
+        }
+
+        std::unique_ptr<Entry[]> grown(new Entry[capacity]);
+        std::memcpy(grown.get(), entries_, count_ * sizeof(Entry));
+        heap_entries_ = std::move(grown);
+        entries_ = heap_entries_.get();
+        entry_capacity_ = static_cast<uint32_t>(capacity);
+    }
+
+    void FixFieldStore::reserveCells(size_t needed)
+    {
+        if (needed <= cell_capacity_)
+        {
+            return;
+        }
+
+        size_t capacity = cell_capacity_;
+        while (capacity < needed)
+        {
+            capacity *= 2;
+        }
+
+        std::unique_ptr<uint32_t[]> grown(new uint32_t[capacity]);
+        std::memcpy(grown.get(), cells_, cells_used_ * sizeof(uint32_t));
+        heap_cells_ = std::move(grown);
+        cells_ = heap_cells_.get();
+        cell_capacity_ = static_cast<uint32_t>(capacity);
+    }
+
+    void FixFieldStore::reserveArena(size_t extra)
+    {
+        if (arena_used_ + extra <= arena_capacity_)
+        {
+            return;
+        }
+
+        // Grow and compact in one copy - drops bytes left behind by
+        // overwrites and erases
+        size_t live = 0;
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (!isExternal(entries_[i]))
+            {
+                live += entries_[i].length;
+            }
+        }
+
+        size_t capacity = arena_capacity_;
+        while (capacity < live + extra)
+        {
+            capacity *= 2;
+        }
+
+        std::unique_ptr<char[]> grown(new char[capacity]);
+        uint32_t used = 0;
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (isExternal(entries_[i]))
+            {
+                continue;
+            }
+            std::memcpy(grown.get() + used, arena_ + entries_[i].offset, entries_[i].length);
+            entries_[i].offset = used;
+            used += entries_[i].length;
+        }
+
+        heap_arena_ = std::move(grown);
+        arena_ = heap_arena_.get();
+        arena_capacity_ = static_cast<uint32_t>(capacity);
+        arena_used_ = used;
+    }
+
+} // namespace fix_gateway::protocol
@@ -6,53 +6,49 @@ namespace fix_gateway::protocol
 {
     namespace FixMsgTypeUtils
     {
+        namespace
+        {
+            constexpr std::array<FixMsgType, MSG_TYPE_CODE_SPACE> buildMsgTypeTable()
+            {
+                std::array<FixMsgType, MSG_TYPE_CODE_SPACE> table{};
+                for (size_t code = 0; code < MSG_TYPE_CODE_SPACE; ++code)
+                    table[code] = FixMsgType::UNKNOWN;
+
+                for (size_t i = 0; i + 1 < MSG_TYPE_COUNT; ++i)
+                {
+                    const char *msgTypeStr = toString(static_cast<FixMsgType>(i));
+                    table[msgTypeCode(msgTypeStr[0], msgTypeStr[1])] = static_cast<FixMsgType>(i);
+                }
+                return table;
+            }
+        }
+
+        constexpr std::array<FixMsgType, MSG_TYPE_CODE_SPACE> MSG_TYPE_BY_CODE = buildMsgTypeTable();
+
         FixMsgType fromString(const char *msgTypeStr)
         {
-            if (!msgTypeStr)
+            if (!msgTypeStr || msgTypeStr[0] == '\0')
                 return FixMsgType::UNKNOWN;
 
-            // Ultra-fast single/double character comparisons (no strlen needed)
-            // Session messages
-            if (msgTypeStr[0] == '0' && msgTypeStr[1] == '\0')
-                return FixMsgType::HEARTBEAT;
-            if (msgTypeStr[0] == '1' && msgTypeStr[1] == '\0')
-                return FixMsgType::TEST_REQUEST;
-            if (msgTypeStr[0] == '2' && msgTypeStr[1] == '\0')
-                return FixMsgType::RESEND_REQUEST;
-            if (msgTypeStr[0] == '3' && msgTypeStr[1] == '\0')
-                return FixMsgType::REJECT;
-            if (msgTypeStr[0] == '4' && msgTypeStr[1] == '\0')
-                return FixMsgType::SEQUENCE_RESET;
-            if (msgTypeStr[0] == '5' && msgTypeStr[1] == '\0')
-                return FixMsgType::LOGOUT;
-            if (msgTypeStr[0] == 'A' && msgTypeStr[1] == '\0')
-                return FixMsgType::LOGON;
+            if (msgTypeStr[1] == '\0')
+                return fromCode(msgTypeCode(msgTypeStr[0]));
 
-            // Business messages
-            if (msgTypeStr[0] == '8' && msgTypeStr[1] == '\0')
-                return FixMsgType::EXECUTION_REPORT;
-            if (msgTypeStr[0] == '9' && msgTypeStr[1] == '\0')
-                return FixMsgType::ORDER_CANCEL_REJECT;
-            if (msgTypeStr[0] == 'D' && msgTypeStr[1] == '\0')
-                return FixMsgType::NEW_ORDER_SINGLE;
-            if (msgTypeStr[0] == 'F' && msgTypeStr[1] == '\0')
-                return FixMsgType::ORDER_CANCEL_REQUEST;
-            if (msgTypeStr[0] == 'G' && msgTypeStr[1] == '\0')
-                return FixMsgType::ORDER_CANCEL_REPLACE_REQUEST;
-            if (msgTypeStr[0] == 'H' && msgTypeStr[1] == '\0')
-                return FixMsgType::ORDER_STATUS_REQUEST;
-
-            // Market data messages
-            if (msgTypeStr[0] == 'V' && msgTypeStr[1] == '\0')
-                return FixMsgType::MARKET_DATA_REQUEST;
-            if (msgTypeStr[0] == 'W' && msgTypeStr[1] == '\0')
-                return FixMsgType::MARKET_DATA_SNAPSHOT;
-            if (msgTypeStr[0] == 'X' && msgTypeStr[1] == '\0')
-                return FixMsgType::MARKET_DATA_INCREMENTAL_REFRESH;
-            if (msgTypeStr[0] == 'Y' && msgTypeStr[1] == '\0')
-                return FixMsgType::MARKET_DATA_REQUEST_REJECT;
+            return msgTypeStr[2] == '\0' ? fromCode(msgTypeCode(msgTypeStr[0], msgTypeStr[1]))
+                                         : FixMsgType::UNKNOWN;
+        }
 
-            return FixMsgType::UNKNOWN;
+        FixMsgType fromString(std::string_view msgType)
+        {
+            // MsgType codes are one or two characters
+            switch (msgType.size())
+            {
+            case 1:
+                return fromCode(msgTypeCode(msgType[0]));
+            case 2:
+                return fromCode(msgTypeCode(msgType[0], msgType[1]));
+            default:
+                return FixMsgType::UNKNOWN;
+            }
         }
     }
 } // namespace fix_gateway::protocol
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "protocol/fix_groups.h"
+
+namespace fix_gateway::protocol
+{
+    namespace
+    {
+        using namespace FixFields;
+
+        // MarketDataSnapshotFullRefresh (W): Symbol is in the body, not the entry
+        constexpr FixGroupDefinition kSnapshotMDEntries = {
+            NoMDEntries, 5, {MDEntryType, MDEntryPx, MDEntrySize, MDEntryTime, MDEntryID}};
+
+        // MarketDataIncrementalRefresh (X): each entry names its action and instrument
+        constexpr FixGroupDefinition kIncrementalMDEntries = {
+            NoMDEntries, 7, {MDUpdateAction, MDEntryType, MDEntryID, Symbol, MDEntryPx, MDEntrySize, MDEntryTime}};
+
+        // MarketDataRequest (V)
+        constexpr FixGroupDefinition kRequestMDEntryTypes = {NoMDEntryTypes, 1, {MDEntryType}};
+        constexpr FixGroupDefinition kRequestRelatedSym = {NoRelatedSym, 1, {Symbol}};
+    }
+
+    namespace FixGroups
+    {
+        bool hasGroups(FixMsgType msgType)
+        {
+            return msgType == FixMsgType::MARKET_DATA_SNAPSHOT ||
+                   msgType == FixMsgType::MARKET_DATA_INCREMENTAL_REFRESH ||
+                   msgType == FixMsgType::MARKET_DATA_REQUEST;
+        }
+
+        const FixGroupDefinition *find(FixMsgType msgType, int count_tag)
+        {
+            switch (msgType)
+            {
+            case FixMsgType::MARKET_DATA_SNAPSHOT:
+                return count_tag == NoMDEntries ? &kSnapshotMDEntries : nullptr;
+            case FixMsgType::MARKET_DATA_INCREMENTAL_REFRESH:
+                return count_tag == NoMDEntries ? &kIncrementalMDEntries : nullptr;
+            case FixMsgType::MARKET_DATA_REQUEST:
+                if (count_tag == NoMDEntryTypes)
+                    return &kRequestMDEntryTypes;
+                return count_tag == NoRelatedSym ? &kRequestRelatedSym : nullptr;
+            default:
+                return nullptr;
+            }
+        }
+
+        bool canBelongToEntry(int tag)
+        {
+            switch (tag)
+            {
+            case BeginString:
+            case BodyLength:
+            case MsgType:
+            case MsgSeqNum:
+            case SenderCompID:
+            case TargetCompID:
+            case SenderSubID:
+            case SendingTime:
+            case PossDupFlag:
+            case PossResend:
+            case OrigSendingTime:
+            case 57:  // TargetSubID
+            case 115: // OnBehalfOfCompID
+            case 128: // DeliverToCompID
+            case CheckSum:
+            case 89: // Signature
+            case 93: // SignatureLength
+                return false;
+            default:
+                return true;
+            }
+        }
+    }
+
+} // namespace fix_gateway::protocol
@@ -1,24 +1,31 @@
 #include "protocol/fix_message.h"
 #include "protocol/fix_fields.h"
+#include "protocol/fix_checksum.h"
 #include "common/message_pool.h"
+#include "common/receive_segment.h"
 #include "utils/fast_string_conversion.h"
+#include "utils/performance_timer.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <memory>
 
 namespace fix_gateway::protocol
 {
     using FastStringConversion = fix_gateway::utils::FastStringConversion;
+    using PerformanceTimer = fix_gateway::utils::PerformanceTimer;
 
     // Constructor implementations
     FixMessage::FixMessage()
-        : creationTime_(std::chrono::steady_clock::now()),
-          lastModified_(creationTime_)
+        : lastModifiedTsc_(PerformanceTimer::readTsc())
     {
-        // Initialize with current timestamp
-        setSendingTime();
+        ownHeader_.creation_tsc = lastModifiedTsc_;
+
+        // No SendingTime here - inbound messages bring their own, outbound
+        // ones are stamped when serialized
     }
 
     FixMessage::FixMessage(const std::string &rawMessage)
@@ -32,37 +39,78 @@ namespace fix_gateway::protocol
     }
 
     FixMessage::FixMessage(const FieldMap &fields)
-        : fields_(fields),
-          creationTime_(std::chrono::steady_clock::now()),
-          lastModified_(creationTime_)
+        : lastModifiedTsc_(PerformanceTimer::readTsc())
+    {
+        ownHeader_.creation_tsc = lastModifiedTsc_;
+        for (const auto &field : fields)
+        {
+            fields_.set(field.first, field.second);
+        }
+    }
+
+    FixMessage::~FixMessage()
+    {
+        releaseSegment();
+
+        // The pool's header entry now describes a free slot
+        if (header_ != &ownHeader_)
+        {
+            *header_ = FixMessageHeader();
+        }
+    }
+
+    void FixMessage::attachHeader(FixMessageHeader *header)
+    {
+        *header = *header_;
+        header->flags |= FixMessageHeader::LIVE;
+        header_ = header;
+    }
+
+    void FixMessage::copyHeaderFields(const FixMessageHeader &other)
     {
+        header_->session_id = other.session_id;
+        header_->creation_tsc = other.creation_tsc;
+        header_->processing_start_ns = other.processing_start_ns;
     }
 
     // Copy constructor
     FixMessage::FixMessage(const FixMessage &other)
         : fields_(other.fields_),
-          creationTime_(other.creationTime_),
-          lastModified_(std::chrono::steady_clock::now()),
-          processingStart_(other.processingStart_),
-          processingEnd_(other.processingEnd_)
+          segment_(other.segment_),
+          lastModifiedTsc_(PerformanceTimer::readTsc()),
+          processingEnd_(other.processingEnd_),
+          sendingTimeStamped_(other.sendingTimeStamped_)
     {
+        copyHeaderFields(*other.header_);
+
+        // A copied view shares the segment - it needs its own reference
+        if (segment_)
+        {
+            segment_->retain();
+        }
+
         // Cache is not copied - will be regenerated as needed
     }
 
     // Move constructor
     FixMessage::FixMessage(FixMessage &&other) noexcept
         : fields_(std::move(other.fields_)),
-          creationTime_(other.creationTime_),
-          lastModified_(other.lastModified_),
-          processingStart_(other.processingStart_),
-          processingEnd_(other.processingEnd_)
+          segment_(other.segment_),
+          lastModifiedTsc_(other.lastModifiedTsc_),
+          processingEnd_(other.processingEnd_),
+          sendingTimeStamped_(other.sendingTimeStamped_)
     {
+        copyHeaderFields(*other.header_);
+
         // Move cached data
         checksumValid_ = other.checksumValid_;
         lengthValid_ = other.lengthValid_;
         cachedString_ = std::move(other.cachedString_);
         stringCacheValid_ = other.stringCacheValid_;
 
+        // Segment reference moves with the fields
+        other.segment_ = nullptr;
+
         // Invalidate other's cache
         other.invalidateCache();
     }
@@ -72,10 +120,17 @@ namespace fix_gateway::protocol
     {
         if (this != &other)
         {
+            if (other.segment_)
+            {
+                other.segment_->retain();
+            }
+            releaseSegment();
+            segment_ = other.segment_;
+
             fields_ = other.fields_;
-            creationTime_ = other.creationTime_;
-            processingStart_ = other.processingStart_;
+            copyHeaderFields(*other.header_);
             processingEnd_ = other.processingEnd_;
+            sendingTimeStamped_ = other.sendingTimeStamped_;
             touchModified();
             invalidateCache();
         }
@@ -86,11 +141,15 @@ namespace fix_gateway::protocol
     {
         if (this != &other)
         {
+            releaseSegment();
+            segment_ = other.segment_;
+            other.segment_ = nullptr;
+
             fields_ = std::move(other.fields_);
-            creationTime_ = other.creationTime_;
-            lastModified_ = other.lastModified_;
-            processingStart_ = other.processingStart_;
+            copyHeaderFields(*other.header_);
+            lastModifiedTsc_ = other.lastModifiedTsc_;
             processingEnd_ = other.processingEnd_;
+            sendingTimeStamped_ = other.sendingTimeStamped_;
 
             // Move cached data
             checksumValid_ = other.checksumValid_;
@@ -112,37 +171,47 @@ namespace fix_gateway::protocol
 
     void FixMessage::setField(int tag, int value)
     {
-        setFieldInternal(tag, FastStringConversion::make_permanent(
-                                  FastStringConversion::int_to_string(value)));
+        // Conversion buffer is copied straight into the field arena
+        setFieldInternal(tag, FastStringConversion::int_to_string(value));
     }
 
     void FixMessage::setField(int tag, double value, int precision)
     {
-        setFieldInternal(tag, FastStringConversion::make_permanent(
-                                  FastStringConversion::double_to_string(value, precision)));
+        setFieldInternal(tag, FastStringConversion::double_to_string(value, precision));
     }
 
     void FixMessage::setField(int tag, char value)
     {
-        setFieldInternal(tag, std::string(1, value));
+        setFieldInternal(tag, std::string_view(&value, 1));
     }
 
     void FixMessage::setField(int tag, std::string_view value)
     {
-        setFieldInternal(tag, std::string(value));
+        setFieldInternal(tag, value);
+    }
+
+    void FixMessage::setField(int tag, const FixDecimal &value)
+    {
+        char buffer[FixDecimal::MAX_TEXT_LENGTH];
+        setFieldInternal(tag, std::string_view(buffer, value.format(buffer)));
     }
 
     bool FixMessage::getField(int tag, std::string &value) const
     {
-        auto it = fields_.find(tag);
-        if (it != fields_.end())
+        std::string_view view;
+        if (fields_.get(tag, view))
         {
-            value = it->second;
+            value.assign(view.data(), view.size());
             return true;
         }
         return false;
     }
 
+    bool FixMessage::getField(int tag, std::string_view &value) const
+    {
+        return fields_.get(tag, value);
+    }
+
     bool FixMessage::getField(int tag, int &value) const
     {
         std::string strValue;
@@ -163,58 +232,166 @@ namespace fix_gateway::protocol
 
     bool FixMessage::getField(int tag, double &value) const
     {
-        std::string strValue;
-        if (getField(tag, strValue))
+        // FIX decimals have no exponent form: the fixed-point parse is exact
+        // up to the final division and avoids a string copy
+        FixDecimal decimal;
+        if (getField(tag, decimal))
         {
-            try
-            {
-                value = std::stod(strValue);
-                return true;
-            }
-            catch (const std::exception &)
-            {
-                return false;
-            }
+            value = decimal.toDouble();
+            return true;
         }
         return false;
     }
 
+    bool FixMessage::getField(int tag, FixDecimal &value) const
+    {
+        std::string_view view;
+        return fields_.get(tag, view) && FixDecimal::parse(view, value);
+    }
+
     bool FixMessage::getField(int tag, char &value) const
     {
-        std::string strValue;
-        if (getField(tag, strValue) && !strValue.empty())
+        std::string_view view;
+        if (fields_.get(tag, view) && !view.empty())
         {
-            value = strValue[0];
+            value = view[0];
             return true;
         }
         return false;
     }
 
-    const std::string *FixMessage::getFieldPtr(int tag) const
+    std::optional<std::string_view> FixMessage::getFieldPtr(int tag) const
     {
-        auto it = fields_.find(tag);
-        return (it != fields_.end()) ? &it->second : nullptr;
+        std::string_view view;
+        if (fields_.get(tag, view))
+        {
+            return view;
+        }
+        return std::nullopt;
     }
 
     bool FixMessage::hasField(int tag) const
     {
-        return fields_.find(tag) != fields_.end();
+        return fields_.contains(tag);
     }
 
     void FixMessage::removeField(int tag)
     {
-        if (fields_.erase(tag) > 0)
+        if (fields_.erase(tag))
+        {
+            touchModified();
+            invalidateCache();
+        }
+    }
+
+    // View mode
+    void FixMessage::attachSegment(fix_gateway::common::ReceiveSegment *segment)
+    {
+        if (segment == segment_)
+        {
+            return;
+        }
+
+        // Fields still pointing at a previous segment must be copied out first
+        if (segment_)
+        {
+            fields_.internalize();
+            releaseSegment();
+        }
+
+        if (segment)
+        {
+            segment->retain();
+            segment_ = segment;
+            fields_.bindExternal(segment->data());
+        }
+    }
+
+    void FixMessage::setFieldView(int tag, std::string_view value)
+    {
+        if (segment_ && segment_->contains(value.data(), value.size()))
+        {
+            if (tag == FixFields::SendingTime)
+            {
+                sendingTimeStamped_ = false;
+            }
+            fields_.setReference(tag, value);
+            touchModified();
+            invalidateCache();
+        }
+        else
+        {
+            setFieldInternal(tag, value);
+        }
+    }
+
+    // Repeating groups
+    bool FixMessage::beginGroup(int count_tag, uint32_t entries)
+    {
+        return beginGroup(FixGroups::find(getMsgTypeEnum(), count_tag), entries);
+    }
+
+    bool FixMessage::beginGroup(const FixGroupDefinition *definition, uint32_t entries)
+    {
+        if (!definition || fields_.inGroup())
+        {
+            return false;
+        }
+
+        setField(definition->count_tag, static_cast<int>(entries));
+        return fields_.beginGroup(definition, entries);
+    }
+
+    FixFieldStore::GroupAppend FixMessage::addGroupField(int tag, std::string_view value)
+    {
+        const bool reference = segment_ && segment_->contains(value.data(), value.size());
+        FixFieldStore::GroupAppend result = fields_.appendGroupField(tag, value, reference);
+        if (result == FixFieldStore::GroupAppend::Added)
         {
             touchModified();
             invalidateCache();
         }
+        return result;
+    }
+
+    bool FixMessage::endGroup()
+    {
+        return fields_.endGroup();
+    }
+
+    bool FixMessage::getGroupField(int count_tag, size_t index, int tag, std::string_view &value) const
+    {
+        return fields_.getGroupField(count_tag, index, tag, value);
+    }
+
+    bool FixMessage::getGroupField(int count_tag, size_t index, int tag, FixDecimal &value) const
+    {
+        std::string_view view;
+        return fields_.getGroupField(count_tag, index, tag, view) && FixDecimal::parse(view, value);
+    }
+
+    void FixMessage::releaseSegment()
+    {
+        if (segment_)
+        {
+            fix_gateway::common::ReceiveSegment *segment = segment_;
+            segment_ = nullptr;
+            segment->release();
+        }
     }
 
     // Common field accessors
     int FixMessage::getMsgSeqNum() const
     {
+        if (header_->flags & FixMessageHeader::SEQ_NUM_CACHED)
+        {
+            return header_->seq_num;
+        }
+
         int seqNum = 0;
         getField(FixFields::MsgSeqNum, seqNum);
+        header_->seq_num = seqNum;
+        header_->flags |= FixMessageHeader::SEQ_NUM_CACHED;
         return seqNum;
     }
 
@@ -222,25 +399,18 @@ namespace fix_gateway::protocol
     FixMsgType FixMessage::getMsgTypeEnum() const
     {
         // Check if already cached
-        if (msgTypeCached_)
+        if (header_->flags & FixMessageHeader::MSG_TYPE_CACHED)
         {
-            return cachedMsgType_;
+            return header_->msg_type;
         }
 
-        // Get message type string pointer (no allocation)
-        const std::string *msgTypePtr = getFieldPtr(FixFields::MsgType);
-        if (!msgTypePtr)
-        {
-            cachedMsgType_ = FixMsgType::UNKNOWN;
-            msgTypeCached_ = true;
-            return cachedMsgType_;
-        }
-
-        // Convert string to enum using ultra-fast character comparison
-        cachedMsgType_ = FixMsgTypeUtils::fromString(msgTypePtr->c_str());
-        msgTypeCached_ = true;
+        // Get message type string pointer (no allocation), then convert
+        // using ultra-fast character comparison
+        auto msgTypePtr = getFieldPtr(FixFields::MsgType);
+        header_->msg_type = msgTypePtr ? FixMsgTypeUtils::fromString(*msgTypePtr) : FixMsgType::UNKNOWN;
+        header_->flags |= FixMessageHeader::MSG_TYPE_CACHED;
 
-        return cachedMsgType_;
+        return header_->msg_type;
     }
 
     // Session-level field setters
@@ -266,17 +436,10 @@ namespace fix_gateway::protocol
 
     void FixMessage::setSendingTime(const std::chrono::system_clock::time_point &time)
     {
-        // Format time as YYYYMMDD-HH:MM:SS.sss (FIX UTCTimestamp format)
-        auto timeT = std::chrono::system_clock::to_time_t(time);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                      time.time_since_epoch()) %
-                  1000;
-
-        std::ostringstream oss;
-        oss << std::put_time(std::gmtime(&timeT), "%Y%m%d-%H:%M:%S");
-        oss << "." << std::setfill('0') << std::setw(3) << ms.count();
-
-        setField(FixFields::SendingTime, oss.str());
+        // YYYYMMDD-HH:MM:SS.sss (FIX UTCTimestamp format)
+        char timestamp[FixMessageUtils::FIX_TIMESTAMP_LENGTH];
+        FixMessageUtils::formatFixTime(time, timestamp);
+        setField(FixFields::SendingTime, std::string_view(timestamp, sizeof(timestamp)));
     }
 
     // Message validation
@@ -287,8 +450,7 @@ namespace fix_gateway::protocol
 
     bool FixMessage::isAdminMessage() const
     {
-        std::string msgType = getMsgType();
-        return FixMessageUtils::isSessionMessage(msgType);
+        return FixMsgTypeUtils::isSessionMessage(getMsgTypeEnum());
     }
 
     bool FixMessage::isApplicationMessage() const
@@ -313,8 +475,8 @@ namespace fix_gateway::protocol
         }
 
         // Validate specific field values
-        std::string msgType = getMsgType();
-        if (msgType.empty())
+        auto msgTypePtr = getFieldPtr(FixFields::MsgType);
+        if (!msgTypePtr || msgTypePtr->empty())
         {
             errors.push_back("Missing MsgType field");
         }
@@ -322,7 +484,7 @@ namespace fix_gateway::protocol
         // Validate trading-specific fields if it's an application message
         if (isApplicationMessage())
         {
-            if (msgType == MsgTypes::NewOrderSingle)
+            if (getMsgTypeEnum() == FixMsgType::NEW_ORDER_SINGLE)
             {
                 if (getClOrdID().empty())
                     errors.push_back("Missing ClOrdID");
@@ -346,9 +508,36 @@ namespace fix_gateway::protocol
             return cachedString_;
         }
 
+        // Checksum covers exactly the bytes written before the trailer
+        std::string message = toStringWithoutChecksum();
+        char checksum[3];
+        FixChecksum::format(FixChecksum::compute(message.data(), message.size()), checksum);
+
+        message.append("10=", 3);
+        message.append(checksum, 3);
+        message.push_back(FIX_SOH);
+
+        cachedString_ = std::move(message);
+        stringCacheValid_ = true;
+
+        return cachedString_;
+    }
+
+    std::string FixMessage::toStringWithoutChecksum() const
+    {
+        // Lazy SendingTime: an outbound message without tag 52 is stamped on
+        // its first serialization, rather than when it was allocated. The stamp
+        // is stored so a later re-serialization sends the same value
+        if (!hasField(FixFields::SendingTime))
+        {
+            FixMessage *self = const_cast<FixMessage *>(this);
+            self->setSendingTime(std::chrono::system_clock::now());
+            self->sendingTimeStamped_ = true;
+        }
+
         std::ostringstream oss;
 
-        // Header fields first (BeginString, BodyLength, MsgType)
+        // Header fields first (BeginString, BodyLength, MsgType, SendingTime)
         if (hasField(FixFields::BeginString))
         {
             oss << FixFields::BeginString << "=" << getFieldValue(FixFields::BeginString) << FIX_SOH;
@@ -365,6 +554,12 @@ namespace fix_gateway::protocol
         // Add MsgType
         oss << FixFields::MsgType << "=" << getMsgType() << FIX_SOH;
 
+        // The stamp was stored after the body fields - keep it in the header
+        if (sendingTimeStamped_)
+        {
+            oss << FixFields::SendingTime << "=" << getFieldValue(FixFields::SendingTime) << FIX_SOH;
+        }
+
         // Add all other fields (except BeginString, BodyLength, MsgType, CheckSum)
         for (const auto &field : fields_)
         {
@@ -372,36 +567,13 @@ namespace fix_gateway::protocol
             if (tag != FixFields::BeginString &&
                 tag != FixFields::BodyLength &&
                 tag != FixFields::MsgType &&
-                tag != FixFields::CheckSum)
+                tag != FixFields::CheckSum &&
+                !(tag == FixFields::SendingTime && sendingTimeStamped_))
             {
                 oss << tag << "=" << field.second << FIX_SOH;
             }
         }
 
-        // Calculate and add checksum
-        std::string messageWithoutChecksum = oss.str();
-        std::string checksum = calculateChecksum();
-        oss << FixFields::CheckSum << "=" << checksum << FIX_SOH;
-
-        cachedString_ = oss.str();
-        stringCacheValid_ = true;
-
-        return cachedString_;
-    }
-
-    std::string FixMessage::toStringWithoutChecksum() const
-    {
-        std::ostringstream oss;
-
-        // Add all fields except checksum
-        for (const auto &field : fields_)
-        {
-            if (field.first != FixFields::CheckSum)
-            {
-                oss << field.first << "=" << field.second << FIX_SOH;
-            }
-        }
-
         return oss.str();
     }
 
@@ -423,13 +595,22 @@ namespace fix_gateway::protocol
             }
         }
 
+        // "52=<timestamp><SOH>" not stored yet - toStringWithoutChecksum()
+        // stamps it on the first serialization
+        if (!hasField(FixFields::SendingTime))
+        {
+            length += 3 + FixMessageUtils::FIX_TIMESTAMP_LENGTH + 1;
+        }
+
         return length;
     }
 
     std::string FixMessage::calculateChecksum() const
     {
-        std::string messageWithoutChecksum = toStringWithoutChecksum();
-        return FixMessageUtils::calculateChecksum(messageWithoutChecksum);
+        // Taken from the cached wire form - a lazily stamped SendingTime must
+        // not be re-stamped (and re-summed) here
+        const std::string &message = toString();
+        return message.substr(message.size() - FixChecksum::TRAILER_LENGTH + 3, 3);
     }
 
     void FixMessage::updateLengthAndChecksum()
@@ -441,7 +622,9 @@ namespace fix_gateway::protocol
     // Performance monitoring
     void FixMessage::markProcessingStart()
     {
-        processingStart_ = std::chrono::steady_clock::now();
+        header_->processing_start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now().time_since_epoch())
+                                           .count();
     }
 
     void FixMessage::markProcessingEnd()
@@ -451,10 +634,11 @@ namespace fix_gateway::protocol
 
     std::chrono::nanoseconds FixMessage::getProcessingLatency() const
     {
-        if (processingStart_.time_since_epoch().count() > 0 &&
+        if (header_->processing_start_ns > 0 &&
             processingEnd_.time_since_epoch().count() > 0)
         {
-            return processingEnd_ - processingStart_;
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(processingEnd_.time_since_epoch()) -
+                   std::chrono::nanoseconds(header_->processing_start_ns);
         }
         return std::chrono::nanoseconds{0};
     }
@@ -496,13 +680,17 @@ namespace fix_gateway::protocol
     // Private helper methods
     std::string FixMessage::getFieldValue(int tag) const
     {
-        auto it = fields_.find(tag);
-        return (it != fields_.end()) ? it->second : "";
+        std::string_view view;
+        return fields_.get(tag, view) ? std::string(view) : std::string();
     }
 
-    void FixMessage::setFieldInternal(int tag, const std::string &value)
+    void FixMessage::setFieldInternal(int tag, std::string_view value)
     {
-        fields_[tag] = value;
+        if (tag == FixFields::SendingTime)
+        {
+            sendingTimeStamped_ = false; // Pinned - sent where it is stored
+        }
+        fields_.set(tag, value);
         touchModified();
         invalidateCache();
     }
@@ -514,14 +702,13 @@ namespace fix_gateway::protocol
         lengthValid_ = false;
         cachedString_.clear();
 
-        // Invalidate message type cache (Option 3 optimization)
-        msgTypeCached_ = false;
-        cachedMsgType_ = FixMsgType::UNKNOWN;
+        // Invalidate message type and sequence number caches (Option 3 optimization)
+        header_->flags &= static_cast<uint8_t>(~(FixMessageHeader::MSG_TYPE_CACHED | FixMessageHeader::SEQ_NUM_CACHED));
     }
 
     void FixMessage::touchModified()
     {
-        lastModified_ = std::chrono::steady_clock::now();
+        lastModifiedTsc_ = PerformanceTimer::readTsc();
     }
 
     bool FixMessage::hasRequiredSessionFields() const
@@ -554,8 +741,7 @@ namespace fix_gateway::protocol
             try
             {
                 int tag = std::stoi(rawMessage.substr(pos, eqPos - pos));
-                std::string value = rawMessage.substr(eqPos + 1, sohPos - eqPos - 1);
-                fields_[tag] = value;
+                fields_.set(tag, std::string_view(rawMessage).substr(eqPos + 1, sohPos - eqPos - 1));
             }
             catch (const std::exception &)
             {
@@ -631,26 +817,71 @@ namespace fix_gateway::protocol
     {
         bool isSessionMessage(const std::string &msgType)
         {
-            return msgType == MsgTypes::Heartbeat ||
-                   msgType == MsgTypes::TestRequest ||
-                   msgType == MsgTypes::ResendRequest ||
-                   msgType == MsgTypes::Reject ||
-                   msgType == MsgTypes::SequenceReset ||
-                   msgType == MsgTypes::Logout ||
-                   msgType == MsgTypes::Logon;
+            return FixMsgTypeUtils::isSessionMessage(FixMsgTypeUtils::fromString(std::string_view(msgType)));
         }
 
         std::string calculateChecksum(const std::string &message)
         {
-            uint8_t checksum = 0;
-            for (char c : message)
+            char checksum[3];
+            FixChecksum::format(FixChecksum::compute(message.data(), message.size()), checksum);
+            return std::string(checksum, 3);
+        }
+
+        std::string formatFixTime(const std::chrono::system_clock::time_point &time)
+        {
+            char timestamp[FIX_TIMESTAMP_LENGTH];
+            return std::string(timestamp, formatFixTime(time, timestamp));
+        }
+
+        size_t formatFixTime(const std::chrono::system_clock::time_point &time, char *out)
+        {
+            struct SecondsCache
+            {
+                int64_t second = INT64_MIN;
+                char prefix[17]; // YYYYMMDD-HH:MM:SS
+            };
+            thread_local SecondsCache cache;
+
+            int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+            int64_t second = ms / 1000;
+            int millis = static_cast<int>(ms % 1000);
+            if (millis < 0)
             {
-                checksum += static_cast<uint8_t>(c);
+                millis += 1000;
+                --second;
             }
 
-            std::ostringstream oss;
-            oss << std::setfill('0') << std::setw(3) << static_cast<int>(checksum % 256);
-            return oss.str();
+            if (second != cache.second)
+            {
+                std::time_t timeT = static_cast<std::time_t>(second);
+                std::tm utc{};
+                gmtime_r(&timeT, &utc);
+
+                auto put2 = [](char *p, int v)
+                {
+                    p[0] = static_cast<char>('0' + v / 10);
+                    p[1] = static_cast<char>('0' + v % 10);
+                };
+                int year = utc.tm_year + 1900;
+                put2(cache.prefix, year / 100);
+                put2(cache.prefix + 2, year % 100);
+                put2(cache.prefix + 4, utc.tm_mon + 1);
+                put2(cache.prefix + 6, utc.tm_mday);
+                cache.prefix[8] = '-';
+                put2(cache.prefix + 9, utc.tm_hour);
+                cache.prefix[11] = ':';
+                put2(cache.prefix + 12, utc.tm_min);
+                cache.prefix[14] = ':';
+                put2(cache.prefix + 15, utc.tm_sec);
+                cache.second = second;
+            }
+
+            std::memcpy(out, cache.prefix, sizeof(cache.prefix));
+            out[17] = '.';
+            out[18] = static_cast<char>('0' + millis / 100);
+            out[19] = static_cast<char>('0' + (millis / 10) % 10);
+            out[20] = static_cast<char>('0' + millis % 10);
+            return FIX_TIMESTAMP_LENGTH;
         }
 
         bool verifyChecksum(const std::string &message)
@@ -659,17 +890,17 @@ namespace fix_gateway::protocol
             if (checksumPos == std::string::npos)
                 return false;
 
-            std::string bodyMessage = message.substr(0, checksumPos);
-            std::string expectedChecksum = calculateChecksum(bodyMessage);
-
+            // Received value must be exactly three digits
             size_t checksumStart = checksumPos + 3;
             size_t checksumEnd = message.find(FIX_SOH, checksumStart);
             if (checksumEnd == std::string::npos)
                 checksumEnd = message.length();
 
-            std::string actualChecksum = message.substr(checksumStart, checksumEnd - checksumStart);
+            uint8_t actualChecksum = 0;
+            if (checksumEnd - checksumStart != 3 || !FixChecksum::parse(message.data() + checksumStart, actualChecksum))
+                return false;
 
-            return expectedChecksum == actualChecksum;
+            return FixChecksum::compute(message.data(), checksumPos) == actualChecksum;
         }
     }
 
@@ -762,7 +993,6 @@ namespace fix_gateway::protocol
         {
             msg->setSenderCompID(senderID);
             msg->setTargetCompID(targetID);
-            msg->setSendingTime();
         }
     }
 
@@ -771,7 +1001,6 @@ namespace fix_gateway::protocol
         setSenderCompID(senderID);
         setTargetCompID(targetID);
         setMsgSeqNum(seqNum);
-        setSendingTime();
     }
 
     void FixMessage::initializeAsNewOrderSingle(const std::string &clOrdID, const std::string &symbol,
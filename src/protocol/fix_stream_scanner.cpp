@@ -0,0 +1,248 @@
+#include "protocol/fix_stream_scanner.h"
+#include "protocol/fix_checksum.h"
+#include "protocol/fix_fields.h"
+#include <array>
+
+namespace fix_gateway::protocol
+{
+    namespace
+    {
+        using State = FixStreamScanner::State;
+
+        enum ByteClass : uint8_t
+        {
+            DIGIT,
+            EQUALS,
+            SOH,
+            OTHER,
+            BYTE_CLASS_COUNT
+        };
+
+        constexpr std::array<uint8_t, 256> makeByteClasses()
+        {
+            std::array<uint8_t, 256> classes{};
+            for (size_t i = 0; i < classes.size(); ++i)
+            {
+                classes[i] = OTHER;
+            }
+            for (size_t c = '0'; c <= '9'; ++c)
+            {
+                classes[c] = DIGIT;
+            }
+            classes['='] = EQUALS;
+            classes['\x01'] = SOH;
+            return classes;
+        }
+
+        constexpr std::array<uint8_t, 256> BYTE_CLASS = makeByteClasses();
+
+        enum Action : uint8_t
+        {
+            NONE,
+            START_TAG,      // First tag digit - field begins here
+            ACCUMULATE_TAG, // tag = tag * 10 + digit
+            BEGIN_VALUE,    // '=' after the tag - header/body checks
+            END_FIELD,      // SOH after the value - record the field
+            REJECT_TAG      // Byte cannot appear in a tag
+        };
+
+        struct Transition
+        {
+            State next;
+            Action action;
+        };
+
+        // Rows: TAG_START, TAG, VALUE. Columns: DIGIT, EQUALS, SOH, OTHER.
+        // COMPLETE and ERROR are terminal and never index the table.
+        constexpr Transition TRANSITIONS[3][BYTE_CLASS_COUNT] = {
+            {{State::TAG, START_TAG}, {State::ERROR, REJECT_TAG}, {State::ERROR, REJECT_TAG}, {State::ERROR, REJECT_TAG}},
+            {{State::TAG, ACCUMULATE_TAG}, {State::VALUE, BEGIN_VALUE}, {State::ERROR, REJECT_TAG}, {State::ERROR, REJECT_TAG}},
+            {{State::VALUE, NONE}, {State::VALUE, NONE}, {State::TAG_START, END_FIELD}, {State::VALUE, NONE}},
+        };
+
+        constexpr int MAX_TAG = 99999;
+    }
+
+    FixStreamScanner::Status FixStreamScanner::feed(const char *frame, size_t available)
+    {
+        if (state_ == State::COMPLETE || state_ == State::ERROR)
+        {
+            return status_;
+        }
+
+        size_t pos = scanned_;
+        while (pos < available)
+        {
+            unsigned char byte = static_cast<unsigned char>(frame[pos]);
+            const Transition &transition = TRANSITIONS[static_cast<size_t>(state_)][BYTE_CLASS[byte]];
+            sum_ += byte;
+
+            switch (transition.action)
+            {
+            case NONE:
+                break;
+
+            case START_TAG:
+                tag_ = byte - '0';
+                field_start_ = pos;
+                field_sum_ = sum_ - byte;
+                break;
+
+            case ACCUMULATE_TAG:
+                tag_ = tag_ * 10 + (byte - '0');
+                if (tag_ > MAX_TAG)
+                {
+                    return fail(pos, Status::InvalidTag);
+                }
+                break;
+
+            case BEGIN_VALUE:
+            {
+                Status status = beginValue(pos);
+                if (status != Status::NeedMoreData)
+                {
+                    return fail(pos, status);
+                }
+                break;
+            }
+
+            case END_FIELD:
+            {
+                Status status = endField(frame, pos);
+                if (status == Status::Complete)
+                {
+                    scanned_ = pos + 1;
+                    state_ = State::COMPLETE;
+                    status_ = Status::Complete;
+                    return status_;
+                }
+                if (status != Status::NeedMoreData)
+                {
+                    return fail(pos, status);
+                }
+                break;
+            }
+
+            case REJECT_TAG:
+                return fail(pos, Status::InvalidTag);
+            }
+
+            state_ = transition.next;
+            ++pos;
+        }
+
+        scanned_ = pos;
+
+        // Past the body and a full trailer without terminating - no CheckSum is coming
+        if (body_start_ != 0 && scanned_ - body_start_ > body_length_ + FixChecksum::TRAILER_LENGTH)
+        {
+            return fail(pos, Status::BodyLengthMismatch);
+        }
+
+        return Status::NeedMoreData;
+    }
+
+    void FixStreamScanner::reset()
+    {
+        state_ = State::TAG_START;
+        status_ = Status::NeedMoreData;
+        scanned_ = 0;
+        tag_ = 0;
+        field_start_ = value_start_ = 0;
+        field_sum_ = sum_ = checksum_sum_ = 0;
+        received_checksum_ = 0;
+        body_start_ = body_length_ = 0;
+        field_count_ = 0;
+    }
+
+    FixStreamScanner::Status FixStreamScanner::beginValue(size_t pos)
+    {
+        // Standard header order: 8, 9, 35
+        static constexpr int HEADER_TAGS[] = {FixFields::BeginString, FixFields::BodyLength, FixFields::MsgType};
+        if (field_count_ < 3 && tag_ != HEADER_TAGS[field_count_])
+        {
+            return Status::FieldOrder;
+        }
+
+        if (field_count_ == MAX_FIELDS)
+        {
+            return Status::TooManyFields;
+        }
+
+        if (body_start_ != 0)
+        {
+            // CheckSum starts right after the body; BodyLength counting the trailer
+            // is accepted too, matching the framer
+            size_t body_offset = field_start_ - body_start_;
+            if (tag_ == FixFields::CheckSum)
+            {
+                if (body_offset != body_length_ && body_offset + FixChecksum::TRAILER_LENGTH != body_length_)
+                {
+                    return Status::BodyLengthMismatch;
+                }
+                checksum_sum_ = field_sum_;
+            }
+            else if (body_offset >= body_length_)
+            {
+                return Status::BodyLengthMismatch;
+            }
+        }
+
+        value_start_ = pos + 1;
+        return Status::NeedMoreData;
+    }
+
+    FixStreamScanner::Status FixStreamScanner::endField(const char *frame, size_t pos)
+    {
+        const char *value = frame + value_start_;
+        size_t value_length = pos - value_start_;
+        fields_[field_count_++] = {tag_, static_cast<uint32_t>(value_start_), static_cast<uint32_t>(value_length)};
+
+        // Header fields are identified by position (beginValue enforced the tags)
+        if (field_count_ == 1)
+        {
+            if (value_length < 3 || value[0] != 'F' || value[1] != 'I' || value[2] != 'X')
+            {
+                return Status::InvalidBeginString;
+            }
+        }
+        else if (field_count_ == 2)
+        {
+            size_t body_length = 0;
+            for (size_t i = 0; i < value_length; ++i)
+            {
+                unsigned digit = static_cast<unsigned char>(value[i]) - '0';
+                if (digit > 9 || body_length > max_body_length_)
+                {
+                    return Status::InvalidBodyLength;
+                }
+                body_length = body_length * 10 + digit;
+            }
+            if (body_length == 0 || body_length > max_body_length_)
+            {
+                return Status::InvalidBodyLength;
+            }
+            body_length_ = body_length;
+            body_start_ = pos + 1;
+        }
+        else if (tag_ == FixFields::CheckSum)
+        {
+            if (value_length != 3 || !FixChecksum::parse(value, received_checksum_))
+            {
+                return Status::InvalidChecksum;
+            }
+            return Status::Complete;
+        }
+
+        return Status::NeedMoreData;
+    }
+
+    FixStreamScanner::Status FixStreamScanner::fail(size_t pos, Status status)
+    {
+        scanned_ = pos;
+        state_ = State::ERROR;
+        status_ = status;
+        return status;
+    }
+
+} // namespace fix_gateway::protocol
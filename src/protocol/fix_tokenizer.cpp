@@ -0,0 +1,394 @@
+#include "protocol/fix_tokenizer.h"
+#include "protocol/fix_checksum.h"
+#include "utils/platform_detector.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define FIX_TOKENIZER_X86 1
+#endif
+
+// Delimiter helpers run once per field - keep them inlined even in unoptimized builds
+#if defined(__GNUC__)
+#define TOKENIZER_INLINE inline __attribute__((always_inline))
+#else
+#define TOKENIZER_INLINE inline
+#endif
+
+namespace fix_gateway::protocol
+{
+    namespace
+    {
+        constexpr size_t NO_EQUALS = static_cast<size_t>(-1);
+
+        // Running position of the scan across blocks
+        struct ScanState
+        {
+            size_t field_start; // First byte of the current tag
+            size_t eq_pos;      // '=' of the current field, NO_EQUALS while still in the tag
+            size_t count;       // Fields emitted so far
+        };
+
+        // Tags are short (1-5 digits) - plain loop, rejects empty / non-numeric tags
+        TOKENIZER_INLINE bool parseTag(const char *p, size_t len, int &tag)
+        {
+            if (len == 0 || len > 9)
+                return false;
+
+            int value = 0;
+            for (size_t i = 0; i < len; ++i)
+            {
+                unsigned digit = static_cast<unsigned char>(p[i]) - '0';
+                if (digit > 9)
+                    return false;
+                value = value * 10 + static_cast<int>(digit);
+            }
+            tag = value;
+            return true;
+        }
+
+        // Clear every bit at or below 'bit'
+        TOKENIZER_INLINE uint32_t clearThrough(uint32_t mask, unsigned bit)
+        {
+            return bit >= 31 ? 0u : mask & (~0u << (bit + 1));
+        }
+
+        // Walk the '=' / SOH bitmasks of one block in position order.
+        // Returns false when the scan must stop (table full or malformed field).
+        TOKENIZER_INLINE bool consumeMasks(const char *buffer, size_t base, uint32_t eq, uint32_t soh,
+                                 ScanState &st, FieldToken *fields, size_t max_fields,
+                                 FixTokenizer::Status &status)
+        {
+            for (;;)
+            {
+                if (st.eq_pos == NO_EQUALS)
+                {
+                    // In the tag: the next delimiter must be '='
+                    if (soh && (!eq || __builtin_ctz(soh) < __builtin_ctz(eq)))
+                    {
+                        status = FixTokenizer::Status::MissingEquals;
+                        return false;
+                    }
+                    if (!eq)
+                        return true;
+
+                    unsigned bit = static_cast<unsigned>(__builtin_ctz(eq));
+                    st.eq_pos = base + bit;
+                    eq = clearThrough(eq, bit);
+                    soh = clearThrough(soh, bit);
+                }
+                else
+                {
+                    // In the value: '=' is ordinary data until the SOH
+                    if (!soh)
+                        return true;
+
+                    unsigned bit = static_cast<unsigned>(__builtin_ctz(soh));
+                    size_t soh_pos = base + bit;
+
+                    int tag = 0;
+                    if (!parseTag(buffer + st.field_start, st.eq_pos - st.field_start, tag))
+                    {
+                        status = FixTokenizer::Status::InvalidTag;
+                        return false;
+                    }
+
+                    FieldToken &token = fields[st.count++];
+                    token.tag = tag;
+                    token.value_offset = static_cast<uint32_t>(st.eq_pos + 1);
+                    token.value_length = static_cast<uint32_t>(soh_pos - st.eq_pos - 1);
+
+                    st.field_start = soh_pos + 1;
+                    st.eq_pos = NO_EQUALS;
+
+                    if (st.count == max_fields)
+                        return false;
+
+                    eq = clearThrough(eq, bit);
+                    soh = clearThrough(soh, bit);
+                }
+            }
+        }
+
+        // Build masks byte by byte for a block shorter than the vector width
+        TOKENIZER_INLINE void scalarMasks(const char *p, size_t len, uint32_t &eq, uint32_t &soh)
+        {
+            eq = 0;
+            soh = 0;
+            for (size_t i = 0; i < len; ++i)
+            {
+                eq |= static_cast<uint32_t>(p[i] == '=') << i;
+                soh |= static_cast<uint32_t>(p[i] == '\001') << i;
+            }
+        }
+
+        // Result when consumeMasks() stopped early (table full keeps Status::Ok)
+        inline FixTokenizer::Result finish(const ScanState &st, FixTokenizer::Status status)
+        {
+            return {status, st.count, st.field_start};
+        }
+
+        // Status after a scan that ran to the end of the input without stopping
+        inline FixTokenizer::Status endStatus(const ScanState &st, size_t length)
+        {
+            return st.field_start == length ? FixTokenizer::Status::Ok : FixTokenizer::Status::Incomplete;
+        }
+
+        // Bytes of the input the kernel never loaded (early stop) still count
+        // toward the byte sum - finish them with the checksum kernel
+        inline void finishByteSum(uint32_t *byte_sum, uint32_t scanned_sum, const char *buffer,
+                                  size_t resume, size_t length)
+        {
+            if (byte_sum)
+            {
+                *byte_sum += scanned_sum + (resume < length ? FixChecksum::byteSum(buffer + resume, length - resume) : 0);
+            }
+        }
+
+        TOKENIZER_INLINE uint32_t scalarSum(const char *p, size_t len)
+        {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < len; ++i)
+            {
+                sum += static_cast<unsigned char>(p[i]);
+            }
+            return sum;
+        }
+
+        // =================================================================
+        // SCALAR KERNEL - masks built byte by byte, same single-pass walk
+        // =================================================================
+
+        FixTokenizer::Result tokenizeScalar(const char *buffer, size_t length, FieldToken *fields, size_t max_fields,
+                                            uint32_t *byte_sum)
+        {
+            ScanState st{0, NO_EQUALS, 0};
+            FixTokenizer::Status status = FixTokenizer::Status::Ok;
+            constexpr size_t BLOCK = 32;
+            uint32_t sum = 0;
+
+            for (size_t base = 0; base < length; base += BLOCK)
+            {
+                uint32_t eq, soh;
+                size_t block_len = (length - base < BLOCK) ? length - base : BLOCK;
+                scalarMasks(buffer + base, block_len, eq, soh);
+                if (byte_sum)
+                    sum += scalarSum(buffer + base, block_len);
+
+                if (!consumeMasks(buffer, base, eq, soh, st, fields, max_fields, status))
+                {
+                    finishByteSum(byte_sum, sum, buffer, base + block_len, length);
+                    return finish(st, status);
+                }
+            }
+            finishByteSum(byte_sum, sum, buffer, length, length);
+            return {endStatus(st, length), st.count, st.field_start};
+        }
+
+#ifdef FIX_TOKENIZER_X86
+        // =================================================================
+        // SSE2 KERNEL - 16 bytes per step (baseline on every x86-64 CPU)
+        // =================================================================
+
+        FixTokenizer::Result tokenizeSse2(const char *buffer, size_t length, FieldToken *fields, size_t max_fields,
+                                          uint32_t *byte_sum)
+        {
+            ScanState st{0, NO_EQUALS, 0};
+            FixTokenizer::Status status = FixTokenizer::Status::Ok;
+            const __m128i eq_vec = _mm_set1_epi8('=');
+            const __m128i soh_vec = _mm_set1_epi8('\001');
+            const __m128i zero = _mm_setzero_si128();
+            __m128i sum_vec = zero;
+            bool stopped = false;
+
+            size_t base = 0;
+            for (; base + 16 <= length; base += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + base));
+                if (byte_sum)
+                    sum_vec = _mm_add_epi64(sum_vec, _mm_sad_epu8(block, zero));
+
+                uint32_t eq = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, eq_vec)));
+                uint32_t soh = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, soh_vec)));
+
+                if ((eq | soh) && !consumeMasks(buffer, base, eq, soh, st, fields, max_fields, status))
+                {
+                    base += 16;
+                    stopped = true;
+                    break;
+                }
+            }
+
+            sum_vec = _mm_add_epi64(sum_vec, _mm_srli_si128(sum_vec, 8));
+            uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(sum_vec));
+
+            if (!stopped && base < length)
+            {
+                uint32_t eq, soh;
+                scalarMasks(buffer + base, length - base, eq, soh);
+                if (byte_sum)
+                    sum += scalarSum(buffer + base, length - base);
+
+                stopped = !consumeMasks(buffer, base, eq, soh, st, fields, max_fields, status);
+                base = length;
+            }
+
+            finishByteSum(byte_sum, sum, buffer, base, length);
+            return stopped ? finish(st, status) : FixTokenizer::Result{endStatus(st, length), st.count, st.field_start};
+        }
+
+        // =================================================================
+        // AVX2 KERNEL - 32 bytes per step (selected at runtime)
+        // =================================================================
+
+        __attribute__((target("avx2"))) FixTokenizer::Result tokenizeAvx2(const char *buffer, size_t length,
+                                                                           FieldToken *fields, size_t max_fields,
+                                                                           uint32_t *byte_sum)
+        {
+            ScanState st{0, NO_EQUALS, 0};
+            FixTokenizer::Status status = FixTokenizer::Status::Ok;
+            const __m256i eq_vec = _mm256_set1_epi8('=');
+            const __m256i soh_vec = _mm256_set1_epi8('\001');
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i sum_vec = zero;
+            bool stopped = false;
+
+            size_t base = 0;
+            for (; base + 32 <= length; base += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer + base));
+                if (byte_sum)
+                    sum_vec = _mm256_add_epi64(sum_vec, _mm256_sad_epu8(block, zero));
+
+                uint32_t eq = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, eq_vec)));
+                uint32_t soh = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, soh_vec)));
+
+                if ((eq | soh) && !consumeMasks(buffer, base, eq, soh, st, fields, max_fields, status))
+                {
+                    base += 32;
+                    stopped = true;
+                    break;
+                }
+            }
+
+            __m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum_vec), _mm256_extracti128_si256(sum_vec, 1));
+            sum128 = _mm_add_epi64(sum128, _mm_srli_si128(sum128, 8));
+            uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(sum128));
+
+            if (!stopped && base < length)
+            {
+                uint32_t eq, soh;
+                scalarMasks(buffer + base, length - base, eq, soh);
+                if (byte_sum)
+                    sum += scalarSum(buffer + base, length - base);
+
+                stopped = !consumeMasks(buffer, base, eq, soh, st, fields, max_fields, status);
+                base = length;
+            }
+
+            finishByteSum(byte_sum, sum, buffer, base, length);
+            return stopped ? finish(st, status) : FixTokenizer::Result{endStatus(st, length), st.count, st.field_start};
+        }
+#endif
+
+        using TokenizeFn = FixTokenizer::Result (*)(const char *, size_t, FieldToken *, size_t, uint32_t *);
+
+        TokenizeFn kernelFunction(FixTokenizer::Kernel kernel)
+        {
+            switch (kernel)
+            {
+#ifdef FIX_TOKENIZER_X86
+            case FixTokenizer::Kernel::AVX2:
+                return tokenizeAvx2;
+            case FixTokenizer::Kernel::SSE2:
+                return tokenizeSse2;
+#endif
+            default:
+                return tokenizeScalar;
+            }
+        }
+
+        FixTokenizer::Kernel detectKernel()
+        {
+            if (utils::PlatformDetector::supportsAVX2())
+                return FixTokenizer::Kernel::AVX2;
+            if (utils::PlatformDetector::supportsSSE2())
+                return FixTokenizer::Kernel::SSE2;
+            return FixTokenizer::Kernel::SCALAR;
+        }
+
+        // Resolved once at load time - no per-call feature check
+        const TokenizeFn g_tokenize = kernelFunction(FixTokenizer::activeKernel());
+    }
+
+    // =================================================================
+    // PUBLIC API
+    // =================================================================
+
+    FixTokenizer::Result FixTokenizer::tokenize(const char *buffer, size_t length, FieldToken *fields, size_t max_fields,
+                                                uint32_t *byte_sum)
+    {
+        if (!buffer || !fields || max_fields == 0)
+        {
+            return {Status::Ok, 0, 0};
+        }
+        return g_tokenize(buffer, length, fields, max_fields, byte_sum);
+    }
+
+    FixTokenizer::Result FixTokenizer::tokenizeWith(Kernel kernel, const char *buffer, size_t length,
+                                                    FieldToken *fields, size_t max_fields, uint32_t *byte_sum)
+    {
+        if (!buffer || !fields || max_fields == 0)
+        {
+            return {Status::Ok, 0, 0};
+        }
+        if (!isKernelSupported(kernel))
+        {
+            kernel = Kernel::SCALAR;
+        }
+        return kernelFunction(kernel)(buffer, length, fields, max_fields, byte_sum);
+    }
+
+    FixTokenizer::Kernel FixTokenizer::activeKernel()
+    {
+        // Function-local so other translation units can depend on it during static init
+        static const Kernel kernel = detectKernel();
+        return kernel;
+    }
+
+    bool FixTokenizer::isKernelSupported(Kernel kernel)
+    {
+        switch (kernel)
+        {
+        case Kernel::AVX2:
+#ifdef FIX_TOKENIZER_X86
+            return utils::PlatformDetector::supportsAVX2();
+#else
+            return false;
+#endif
+        case Kernel::SSE2:
+#ifdef FIX_TOKENIZER_X86
+            return utils::PlatformDetector::supportsSSE2();
+#else
+            return false;
+#endif
+        case Kernel::SCALAR:
+            return true;
+        }
+        return false;
+    }
+
+    const char *FixTokenizer::kernelName(Kernel kernel)
+    {
+        switch (kernel)
+        {
+        case Kernel::AVX2:
+            return "avx2";
+        case Kernel::SSE2:
+            return "sse2";
+        case Kernel::SCALAR:
+            return "scalar";
+        }
+        return "unknown";
+    }
+
+} // namespace fix_gateway::protocol
@@ -0,0 +1,135 @@
+#include "protocol/message_prefilter.h"
+#include <algorithm>
+#include <cstring>
+
+namespace fix_gateway::protocol
+{
+    MessagePrefilter::MessagePrefilter() = default;
+
+    void MessagePrefilter::setAction(FixMsgType msg_type, PrefilterAction action)
+    {
+        filters_[static_cast<size_t>(msg_type)].action = action;
+        active_ = active_ || action != PrefilterAction::Parse;
+    }
+
+    bool MessagePrefilter::addFieldRule(FixMsgType msg_type, int tag, std::vector<std::string> values,
+                                        PrefilterAction on_match, PrefilterAction otherwise)
+    {
+        if (msg_type == FixMsgType::UNKNOWN || !isPeekableTag(tag))
+        {
+            return false;
+        }
+
+        TypeFilter &filter = filters_[static_cast<size_t>(msg_type)];
+        if (filter.rule_count == MAX_RULES_PER_TYPE)
+        {
+            return false;
+        }
+
+        FieldRule &rule = filter.rules[filter.rule_count++];
+        rule.tag = tag;
+        rule.values = std::move(values);
+        std::sort(rule.values.begin(), rule.values.end());
+        rule.on_match = on_match;
+        rule.otherwise = otherwise;
+
+        active_ = true;
+        return true;
+    }
+
+    bool MessagePrefilter::isPeekableTag(int tag)
+    {
+        return tag == FixFields::Symbol || tag == FixFields::Account || tag == FixFields::SenderSubID;
+    }
+
+    bool MessagePrefilter::filtersSessionMessages() const
+    {
+        for (size_t i = 0; i < filters_.size(); ++i)
+        {
+            if (!FixMsgTypeUtils::isSessionMessage(static_cast<FixMsgType>(i)))
+            {
+                continue;
+            }
+
+            const TypeFilter &filter = filters_[i];
+            if (filter.rule_count == 0 && filter.action != PrefilterAction::Parse)
+            {
+                return true;
+            }
+            for (uint8_t r = 0; r < filter.rule_count; ++r)
+            {
+                if (filter.rules[r].on_match != PrefilterAction::Parse ||
+                    filter.rules[r].otherwise != PrefilterAction::Parse)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    PrefilterAction MessagePrefilter::classify(FixMsgType msg_type, const char *frame, size_t length) const
+    {
+        const TypeFilter &filter = filters_[static_cast<size_t>(msg_type)];
+        if (filter.rule_count == 0)
+        {
+            return filter.action;
+        }
+
+        std::array<std::string_view, MAX_RULES_PER_TYPE> values{};
+        peekFields(filter, frame, length, values);
+
+        // Most permissive outcome wins (Parse < PassThrough < Drop)
+        PrefilterAction result = PrefilterAction::Drop;
+        for (uint8_t i = 0; i < filter.rule_count; ++i)
+        {
+            const FieldRule &rule = filter.rules[i];
+            bool matched = !values[i].empty() &&
+                           std::binary_search(rule.values.begin(), rule.values.end(), values[i],
+                                              [](std::string_view a, std::string_view b)
+                                              { return a < b; });
+            result = std::min(result, matched ? rule.on_match : rule.otherwise);
+        }
+        return result;
+    }
+
+    void MessagePrefilter::peekFields(const TypeFilter &filter, const char *frame, size_t length,
+                                      std::array<std::string_view, MAX_RULES_PER_TYPE> &values) const
+    {
+        const char *cursor = frame;
+        const char *end = frame + length;
+        uint8_t found = 0;
+
+        // One pass over tag=value<SOH>; stops at the trailer or once every rule tag is seen
+        while (cursor < end && found < filter.rule_count)
+        {
+            int tag = 0;
+            while (cursor < end && *cursor >= '0' && *cursor <= '9')
+            {
+                tag = tag * 10 + (*cursor++ - '0');
+            }
+            if (cursor == end || *cursor != '=' || tag == FixFields::CheckSum)
+            {
+                return;
+            }
+
+            const char *value = ++cursor;
+            const char *soh = static_cast<const char *>(std::memchr(value, '\x01', static_cast<size_t>(end - value)));
+            if (!soh)
+            {
+                return;
+            }
+
+            for (uint8_t i = 0; i < filter.rule_count; ++i)
+            {
+                if (filter.rules[i].tag == tag && values[i].empty() && soh > value)
+                {
+                    values[i] = std::string_view(value, static_cast<size_t>(soh - value));
+                    found++;
+                }
+            }
+            cursor = soh + 1;
+        }
+    }
+
+} // namespace fix_gateway::protocol
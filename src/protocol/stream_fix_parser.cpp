@@ -1,5 +1,7 @@
 #include "protocol/stream_fix_parser.h"
 #include "protocol/fix_fields.h"
+#include "protocol/fix_tokenizer.h"
+#include "protocol/fix_checksum.h"
 #include "utils/logger.h"
 #include "utils/performance_timer.h"
 #include "utils/fast_string_conversion.h"
@@ -75,7 +77,7 @@ namespace fix_gateway::protocol
     StreamFixParser::~StreamFixParser() = default;
 
     StreamFixParser::StreamFixParser(StreamFixParser &&other) noexcept
-        : message_pool_(other.message_pool_), max_message_size_(other.max_message_size_), validate_checksum_(other.validate_checksum_), strict_validation_(other.strict_validation_), partial_buffer_size_(other.partial_buffer_size_), stats_(other.stats_)
+        : message_pool_(other.message_pool_), prefilter_(other.prefilter_), pass_through_handler_(std::move(other.pass_through_handler_)), max_message_size_(other.max_message_size_), validate_checksum_(other.validate_checksum_), strict_validation_(other.strict_validation_), partial_buffer_size_(other.partial_buffer_size_), stats_(other.stats_)
     {
         // Move partial buffer
         std::memcpy(partial_buffer_, other.partial_buffer_, partial_buffer_size_);
@@ -88,11 +90,14 @@ namespace fix_gateway::protocol
         if (this != &other)
         {
             message_pool_ = other.message_pool_;
+            prefilter_ = other.prefilter_;
+            pass_through_handler_ = std::move(other.pass_through_handler_);
             max_message_size_ = other.max_message_size_;
             validate_checksum_ = other.validate_checksum_;
             strict_validation_ = other.strict_validation_;
             partial_buffer_size_ = other.partial_buffer_size_;
             stats_ = other.stats_;
+            tail_scanner_.reset();
 
             std::memcpy(partial_buffer_, other.partial_buffer_, partial_buffer_size_);
             other.partial_buffer_size_ = 0;
@@ -136,6 +141,9 @@ namespace fix_gateway::protocol
             {
                 if (partial_buffer_size_ + len > PARTIAL_BUFFER_SIZE)
                 {
+                    // Drop the held bytes so the next call starts clean instead of failing too
+                    reset();
+                    updateErrorStats(ParseStatus::MessageTooLarge, ParseState::ERROR_RECOVERY);
                     return {ParseStatus::MessageTooLarge, 0, nullptr,
                             "Partial buffer overflow", ParseState::ERROR_RECOVERY, 0};
                 }
@@ -144,6 +152,7 @@ namespace fix_gateway::protocol
                 buf = partial_buffer_;
                 len += partial_buffer_size_;
                 partial_buffer_size_ = 0;
+                tail_scanner_.reset();
             }
 
             size_t cursor = 0;
@@ -186,11 +195,32 @@ namespace fix_gateway::protocol
                     // that need to be preserved for the next parse() call.
 
                     size_t leftover = len - cursor;
+                    if (leftover > maxHeldFrame())
+                    {
+                        // Can never complete (e.g. unterminated BodyLength) - drop it
+                        updateErrorStats(ParseStatus::MessageTooLarge, ParseState::ERROR_RECOVERY);
+                        stats_.corrupted_data_skipped += leftover;
+                        if (hasSuccessfulParse)
+                        {
+                            lastSuccessResult.bytes_consumed = len;
+                            return lastSuccessResult;
+                        }
+                        return {ParseStatus::MessageTooLarge, len, nullptr,
+                                "Incomplete frame longer than the maximum message size", ParseState::ERROR_RECOVERY, 0};
+                    }
                     if (leftover > 0)
                     {
-                        std::memcpy(partial_buffer_, buf + cursor, leftover);
+                        std::memmove(partial_buffer_, buf + cursor, leftover); // buf may already be partial_buffer_
                         partial_buffer_size_ = leftover;
                     }
+
+                    // A message already completed in this buffer is still handed out;
+                    // the retained tail counts as consumed
+                    if (hasSuccessfulParse)
+                    {
+                        lastSuccessResult.bytes_consumed = len;
+                        return lastSuccessResult;
+                    }
                     return frameRes; // Not an error – we just wait for more data
                 }
 
@@ -217,6 +247,7 @@ namespace fix_gateway::protocol
                     // Update error statistics for framing errors
                     updateErrorStats(frameRes.status, frameRes.final_state);
 
+                    releaseSuperseded(lastSuccessResult, hasSuccessfulParse);
                     return frameRes; // Return error if recovery failed or not enabled
                 }
 
@@ -227,12 +258,18 @@ namespace fix_gateway::protocol
                 const char *msgPtr = buf + cursor + msgStart; // Usually msgStart == 0
                 size_t msgLen = msgEnd - msgStart;
 
-                ParseResult decodeRes = parseCompleteMessage(msgPtr, msgLen);
+                // Passed through or dropped before any pool allocation
+                if (prefilterFrame(msgPtr, msgLen))
+                {
+                    cursor += msgEnd;
+                    continue;
+                }
+
+                ParseResult decodeRes = parseCompleteMessage(msgPtr, msgLen, parse_context_.msg_type);
 
-                // CRITICAL FIX: Use actual bytes consumed by parser, not framing boundary
-                // decodeRes.bytes_consumed is already the correct message length from optimized parser
-                size_t actual_bytes_consumed = decodeRes.bytes_consumed;
-                decodeRes.bytes_consumed = cursor + actual_bytes_consumed; // Absolute position in original buffer
+                // The framer already knows where the frame ends (either BodyLength
+                // reading); advance by that, not by what the decoder reports
+                decodeRes.bytes_consumed = cursor + msgEnd; // Absolute position in original buffer
 
                 // Update statistics
                 auto parse_end = std::chrono::high_resolution_clock::now();
@@ -271,14 +308,16 @@ namespace fix_gateway::protocol
                 // Multi-message support: handle result and continue parsing
                 if (decodeRes.status != ParseStatus::Success)
                 {
+                    releaseSuperseded(lastSuccessResult, hasSuccessfulParse);
                     return decodeRes; // Return errors immediately
                 }
 
                 // Success: advance cursor to continue parsing additional messages in the same buffer
-                // CRITICAL FIX: Use actual bytes consumed by parser, not framing boundary
-                cursor += actual_bytes_consumed;
+                cursor += msgEnd;
 
-                // Store the successful result for final return
+                // Store the successful result for final return (only the last message
+                // is returned - earlier ones go back to the pool instead of leaking)
+                releaseSuperseded(lastSuccessResult, hasSuccessfulParse);
                 lastSuccessResult = decodeRes;
                 lastSuccessResult.bytes_consumed = cursor; // Update total bytes consumed so far
                 hasSuccessfulParse = true;
@@ -311,141 +350,507 @@ namespace fix_gateway::protocol
     }
 
     // =================================================================
-    // STATE MACHINE CORE PROCESSOR
+    // BATCH PARSE - Every complete message from one receive buffer
+    // Same two stages as parse(), but each decoded message is written to
+    // the caller's array instead of overwriting the previous result.
     // =================================================================
 
-    StreamFixParser::ParseResult StreamFixParser::processStateMachine(const char *buffer, size_t length, ParseContext &context)
+    StreamFixParser::BatchParseResult StreamFixParser::parseBatch(const char *buf, size_t len,
+                                                                  FixMessage **out_messages, size_t max_messages)
     {
-        ParseResult result;
-        size_t total_consumed = 0;
+        BatchParseResult batch{ParseStatus::NeedMoreData, 0, 0, 0, 0, std::string()};
 
-        // Process buffer until complete message or need more data
-        while (total_consumed <= length)
+        if (!buf || len == 0 || !out_messages || max_messages == 0)
         {
-            const char *current_buffer = buffer + total_consumed;
-            size_t remaining_length = length - total_consumed;
-
-            // Update buffer position in context
-            context.buffer_position = total_consumed;
+            batch.status = ParseStatus::InvalidFormat;
+            batch.error_detail = "Empty buffer or output array";
+            return batch;
+        }
 
-            // Store the previous state to detect transitions
-            ParseState previous_state = context.current_state;
+        if (isCircuitBreakerActive())
+        {
+            batch.status = ParseStatus::CorruptedData;
+            batch.error_detail = "Circuit breaker active - too many consecutive errors";
+            return batch;
+        }
 
-            // For MESSAGE_COMPLETE state, we don't need buffer data
-            if (context.current_state == ParseState::MESSAGE_COMPLETE && remaining_length == 0)
+        // Prepend any leftover partial bytes; 'carried' marks where the caller's bytes begin
+        size_t carried = 0;
+        if (partial_buffer_size_ != 0)
+        {
+            if (partial_buffer_size_ >= PARTIAL_BUFFER_SIZE)
             {
-                // Call handleMessageComplete with empty buffer
-                result = handleMessageComplete(nullptr, 0, context);
+                // No room to complete it - drop it rather than refuse every later read
+                stats_.corrupted_data_skipped += partial_buffer_size_;
+                reset();
+                updateErrorStats(ParseStatus::MessageTooLarge, ParseState::ERROR_RECOVERY);
+                batch.status = ParseStatus::MessageTooLarge;
+                batch.error_detail = "Partial buffer overflow";
             }
             else
             {
-                // Dispatch to appropriate state handler
-                switch (context.current_state)
+                // Take what fits; the caller resubmits the rest (bytes_consumed < length)
+                len = std::min(len, PARTIAL_BUFFER_SIZE - partial_buffer_size_);
+            }
+        }
+        if (partial_buffer_size_ != 0)
+        {
+            std::memcpy(partial_buffer_ + partial_buffer_size_, buf, len);
+            carried = partial_buffer_size_;
+            buf = partial_buffer_;
+            len += carried;
+            partial_buffer_size_ = 0;
+        }
+
+        // A held message is resumed by tail_scanner_, which scans only the bytes
+        // appended since the last call instead of reframing it from "8=" each time
+        size_t first_frame_length = 0;
+        if (carried >= 2 && buf[0] == '8' && buf[1] == '=')
+        {
+            tail_scanner_.setMaxBodyLength(max_message_size_);
+            FixStreamScanner::Status scan = tail_scanner_.feed(buf, len);
+            if (scan == FixStreamScanner::Status::NeedMoreData && len <= maxHeldFrame())
+            {
+                stats_.partial_messages_handled++;
+                partial_buffer_size_ = len;
+                batch.bytes_consumed = len - carried;
+                return batch;
+            }
+            if (scan == FixStreamScanner::Status::Complete)
+            {
+                first_frame_length = tail_scanner_.frameLength();
+            }
+            // Anything else: frame with findCompleteMessage, which owns error recovery
+        }
+        tail_scanner_.reset();
+
+        bool incomplete_tail = false;
+        size_t cursor = decodeFrames(buf, len, out_messages, max_messages, batch, incomplete_tail,
+                                     first_frame_length);
+
+        // Pool exhausted: the rest of the input is intact, so hold all of it
+        // (carried bytes included) and retry it on the next call instead of
+        // handing back bytes the caller would have to keep
+        if (batch.status == ParseStatus::AllocationFailed && len - cursor <= PARTIAL_BUFFER_SIZE)
+        {
+            std::memmove(partial_buffer_, buf + cursor, len - cursor);
+            partial_buffer_size_ = len - cursor;
+            cursor = len;
+        }
+
+        cursor = dropOversizedTail(buf, len, cursor, maxHeldFrame(), out_messages, max_messages, batch, incomplete_tail);
+
+        if (incomplete_tail)
+        {
+            // Keep the incomplete tail (buf may alias partial_buffer_, hence memmove)
+            size_t leftover = len - cursor;
+            std::memmove(partial_buffer_, buf + cursor, leftover);
+            partial_buffer_size_ = leftover;
+            cursor = len;
+        }
+
+        // Stopped inside bytes carried over from the previous call - put them back
+        if (cursor < carried)
+        {
+            std::memmove(partial_buffer_, partial_buffer_ + cursor, carried - cursor);
+            partial_buffer_size_ = carried - cursor;
+            cursor = carried;
+        }
+        batch.bytes_consumed = cursor - carried;
+
+        return batch;
+    }
+
+    StreamFixParser::BatchParseResult StreamFixParser::parseBatch(ReceiveRing &ring,
+                                                                  FixMessage **out_messages, size_t max_messages)
+    {
+        BatchParseResult batch{ParseStatus::NeedMoreData, 0, 0, 0, 0, std::string()};
+
+        if (!out_messages || max_messages == 0)
+        {
+            batch.status = ParseStatus::InvalidFormat;
+            batch.error_detail = "Empty output array";
+            return batch;
+        }
+
+        // The ring holds the tail itself; bytes parked by parse()/parseBatch(buffer) would be lost
+        if (partial_buffer_size_ != 0)
+        {
+            batch.status = ParseStatus::InvalidFormat;
+            batch.error_detail = "Ring parse with a pending partial buffer";
+            return batch;
+        }
+
+        if (isCircuitBreakerActive())
+        {
+            batch.status = ParseStatus::CorruptedData;
+            batch.error_detail = "Circuit breaker active - too many consecutive errors";
+            return batch;
+        }
+
+        size_t len = ring.readable();
+        if (len == 0)
+        {
+            return batch;
+        }
+
+        // The mirror mapping makes the unconsumed bytes contiguous even across the wrap,
+        // so frames are decoded in place and an incomplete tail is simply left unconsumed
+        bool incomplete_tail = false;
+        size_t cursor = decodeFrames(ring.readPtr(), len, out_messages, max_messages, batch, incomplete_tail);
+
+        // Left in the ring, a tail that can never complete would fill it and stall the reader
+        cursor = dropOversizedTail(ring.readPtr(), len, cursor, max_message_size_ + FRAME_OVERHEAD,
+                                   out_messages, max_messages, batch, incomplete_tail);
+
+        ring.consume(cursor);
+        batch.bytes_consumed = cursor;
+        return batch;
+    }
+
+    size_t StreamFixParser::decodeFrames(const char *buf, size_t len, FixMessage **out_messages, size_t max_messages,
+                                         BatchParseResult &batch, bool &incomplete_tail,
+                                         size_t first_frame_length)
+    {
+        size_t cursor = 0;
+        bool stopped_on_error = false;
+        ParseStatus last_drop_status = ParseStatus::Success;
+
+        try
+        {
+            while (cursor < len && batch.messages_parsed < max_messages)
+            {
+                auto frame_start = std::chrono::high_resolution_clock::now();
+
+                size_t msgStart, msgEnd;
+                ParseResult frameRes{};
+                if (cursor == 0 && first_frame_length != 0)
                 {
-                case ParseState::IDLE:
-                    result = handleIdleState(current_buffer, remaining_length, context);
-                    break;
+                    // Already framed by the caller's scanner
+                    msgStart = 0;
+                    msgEnd = first_frame_length;
+                    parse_context_.msg_type = StreamParserUtils::peekMsgType(buf, first_frame_length);
+                    frameRes.status = ParseStatus::Success;
+                }
+                else
+                {
+                    frameRes = findCompleteMessage(buf + cursor, len - cursor, msgStart, msgEnd);
+                }
 
-                case ParseState::PARSING_BEGIN_STRING:
-                    result = handleParsingBeginString(current_buffer, remaining_length, context);
+                if (frameRes.status == ParseStatus::NeedMoreData)
+                {
+                    // The caller decides where the incomplete tail lives
+                    incomplete_tail = true;
                     break;
+                }
 
-                case ParseState::PARSING_BODY_LENGTH:
-                    result = handleParsingBodyLength(current_buffer, remaining_length, context);
-                    break;
+                if (frameRes.status != ParseStatus::Success)
+                {
+                    if (error_recovery_enabled_ && canRecoverFromError(frameRes.status, frameRes.final_state))
+                    {
+                        ParseResult recovery_result = attemptErrorRecovery(buf + cursor, len - cursor, parse_context_, frameRes.error_detail);
+                        if (recovery_result.status == ParseStatus::RecoverySuccess)
+                        {
+                            cursor += recovery_result.bytes_consumed;
+                            recordErrorRecovery(true);
+                            continue;
+                        }
+                        recordErrorRecovery(false);
+                    }
 
-                case ParseState::PARSING_TAG:
-                    result = handleParsingTag(current_buffer, remaining_length, context);
+                    // Framing is lost - drop the rest of the buffer, as parse() does
+                    updateErrorStats(frameRes.status, frameRes.final_state);
+                    batch.status = frameRes.status;
+                    batch.error_detail = frameRes.error_detail;
+                    stopped_on_error = true;
+                    cursor = len;
                     break;
+                }
 
-                case ParseState::EXPECTING_EQUALS:
-                    result = handleExpectingEquals(current_buffer, remaining_length, context);
-                    break;
+                const char *msgPtr = buf + cursor + msgStart;
+                size_t msgLen = msgEnd - msgStart;
 
-                case ParseState::PARSING_VALUE:
-                    result = handleParsingValue(current_buffer, remaining_length, context);
-                    break;
+                if (prefilterFrame(msgPtr, msgLen))
+                {
+                    batch.messages_filtered++;
+                    cursor += msgEnd;
+                    continue;
+                }
 
-                case ParseState::EXPECTING_SOH:
-                    result = handleExpectingSOH(current_buffer, remaining_length, context);
-                    break;
+                ParseResult decodeRes = parseCompleteMessage(msgPtr, msgLen, parse_context_.msg_type);
 
-                case ParseState::PARSING_CHECKSUM:
-                    result = handleParsingChecksum(current_buffer, remaining_length, context);
-                    break;
+                auto parse_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::high_resolution_clock::now() - frame_start)
+                                      .count();
 
-                case ParseState::MESSAGE_COMPLETE:
-                    result = handleMessageComplete(current_buffer, remaining_length, context);
-                    break;
+                if (decodeRes.status == ParseStatus::Success && decodeRes.parsed_message)
+                {
+                    resetErrorRecovery();
+                    updateStats(decodeRes.status, parse_time);
+                    out_messages[batch.messages_parsed++] = decodeRes.parsed_message;
+                    cursor += msgEnd; // The frame end, whichever BodyLength reading framed it
+                    continue;
+                }
 
-                case ParseState::ERROR_RECOVERY:
-                    result = handleErrorRecovery(current_buffer, remaining_length, context);
-                    break;
+                updateErrorStats(decodeRes.status, decodeRes.final_state);
+                updateStats(decodeRes.status, parse_time);
 
-                case ParseState::CORRUPTED_SKIP:
-                    result = handleCorruptedSkip(current_buffer, remaining_length, context);
+                if (decodeRes.status == ParseStatus::AllocationFailed)
+                {
+                    // Pool exhausted - leave this frame unconsumed so the caller can retry it
+                    batch.status = decodeRes.status;
+                    batch.error_detail = decodeRes.error_detail;
+                    stopped_on_error = true;
                     break;
-
-                default:
-                    return {ParseStatus::StateTransitionError, total_consumed, nullptr,
-                            "Invalid parser state: " + std::to_string(static_cast<int>(context.current_state)),
-                            context.current_state, total_consumed};
                 }
-            }
 
-            // Update total bytes consumed
-            size_t bytes_consumed_this_iteration = result.bytes_consumed;
-            total_consumed += result.bytes_consumed;
-            result.bytes_consumed = total_consumed; // Update to total consumed
+                // Frame boundaries are known - skip the bad frame and keep going
+                batch.messages_dropped++;
+                batch.error_detail = decodeRes.error_detail;
+                last_drop_status = decodeRes.status;
+                cursor += msgEnd;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            updateStats(ParseStatus::InvalidFormat, 0);
+            parse_context_.error_count_in_session++;
 
-            // Check if we made a state transition
-            bool state_changed = (context.current_state != previous_state);
+            batch.status = ParseStatus::InvalidFormat;
+            batch.error_detail = "Parse exception: " + std::string(e.what());
+            stopped_on_error = true;
+            cursor = len;
+        }
 
-            // Handle different result statuses
-            if (result.status == ParseStatus::Success)
+        if (!stopped_on_error)
+        {
+            if (batch.messages_parsed > 0)
             {
-                return result;
+                batch.status = ParseStatus::Success;
             }
-            else if (result.status == ParseStatus::NeedMoreData)
+            else if (batch.messages_dropped > 0)
             {
-                // Only return NeedMoreData if we've consumed all available bytes
-                // or if no bytes were consumed AND no state transition occurred (truly need more data)
-                if (total_consumed >= length || (bytes_consumed_this_iteration == 0 && !state_changed))
-                {
-                    return result;
-                }
-                // Otherwise continue processing - we made progress (either consumed bytes or changed state)
+                batch.status = last_drop_status;
+            }
+        }
+
+        return cursor;
+    }
+
+    size_t StreamFixParser::dropOversizedTail(const char *buf, size_t len, size_t cursor, size_t limit,
+                                              FixMessage **out_messages, size_t max_messages,
+                                              BatchParseResult &batch, bool &incomplete_tail)
+    {
+        // A tail longer than any frame we accept will never complete (an unterminated
+        // BodyLength, say): a framing error. Resync at the next BeginString after it.
+        while (incomplete_tail && len - cursor > limit)
+        {
+            size_t skip = skipToNextPotentialMessage(buf + cursor, len - cursor, 1);
+            updateErrorStats(ParseStatus::MessageTooLarge, ParseState::ERROR_RECOVERY);
+            stats_.corrupted_data_skipped += skip;
+            batch.status = ParseStatus::MessageTooLarge;
+            batch.error_detail = "Incomplete frame longer than the maximum message size";
+            cursor += skip;
+            incomplete_tail = false;
+            if (cursor < len)
+            {
+                cursor += decodeFrames(buf + cursor, len - cursor, out_messages, max_messages, batch, incomplete_tail);
             }
-            else if (result.status == ParseStatus::RecoverySuccess)
+        }
+        return cursor;
+    }
+
+    bool StreamFixParser::applyPrefilter(const char *frame, size_t length)
+    {
+        FixMsgType msg_type = parse_context_.msg_type; // Classified from the 35= peek while framing
+        PrefilterAction action = prefilter_->classify(msg_type, frame, length);
+        if (action == PrefilterAction::Parse)
+        {
+            return false;
+        }
+
+        if (action == PrefilterAction::PassThrough)
+        {
+            // Never hand out a corrupt frame: decode it instead, which reports
+            // the checksum error the usual way
+            if (validate_checksum_ && !validateMessageChecksum(frame, length))
             {
-                return result;
+                return false;
             }
-            else if (result.status == ParseStatus::InvalidFormat ||
-                     result.status == ParseStatus::ChecksumError ||
-                     result.status == ParseStatus::FieldParseError)
+            stats_.prefilter_passed_through++;
+            if (pass_through_handler_)
             {
-                // Error occurred - return or attempt recovery
-                return result;
+                pass_through_handler_(msg_type, frame, length);
             }
+        }
+        else
+        {
+            stats_.prefilter_dropped++;
+        }
+        stats_.prefiltered_by_type[static_cast<size_t>(msg_type)]++;
+        return true;
+    }
+
+    // =================================================================
+    // INCREMENTAL PARSING (Resumable byte-level DFA)
+    // =================================================================
+
+    // Scanner failure -> parser status and detail
+    static StreamFixParser::ParseStatus scanErrorStatus(FixStreamScanner::Status status)
+    {
+        switch (status)
+        {
+        case FixStreamScanner::Status::InvalidTag:
+        case FixStreamScanner::Status::TooManyFields:
+            return StreamFixParser::ParseStatus::FieldParseError;
+        default:
+            return StreamFixParser::ParseStatus::InvalidFormat;
+        }
+    }
 
-            // Continue processing if state changed but no definitive result
-            recordStateTransition();
+    static const char *scanErrorDetail(FixStreamScanner::Status status)
+    {
+        switch (status)
+        {
+        case FixStreamScanner::Status::InvalidTag:
+            return "Invalid field tag";
+        case FixStreamScanner::Status::FieldOrder:
+            return "Header fields out of order (expected 8, 9, 35)";
+        case FixStreamScanner::Status::InvalidBeginString:
+            return "Invalid BeginString";
+        case FixStreamScanner::Status::InvalidBodyLength:
+            return "Invalid BodyLength value";
+        case FixStreamScanner::Status::BodyLengthMismatch:
+            return "CheckSum not at the offset given by BodyLength";
+        case FixStreamScanner::Status::InvalidChecksum:
+            return "Invalid CheckSum value";
+        case FixStreamScanner::Status::TooManyFields:
+            return "Too many fields in message";
+        default:
+            return "Scan error";
         }
+    }
 
-        // Reached end of buffer without completing message
-        if (context.current_state != ParseState::IDLE)
+    StreamFixParser::ParseResult StreamFixParser::parseWithState(const char *buffer, size_t length, ParseContext &context)
+    {
+        if (!buffer)
         {
-            // Store partial message for next call
-            storePartialMessage(buffer, length);
-            stats_.partial_messages_handled++;
+            return {ParseStatus::InvalidFormat, 0, nullptr, "Null buffer", context.current_state, 0};
+        }
 
-            return {ParseStatus::NeedMoreData, length, nullptr,
-                    "Partial message stored, need more data",
-                    context.current_state, 0};
+        // Only the bytes appended since the previous call are scanned
+        FixStreamScanner &scanner = context.scanner;
+        scanner.setMaxBodyLength(max_message_size_);
+        FixStreamScanner::Status status = scanner.feed(buffer, length);
+        syncScanState(context);
+
+        if (status == FixStreamScanner::Status::NeedMoreData)
+        {
+            return {ParseStatus::NeedMoreData, 0, nullptr, "", context.current_state, 0};
+        }
+
+        if (status == FixStreamScanner::Status::Complete)
+        {
+            return completeScannedMessage(buffer, context);
+        }
+
+        ParseStatus error_status = scanErrorStatus(status);
+        size_t error_position = scanner.scanned();
+        updateErrorStats(error_status, context.current_state);
+        context.reset();
+        return {error_status, 0, nullptr, scanErrorDetail(status), ParseState::ERROR_RECOVERY, error_position};
+    }
+
+    void StreamFixParser::syncScanState(ParseContext &context)
+    {
+        const FixStreamScanner &scanner = context.scanner;
+        context.expected_body_length = scanner.bodyLength();
+
+        ParseState state;
+        switch (scanner.state())
+        {
+        case FixStreamScanner::State::COMPLETE:
+            state = ParseState::MESSAGE_COMPLETE;
+            break;
+        case FixStreamScanner::State::ERROR:
+            state = ParseState::ERROR_RECOVERY;
+            break;
+        default:
+            if (!scanner.started())
+                state = ParseState::IDLE;
+            else if (scanner.fieldCount() == 0)
+                state = ParseState::PARSING_BEGIN_STRING;
+            else if (scanner.fieldCount() == 1)
+                state = ParseState::PARSING_BODY_LENGTH;
+            else if (scanner.state() != FixStreamScanner::State::VALUE)
+                state = ParseState::PARSING_TAG;
+            else if (scanner.currentTag() == FixFields::CheckSum)
+                state = ParseState::PARSING_CHECKSUM;
+            else
+                state = ParseState::PARSING_VALUE;
+            break;
+        }
+
+        if (state != context.current_state)
+        {
+            updateStateStatistics(context.current_state, state);
+            context.current_state = state;
+        }
+    }
+
+    StreamFixParser::ParseResult StreamFixParser::completeScannedMessage(const char *buffer, ParseContext &context)
+    {
+        const FixStreamScanner &scanner = context.scanner;
+        size_t frame_length = scanner.frameLength();
+
+        // The running sum already stopped at "10=" - nothing to re-read
+        if (validate_checksum_ && scanner.computedChecksum() != scanner.receivedChecksum())
+        {
+            std::string detail = "Checksum validation failed: expected " + std::to_string(scanner.computedChecksum()) +
+                                 ", received " + std::to_string(scanner.receivedChecksum());
+            updateErrorStats(ParseStatus::ChecksumError, ParseState::MESSAGE_COMPLETE);
+            context.reset();
+            return {ParseStatus::ChecksumError, frame_length, nullptr, detail, ParseState::ERROR_RECOVERY, 0};
+        }
+
+        FixMessage *message = message_pool_->allocate();
+        if (!message)
+        {
+            context.reset();
+            return {ParseStatus::AllocationFailed, 0, nullptr, "MessagePool allocation failed",
+                    ParseState::ERROR_RECOVERY, 0};
+        }
+
+        // Field values are read straight from their recorded offsets in the retained frame
+        GroupRouting routing;
+        for (size_t i = 0; i < scanner.fieldCount(); ++i)
+        {
+            const FieldToken &field = scanner.field(i);
+            if (!storeField(message, field.tag, std::string_view(buffer + field.value_offset, field.value_length),
+                            false, routing))
+            {
+                message_pool_->deallocate(message);
+                context.reset();
+                return {ParseStatus::FieldParseError, frame_length, nullptr,
+                        "Malformed repeating group at tag " + std::to_string(field.tag),
+                        ParseState::ERROR_RECOVERY, 0};
+            }
+        }
+        if (!message->endGroup())
+        {
+            message_pool_->deallocate(message);
+            context.reset();
+            return {ParseStatus::FieldParseError, frame_length, nullptr,
+                    "Repeating group has fewer entries than its count", ParseState::ERROR_RECOVERY, 0};
         }
 
-        return {ParseStatus::Success, length, nullptr, "Buffer processed completely",
-                context.current_state, 0};
+        if (routing.msg_type != FixMsgType::UNKNOWN)
+        {
+            message->setMsgTypeEnum(routing.msg_type);
+        }
+
+        context.reset();
+        return {ParseStatus::Success, frame_length, message, "", ParseState::IDLE, 0};
     }
 
     // =================================================================
@@ -467,6 +872,7 @@ namespace fix_gateway::protocol
 
         const char *current_ptr = buffer + start_pos;
         const char *end_ptr = buffer + end_pos;
+        GroupRouting routing;
 
         while (current_ptr < end_ptr)
         {
@@ -516,8 +922,13 @@ namespace fix_gateway::protocol
             size_t value_length = soh_ptr - value_start;
             std::string_view field_value(value_start, value_length); // Only copy when storing in FixMessage
 
-            // Store field in message
-            message->setField(field_tag, field_value);
+            // Store field in message (routing repeating group entries)
+            if (!storeField(message, field_tag, field_value, false, routing))
+            {
+                message_pool_->deallocate(message);
+                return {ParseStatus::FieldParseError, static_cast<size_t>(current_ptr - buffer), nullptr,
+                        "Malformed repeating group at tag " + std::to_string(field_tag)};
+            }
 
             // =================================================================
             // STEP 4: Move pointer forward past SOH delimiter
@@ -536,6 +947,12 @@ namespace fix_gateway::protocol
         // STEP 5: Validate parsed message
         // =================================================================
 
+        if (!message->endGroup())
+        {
+            message_pool_->deallocate(message);
+            return {ParseStatus::FieldParseError, 0, nullptr, "Repeating group has fewer entries than its count"};
+        }
+
         if (strict_validation_)
         {
             if (!validateParsedMessage(message))
@@ -562,6 +979,12 @@ namespace fix_gateway::protocol
     }
 
     StreamFixParser::ParseResult StreamFixParser::parseCompleteMessage(const char *buffer, size_t length)
+    {
+        return parseCompleteMessage(buffer, length, StreamParserUtils::peekMsgType(buffer, length));
+    }
+
+    StreamFixParser::ParseResult StreamFixParser::parseCompleteMessage(const char *buffer, size_t length,
+                                                                       FixMsgType msg_type)
     {
         if (!buffer || length == 0)
         {
@@ -572,12 +995,17 @@ namespace fix_gateway::protocol
         // STAGE 2: INTELLIGENT MESSAGE PARSING
         // =================================================================
 
-        // Start with intelligent parsing that can dispatch to optimized templates
-        ParseResult result = parseIntelligent(buffer, length);
+        // Dispatch on the type classified during framing to the registered decoder
+        ParseResult result = dispatchMessage(msg_type, buffer, length);
 
         // If intelligent parsing succeeded, we're done
         if (result.status == ParseStatus::Success)
         {
+            // Downstream components read the enum; seed it so none re-classify tag 35
+            if (result.parsed_message && msg_type != FixMsgType::UNKNOWN)
+            {
+                result.parsed_message->setMsgTypeEnum(msg_type);
+            }
             return result;
         }
 
@@ -667,39 +1095,44 @@ namespace fix_gateway::protocol
         // STEP 2: Validate and parse BodyLength field (9=XXX)
         // =================================================================
 
-        const char *current_ptr = begin_ptr;
+        // Tokenize just the BeginString and BodyLength fields - the scan stops
+        // after two table entries, so the body itself is not touched here
+        FieldToken header_fields[2];
+        FixTokenizer::Result header = FixTokenizer::tokenize(begin_ptr, static_cast<size_t>(buffer + length - begin_ptr),
+                                                             header_fields, 2);
 
-        // Skip past BeginString field to find the SOH delimiter
-        current_ptr = std::find(current_ptr, buffer + length, FIX_SOH);
-        if (current_ptr == buffer + length)
+        if (header.field_count == 0)
         {
+            // BeginString was already matched above, so only its SOH can be missing
             return {ParseStatus::NeedMoreData, 0, nullptr, "Incomplete BeginString field", ParseState::PARSING_BEGIN_STRING, 0};
         }
-        current_ptr++; // Skip SOH, now should point to '9'
 
-        // Verify we have enough bytes left for BodyLength field "9=X\x01" (minimum 4 bytes)
-        if (current_ptr + 4 > buffer + length)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Not enough data for BodyLength field", ParseState::PARSING_BODY_LENGTH, 0};
-        }
+        const char *body_length_field = begin_ptr + header_fields[0].value_offset + header_fields[0].value_length + 1;
 
-        // Validate BodyLength field format "9="
-        if (current_ptr[0] != '9' || current_ptr[1] != '=')
+        if (header.field_count < 2)
         {
-            return {ParseStatus::InvalidFormat, static_cast<size_t>(current_ptr - buffer), nullptr,
+            size_t available = static_cast<size_t>(buffer + length - body_length_field);
+            bool looks_like_body_length = available < 2 || (body_length_field[0] == '9' && body_length_field[1] == '=');
+
+            // Fewer than two fields without a tokenizer error means the buffer simply ran out
+            bool ran_out = header.status == FixTokenizer::Status::Ok || header.status == FixTokenizer::Status::Incomplete;
+            if (ran_out && looks_like_body_length)
+            {
+                return {ParseStatus::NeedMoreData, 0, nullptr, "Incomplete BodyLength value", ParseState::PARSING_BODY_LENGTH, 0};
+            }
+            return {ParseStatus::InvalidFormat, static_cast<size_t>(body_length_field - buffer), nullptr,
                     "BodyLength field not found after BeginString", ParseState::ERROR_RECOVERY, 0};
         }
 
-        // Parse body length value
-        current_ptr += 2; // Skip "9="
-        const char *body_length_start = current_ptr;
-        const char *body_length_end = std::find(current_ptr, buffer + length, FIX_SOH);
-
-        if (body_length_end == buffer + length)
+        if (header_fields[1].tag != FixFields::BodyLength)
         {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Incomplete BodyLength value", ParseState::PARSING_BODY_LENGTH, 0};
+            return {ParseStatus::InvalidFormat, static_cast<size_t>(body_length_field - buffer), nullptr,
+                    "BodyLength field not found after BeginString", ParseState::ERROR_RECOVERY, 0};
         }
 
+        const char *body_length_start = begin_ptr + header_fields[1].value_offset;
+        const char *body_length_end = body_length_start + header_fields[1].value_length;
+
         // Convert body length to integer
         int body_length = 0;
         if (!parseInteger(body_length_start, static_cast<size_t>(body_length_end - body_length_start), body_length))
@@ -717,6 +1150,10 @@ namespace fix_gateway::protocol
 
         parse_context_.expected_body_length = body_length;
 
+        // Peek tag 35, which must follow BodyLength, so decode can dispatch on the enum
+        parse_context_.msg_type = StreamParserUtils::classifyMsgTypeField(
+            body_length_end + 1, static_cast<size_t>(buffer + length - (body_length_end + 1)));
+
         // =================================================================
         // STEP 3: Calculate complete message boundaries
         // =================================================================
@@ -738,6 +1175,32 @@ namespace fix_gateway::protocol
         // STEP 4: Basic sanity check - verify message ends with checksum
         // =================================================================
 
+        // The FIX spec reading of BodyLength excludes the trailer, leaving
+        // "10=XXX|" just past message_end; take it in so the decode stage
+        // sees the whole message. Counterparties that count the trailer end
+        // on the full "|10=XXX|" instead - a plain "10=" test would also
+        // match a last body field such as 110=100.
+        constexpr size_t TRAILER = FixChecksum::TRAILER_LENGTH;
+        const size_t tail = length - message_end;
+        const bool body_closed = buffer[message_end - 1] == FIX_SOH;
+
+        const bool spec_trailer = body_closed && tail >= TRAILER &&
+                                  std::memcmp(buffer + message_end, "10=", 3) == 0 &&
+                                  buffer[message_end + TRAILER - 1] == FIX_SOH;
+        const bool trailer_counted = message_end > TRAILER && body_closed &&
+                                     std::memcmp(buffer + message_end - TRAILER - 1, "\x01" "10=", 4) == 0;
+        if (spec_trailer)
+        {
+            message_end += TRAILER;
+        }
+        else if (!trailer_counted && body_closed && tail < TRAILER &&
+                 std::memcmp(buffer + message_end, "10=", std::min<size_t>(tail, 3)) == 0)
+        {
+            // The body arrived but its trailer is still in flight
+            return {ParseStatus::NeedMoreData, 0, nullptr, "Incomplete CheckSum trailer",
+                    ParseState::PARSING_CHECKSUM, 0};
+        }
+
         if (message_end >= 7) // Ensure we have room for "10=XXX\x01"
         {
             const char *checksum_start = buffer + message_end - 7;
@@ -773,620 +1236,299 @@ namespace fix_gateway::protocol
         return true;
     }
 
-    bool StreamFixParser::validateParsedMessage(FixMessage *message)
-    {
-        if (!message)
-            return false;
-
-        // Check required fields
-        return message->hasField(FixFields::BeginString) &&
-               message->hasField(FixFields::BodyLength) &&
-               message->hasField(FixFields::MsgType) &&
-               message->hasField(FixFields::CheckSum);
-    }
-
-    bool StreamFixParser::validateMessageChecksum(const char *buffer, size_t length)
+    StreamFixParser::ParseResult StreamFixParser::extractFields(FixMessage *msg, const char *message_start,
+                                                               const char *body_start, const char *body_end,
+                                                               uint32_t *byte_sum)
     {
-        // Find checksum field (10=XXX) - should be at the end
-        const char *checksum_pos = buffer + length - 7; // "10=XXX\x01" = 7 characters
+        FieldToken fields[FixTokenizer::DEFAULT_TABLE_SIZE];
+        const char *scan_ptr = body_start;
+        GroupRouting routing;
 
-        if (checksum_pos < buffer ||
-            checksum_pos[0] != '1' || checksum_pos[1] != '0' || checksum_pos[2] != '=')
+        // View mode: values stay in the pinned receive segment instead of being copied
+        const bool as_view = receive_segment_ &&
+                             receive_segment_->contains(message_start, static_cast<size_t>(body_end - message_start));
+        if (as_view)
         {
-            return false;
+            msg->attachSegment(receive_segment_);
         }
 
-        // Calculate actual checksum (sum of all bytes before checksum field)
-        uint8_t calculated_checksum = 0;
-        for (const char *ptr = buffer; ptr < checksum_pos; ++ptr)
+        // Header bytes (8=..., 9=...) are outside the tokenized range
+        if (byte_sum)
         {
-            calculated_checksum += static_cast<uint8_t>(*ptr);
+            *byte_sum += FixChecksum::byteSum(message_start, static_cast<size_t>(body_start - message_start));
         }
-        calculated_checksum %= 256;
 
-        // Parse expected checksum
-        int expected_checksum = 0;
-        if (!parseInteger(checksum_pos + 3, 3, expected_checksum))
+        while (scan_ptr < body_end)
         {
-            return false;
-        }
+            // The first pass folds the whole body into byte_sum; resumed passes must not re-add it
+            FixTokenizer::Result tok = FixTokenizer::tokenize(scan_ptr, static_cast<size_t>(body_end - scan_ptr),
+                                                              fields, FixTokenizer::DEFAULT_TABLE_SIZE,
+                                                              scan_ptr == body_start ? byte_sum : nullptr);
 
-        return calculated_checksum == static_cast<uint8_t>(expected_checksum);
-    }
+            for (size_t i = 0; i < tok.field_count; ++i)
+            {
+                std::string_view value(scan_ptr + fields[i].value_offset, fields[i].value_length);
+                if (!storeField(msg, fields[i].tag, value, as_view, routing))
+                {
+                    return {ParseStatus::FieldParseError, static_cast<size_t>(scan_ptr - message_start), nullptr,
+                            "Malformed repeating group at tag " + std::to_string(fields[i].tag),
+                            ParseState::ERROR_RECOVERY, 0};
+                }
+            }
 
-    // =================================================================
-    // PARTIAL MESSAGE HANDLING (TCP fragmentation)
-    // =================================================================
-
-    StreamFixParser::ParseResult StreamFixParser::handlePartialMessage(const char *new_buffer, size_t new_length)
-    {
-        // Combine partial buffer with new data
-        size_t total_length = partial_buffer_size_ + new_length;
+            size_t error_offset = static_cast<size_t>(scan_ptr + tok.bytes_consumed - message_start);
+            switch (tok.status)
+            {
+            case FixTokenizer::Status::Ok:
+                break;
+            case FixTokenizer::Status::MissingEquals:
+                return {ParseStatus::InvalidFormat, error_offset, nullptr,
+                        "Missing '=' in field", ParseState::ERROR_RECOVERY, 0};
+            case FixTokenizer::Status::InvalidTag:
+                return {ParseStatus::FieldParseError, error_offset, nullptr,
+                        "Invalid field tag", ParseState::ERROR_RECOVERY, 0};
+            case FixTokenizer::Status::Incomplete:
+                return {ParseStatus::InvalidFormat, error_offset, nullptr,
+                        "Missing SOH after field", ParseState::ERROR_RECOVERY, 0};
+            }
 
-        if (total_length > PARTIAL_BUFFER_SIZE)
-        {
-            reset(); // Clear partial buffer
-            return {ParseStatus::MessageTooLarge, 0, nullptr, "Combined message too large"};
+            // Table filled before the body ended - resume after the last emitted field
+            scan_ptr += tok.bytes_consumed;
         }
 
-        // Append new data to partial buffer
-        std::memcpy(partial_buffer_ + partial_buffer_size_, new_buffer, new_length);
-        partial_buffer_size_ += new_length;
-
-        // reset the parse context
-        parse_context_.reset();
-
-        // Dispatch directly into the core state machine to avoid recursion
-        ParseResult result = processStateMachine(partial_buffer_, partial_buffer_size_, parse_context_);
-
-        if (result.status == ParseStatus::Success)
+        // A group running to the end of the body must still match its count
+        if (!msg->endGroup())
         {
-            // Successfully parsed - clear partial buffer
-            partial_buffer_size_ = 0;
+            return {ParseStatus::FieldParseError, static_cast<size_t>(body_end - message_start), nullptr,
+                    "Repeating group has fewer entries than its count", ParseState::ERROR_RECOVERY, 0};
         }
-        else if (result.status == ParseStatus::NeedMoreData)
-        {
-            // Still incomplete - update partial buffer size
-            partial_buffer_size_ = total_length;
-        }
-        else
-        {
-            // Parse error - clear partial buffer
-            partial_buffer_size_ = 0;
-        }
-
-        return result;
-    }
-
-    void StreamFixParser::storePartialMessage(const char *buffer, size_t length)
-    {
-        if (length > 0 && length <= PARTIAL_BUFFER_SIZE)
-        {
-            std::memcpy(partial_buffer_, buffer, length);
-            partial_buffer_size_ = length;
-        }
-    }
-
-    void StreamFixParser::reset()
-    {
-        partial_buffer_size_ = 0;
-        std::memset(partial_buffer_, 0, sizeof(partial_buffer_));
-        parse_context_.reset();
-        resetErrorRecovery();
-    }
 
-    // =================================================================
-    // STATISTICS TRACKING
-    // =================================================================
-
-    void StreamFixParser::updateStats(ParseStatus status, uint64_t parse_time_ns)
-    {
-        if (status == ParseStatus::Success)
-        {
-            stats_.messages_parsed++;
-            stats_.total_parse_time_ns += parse_time_ns;
-            stats_.max_parse_time_ns = std::max(stats_.max_parse_time_ns, parse_time_ns);
-            stats_.min_parse_time_ns = std::min(stats_.min_parse_time_ns, parse_time_ns);
-        }
-        else
-        {
-            stats_.parse_errors++;
-            if (status == ParseStatus::ChecksumError)
-                stats_.checksum_errors++;
-            if (status == ParseStatus::AllocationFailed)
-                stats_.allocation_failures++;
-        }
+        return {ParseStatus::Success, static_cast<size_t>(body_end - message_start), msg, "", ParseState::IDLE, 0};
     }
 
-    // =================================================================
-    // STATE HANDLERS IMPLEMENTATION
-    // =================================================================
-
-    StreamFixParser::ParseResult StreamFixParser::handleIdleState(const char *buffer, size_t length, ParseContext &context)
+    bool StreamFixParser::storeField(FixMessage *msg, int tag, std::string_view value, bool as_view,
+                                     GroupRouting &routing)
     {
-        // Start looking for BeginString (8=FIX.4.4)
-        if (length < 9) // Minimum size for "8=FIX.4.4"
-        {
-            partial_buffer_size_ += length;
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Not enough data for BeginString",
-                    ParseState::IDLE, 0};
-        }
-
-        // Look for FIX begin string
-        const char *fix_start = std::search(buffer, buffer + length,
-                                            FIX_BEGIN_STRING, FIX_BEGIN_STRING + strlen(FIX_BEGIN_STRING));
-
-        if (fix_start == buffer + length)
+        // Inside a repeating group: members become entry fields, any other tag closes it
+        if (msg->inGroup())
         {
-            // No BeginString found - might be corrupted data
-            if (length > 512) // If we've scanned a lot without finding BeginString
+            FixFieldStore::GroupAppend appended = msg->addGroupField(tag, value);
+            if (appended != FixFieldStore::GroupAppend::NotMember)
             {
-                return attemptErrorRecovery(buffer, length, context, "BeginString not found in large buffer");
+                return appended == FixFieldStore::GroupAppend::Added;
             }
-            return {ParseStatus::NeedMoreData, 0, nullptr, "BeginString not found",
-                    ParseState::IDLE, 0};
-        }
-
-        // Found BeginString - calculate position
-        size_t begin_string_pos = fix_start - buffer;
-        context.message_start_pos = begin_string_pos;
-
-        // Skip any corrupted data before BeginString
-        if (begin_string_pos > 0)
-        {
-            return {ParseStatus::NeedMoreData, begin_string_pos, nullptr,
-                    "Skipped " + std::to_string(begin_string_pos) + " bytes to find BeginString",
-                    ParseState::IDLE, 0};
         }
 
-        // BeginString found at start of buffer - transition to PARSING_BEGIN_STRING state
-        // to properly validate and consume it
-        if (!transitionToState(ParseState::PARSING_BEGIN_STRING, context))
+        if (tag == FixFields::MsgType)
         {
-            return {ParseStatus::StateTransitionError, 0, nullptr,
-                    "Failed to transition to PARSING_BEGIN_STRING", ParseState::ERROR_RECOVERY, 0};
+            routing.msg_type = FixMsgTypeUtils::fromString(value);
+            routing.has_groups = FixGroups::hasGroups(routing.msg_type);
         }
-
-        return {ParseStatus::NeedMoreData, begin_string_pos, nullptr, "BeginString located, transitioning to validation",
-                ParseState::PARSING_BEGIN_STRING, 0};
-    }
-
-    StreamFixParser::ParseResult StreamFixParser::handleParsingBeginString(const char *buffer, size_t length, ParseContext &context)
-    {
-        // In PARSING_BEGIN_STRING state, we need to validate and consume the BeginString
-        // The buffer should be positioned at the start of "8=FIX.4.4"
-
-        size_t consumed = 0;
-        if (!validateBeginString(buffer, length, consumed))
+        else if (routing.has_groups)
         {
-            return {ParseStatus::InvalidFormat, 0, nullptr, "Invalid BeginString format",
-                    ParseState::ERROR_RECOVERY, 0};
+            if (const FixGroupDefinition *group = FixGroups::find(routing.msg_type, tag))
+            {
+                int entries = 0;
+                return parseInteger(value.data(), value.size(), entries) && msg->beginGroup(group, entries);
+            }
         }
 
-        if (consumed == 0)
+        if (as_view)
         {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data to complete BeginString",
-                    ParseState::PARSING_BEGIN_STRING, 0};
+            msg->setFieldView(tag, value);
         }
-
-        // BeginString validated and consumed - transition to parsing body length
-        if (!transitionToState(ParseState::PARSING_BODY_LENGTH, context))
+        else
         {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to PARSING_BODY_LENGTH", ParseState::ERROR_RECOVERY, consumed};
+            msg->setField(tag, value);
         }
-
-        return {ParseStatus::NeedMoreData, consumed, nullptr, "BeginString validated, transitioning to BodyLength",
-                ParseState::PARSING_BODY_LENGTH, 0};
+        return true;
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleParsingBodyLength(const char *buffer, size_t length, ParseContext &context)
+    bool StreamFixParser::validateParsedMessage(FixMessage *message)
     {
-        size_t consumed = 0;
-        if (!validateBodyLength(buffer, length, context, consumed))
-        {
-            return {ParseStatus::InvalidFormat, consumed, nullptr, "Invalid BodyLength format",
-                    ParseState::ERROR_RECOVERY, consumed};
-        }
-
-        if (consumed == 0)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data for BodyLength",
-                    ParseState::PARSING_BODY_LENGTH, 0};
-        }
-
-        // Transition to parsing regular fields - we successfully parsed the body length
-        if (!transitionToState(ParseState::PARSING_TAG, context))
-        {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to PARSING_TAG", ParseState::ERROR_RECOVERY, consumed};
-        }
+        if (!message)
+            return false;
 
-        return {ParseStatus::NeedMoreData, consumed, nullptr, "BodyLength parsed, transitioning to field parsing",
-                ParseState::PARSING_TAG, 0};
+        // Check required fields
+        return message->hasField(FixFields::BeginString) &&
+               message->hasField(FixFields::BodyLength) &&
+               message->hasField(FixFields::MsgType) &&
+               message->hasField(FixFields::CheckSum);
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleParsingTag(const char *buffer, size_t length, ParseContext &context)
+    bool StreamFixParser::validateMessageChecksum(const char *buffer, size_t length)
     {
-        // In PARSING_TAG state, we need to parse the field tag number (digits before '=')
-
-        // Find the '=' character that separates tag from value
-        const char *equals_pos = std::find(buffer, buffer + length, '=');
-
-        if (equals_pos == buffer + length)
-        {
-            // No '=' found - might need more data or could be malformed
-            if (length > 10) // Field tags shouldn't be longer than ~5 digits typically
-            {
-                return {ParseStatus::InvalidFormat, 0, nullptr, "Field tag too long or missing '='",
-                        ParseState::ERROR_RECOVERY, 0};
-            }
-
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data to find '=' after tag",
-                    ParseState::PARSING_TAG, 0};
-        }
-
-        // Calculate tag length
-        size_t tag_length = equals_pos - buffer;
-
-        if (tag_length == 0)
-        {
-            return {ParseStatus::InvalidFormat, 0, nullptr, "Empty field tag",
-                    ParseState::ERROR_RECOVERY, 0};
-        }
-
-        // Parse the tag number
-        int field_tag = 0;
-        if (!parseInteger(buffer, tag_length, field_tag))
-        {
-            return {ParseStatus::FieldParseError, tag_length, nullptr,
-                    "Invalid field tag number: " + std::string(buffer, tag_length),
-                    ParseState::ERROR_RECOVERY, 0};
-        }
+        // Find checksum field (10=XXX) - should be at the end
+        const char *checksum_pos = buffer + length - 7; // "10=XXX\x01" = 7 characters
 
-        // Validate the field tag
-        if (!isValidFieldTag(field_tag))
+        if (checksum_pos < buffer ||
+            checksum_pos[0] != '1' || checksum_pos[1] != '0' || checksum_pos[2] != '=')
         {
-            return {ParseStatus::FieldParseError, tag_length, nullptr,
-                    "Invalid field tag value: " + std::to_string(field_tag),
-                    ParseState::ERROR_RECOVERY, 0};
+            return false;
         }
 
-        // Store the parsed tag in context
-        context.current_field_tag = field_tag;
-
-        // Set field start position for error reporting (position where this field started)
-        context.field_start_position = context.buffer_position;
-
-        // Calculate bytes consumed (just the tag, not the '=')
-        size_t consumed = tag_length;
+        // Calculate actual checksum (sum of all bytes before checksum field)
+        uint8_t calculated_checksum = FixChecksum::compute(buffer, static_cast<size_t>(checksum_pos - buffer));
 
-        // Transition to expecting equals state (we found '=' but haven't consumed it yet)
-        if (!transitionToState(ParseState::EXPECTING_EQUALS, context))
+        // Parse expected checksum
+        uint8_t expected_checksum = 0;
+        if (!FixChecksum::parse(checksum_pos + 3, expected_checksum))
         {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to EXPECTING_EQUALS", ParseState::ERROR_RECOVERY, consumed};
+            return false;
         }
 
-        return {ParseStatus::NeedMoreData, consumed, nullptr,
-                "Field tag " + std::to_string(field_tag) + " parsed successfully",
-                ParseState::EXPECTING_EQUALS, 0};
+        return calculated_checksum == expected_checksum;
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleExpectingEquals(const char *buffer, size_t length, ParseContext &context)
+    uint8_t StreamFixParser::calculateChecksum(const char *buffer, size_t length)
     {
-        // In EXPECTING_EQUALS state, we should be positioned at the '=' character
-        // We just need to validate it's there and consume it
-
-        if (length == 0)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data for '=' character",
-                    ParseState::EXPECTING_EQUALS, 0};
-        }
-
-        // Check that the first character is '='
-        if (buffer[0] != '=')
-        {
-            return {ParseStatus::InvalidFormat, 0, nullptr,
-                    "Expected '=' after field tag " + std::to_string(context.current_field_tag) +
-                        ", found '" + std::string(1, buffer[0]) + "'",
-                    ParseState::ERROR_RECOVERY, 0};
-        }
-
-        // Consume the '=' character
-        size_t consumed = 1;
-
-        // Transition to parsing the field value
-        if (!transitionToState(ParseState::PARSING_VALUE, context))
-        {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to PARSING_VALUE", ParseState::ERROR_RECOVERY, consumed};
-        }
-
-        return {ParseStatus::NeedMoreData, consumed, nullptr,
-                "Found '=' after field tag " + std::to_string(context.current_field_tag),
-                ParseState::PARSING_VALUE, 0};
+        return FixChecksum::compute(buffer, length);
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleParsingValue(const char *buffer, size_t length, ParseContext &context)
+    // =================================================================
+    // PARTIAL MESSAGE HANDLING (TCP fragmentation)
+    // =================================================================
+
+    StreamFixParser::ParseResult StreamFixParser::handlePartialMessage(const char *new_buffer, size_t new_length)
     {
-        // In PARSING_VALUE state, we need to find the SOH delimiter and extract the field value
+        // Combine partial buffer with new data
+        size_t total_length = partial_buffer_size_ + new_length;
 
-        // Update field_start_position for error reporting consistency
-        // This tracks where the field value parsing starts (after the '=' sign)
-        if (context.field_start_position == 0)
+        if (total_length > PARTIAL_BUFFER_SIZE)
         {
-            context.field_start_position = context.buffer_position;
+            reset(); // Clear partial buffer
+            return {ParseStatus::MessageTooLarge, 0, nullptr, "Combined message too large"};
         }
 
-        // Look for SOH delimiter that marks the end of the field value
-        const char *soh_pos = std::find(buffer, buffer + length, FIX_SOH);
-
-        if (soh_pos == buffer + length)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data to find SOH after field value",
-                    ParseState::PARSING_VALUE, 0};
-        }
+        // Append new data to partial buffer
+        std::memcpy(partial_buffer_ + partial_buffer_size_, new_buffer, new_length);
+        partial_buffer_size_ = total_length;
+        tail_scanner_.reset();
 
-        // Calculate the length of the field value (everything before SOH)
-        size_t value_length = soh_pos - buffer;
+        // The context is NOT reset: the scanner resumes at the first appended byte
+        ParseResult result = parseWithState(partial_buffer_, partial_buffer_size_, parse_context_);
 
-        // Handle empty field values (some FIX fields can be empty)
-        if (value_length == 0)
+        if (result.status == ParseStatus::Success)
         {
-            context.partial_field_value = "";
+            // Keep whatever followed the message as the start of the next one
+            size_t remaining = partial_buffer_size_ - result.bytes_consumed;
+            std::memmove(partial_buffer_, partial_buffer_ + result.bytes_consumed, remaining);
+            partial_buffer_size_ = remaining;
         }
-        else
+        else if (result.status == ParseStatus::NeedMoreData)
         {
-            // Extract the field value
-            std::string_view field_value(buffer, value_length);
-            context.partial_field_value = field_value;
+            stats_.partial_messages_handled++;
         }
-
-        // Transition to EXPECTING_SOH state (SOH found but not consumed yet)
-        if (!transitionToState(ParseState::EXPECTING_SOH, context))
+        else
         {
-            return {ParseStatus::StateTransitionError, value_length, nullptr,
-                    "Failed to transition to EXPECTING_SOH", ParseState::ERROR_RECOVERY, value_length};
+            // Parse error - clear partial buffer
+            partial_buffer_size_ = 0;
         }
 
-        return {ParseStatus::NeedMoreData, value_length, nullptr,
-                "Field value parsed for tag " + std::to_string(context.current_field_tag) +
-                    ": '" + context.partial_field_value + "'",
-                ParseState::EXPECTING_SOH, 0};
+        return result;
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleExpectingSOH(const char *buffer, size_t length, ParseContext &context)
+    void StreamFixParser::storePartialMessage(const char *buffer, size_t length)
     {
-        // In EXPECTING_SOH state, we should be positioned at the SOH character
-
-        if (length == 0)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data for SOH character",
-                    ParseState::EXPECTING_SOH, 0};
-        }
-
-        if (buffer[0] != FIX_SOH)
+        if (length > 0 && length <= PARTIAL_BUFFER_SIZE)
         {
-            return {ParseStatus::InvalidFormat, 0, nullptr,
-                    "Expected SOH after field " + std::to_string(context.current_field_tag) +
-                        "=" + context.partial_field_value + ", found '" + std::string(1, buffer[0]) + "'",
-                    ParseState::ERROR_RECOVERY, 0};
+            std::memcpy(partial_buffer_, buffer, length);
+            partial_buffer_size_ = length;
+            tail_scanner_.reset();
         }
+    }
 
-        // CRITICAL: Store the completed field
-        context.parsed_fields.emplace_back(context.current_field_tag, context.partial_field_value);
-
-        // Update body bytes parsed (tag + "=" + value + SOH)
-        context.total_body_bytes_parsed += std::to_string(context.current_field_tag).length() + 1 +
-                                           context.partial_field_value.length() + 1;
-
-        size_t consumed = 1; // Consume the SOH
+    void StreamFixParser::reset()
+    {
+        partial_buffer_size_ = 0;
+        std::memset(partial_buffer_, 0, sizeof(partial_buffer_));
+        tail_scanner_.reset();
+        parse_context_.reset();
+        resetErrorRecovery();
+    }
 
-        // Clear current field context for next field
-        int stored_tag = context.current_field_tag;             // For logging
-        std::string stored_value = context.partial_field_value; // For logging
-        context.current_field_tag = 0;
-        context.partial_field_value.clear();
+    // =================================================================
+    // STATISTICS TRACKING
+    // =================================================================
 
-        // Determine next state: Are we done with the message body?
-        ParseState next_state;
-        if (context.total_body_bytes_parsed >= context.expected_body_length)
+    void StreamFixParser::updateStats(ParseStatus status, uint64_t parse_time_ns)
+    {
+        if (status == ParseStatus::Success)
         {
-            // We've parsed all body fields, next should be checksum (10=XXX)
-            next_state = ParseState::PARSING_CHECKSUM;
+            stats_.messages_parsed++;
+            stats_.total_parse_time_ns += parse_time_ns;
+            if (parse_time_ns > stats_.max_parse_time_ns)
+                stats_.max_parse_time_ns.set(parse_time_ns);
+            if (parse_time_ns < stats_.min_parse_time_ns)
+                stats_.min_parse_time_ns.set(parse_time_ns);
+            stats_.parse_time_histogram.record(parse_time_ns);
         }
         else
         {
-            // More fields to parse in the body
-            next_state = ParseState::PARSING_TAG;
-        }
-
-        // Transition to the determined next state
-        if (!transitionToState(next_state, context))
-        {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to " + std::string(next_state == ParseState::PARSING_CHECKSUM ? "PARSING_CHECKSUM" : "PARSING_TAG"),
-                    ParseState::ERROR_RECOVERY, consumed};
+            stats_.parse_errors++;
+            if (status == ParseStatus::ChecksumError)
+                stats_.checksum_errors++;
+            if (status == ParseStatus::AllocationFailed)
+                stats_.allocation_failures++;
         }
-
-        std::string next_state_name = (next_state == ParseState::PARSING_CHECKSUM) ? "PARSING_CHECKSUM" : "PARSING_TAG";
-        return {ParseStatus::NeedMoreData, consumed, nullptr,
-                "Stored field " + std::to_string(stored_tag) + "='" + stored_value +
-                    "', transitioning to " + next_state_name,
-                next_state, 0};
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleParsingChecksum(const char *buffer, size_t length, ParseContext &context)
+    StreamFixParser::ParserStats::Snapshot StreamFixParser::ParserStats::snapshot() const
     {
-        // In PARSING_CHECKSUM state, we need to parse the checksum field: 10=XXX\x01
-
-        // Check if we have minimum data for checksum field "10=X\x01" (5 bytes minimum)
-        if (length < 5)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data for checksum field",
-                    ParseState::PARSING_CHECKSUM, 0};
-        }
-
-        // Validate checksum field starts with "10="
-        if (buffer[0] != '1' || buffer[1] != '0' || buffer[2] != '=')
-        {
-            return {ParseStatus::InvalidFormat, 0, nullptr,
-                    "Expected checksum field '10=', found '" + std::string(buffer, std::min((size_t)3, length)) + "'",
-                    ParseState::ERROR_RECOVERY, 0};
-        }
-
-        // Find SOH that terminates the checksum field
-        const char *soh_pos = std::find(buffer + 3, buffer + length, FIX_SOH);
-        if (soh_pos == buffer + length)
-        {
-            return {ParseStatus::NeedMoreData, 0, nullptr, "Need more data to find SOH after checksum",
-                    ParseState::PARSING_CHECKSUM, 0};
-        }
-
-        // Extract checksum value
-        size_t checksum_value_length = soh_pos - (buffer + 3);
-        if (checksum_value_length == 0)
-        {
-            return {ParseStatus::InvalidFormat, 3, nullptr, "Empty checksum value",
-                    ParseState::ERROR_RECOVERY, 3};
-        }
-
-        // Parse checksum as string (like other field values)
-        std::string checksum_value(buffer + 3, checksum_value_length);
-
-        // Basic validation - checksum should be 3 digits (001-255)
-        if (checksum_value_length != 3)
-        {
-            return {ParseStatus::InvalidFormat, 3 + checksum_value_length, nullptr,
-                    "Invalid checksum format - expected 3 digits, got: '" + checksum_value + "'",
-                    ParseState::ERROR_RECOVERY, 3 + checksum_value_length};
-        }
-
-        // Validate checksum contains only digits
-        for (char c : checksum_value)
-        {
-            if (c < '0' || c > '9')
-            {
-                return {ParseStatus::InvalidFormat, 3 + checksum_value_length, nullptr,
-                        "Invalid checksum - non-numeric character: '" + checksum_value + "'",
-                        ParseState::ERROR_RECOVERY, 3 + checksum_value_length};
-            }
-        }
-
-        // Store checksum field like any other field
-        context.parsed_fields.emplace_back(FixFields::CheckSum, checksum_value);
-
-        // Calculate total bytes consumed (10=XXX\x01)
-        size_t consumed = 3 + checksum_value_length + 1; // "10=" + value + SOH
-
-        // Checksum parsed successfully - transition to MESSAGE_COMPLETE state
-        if (!transitionToState(ParseState::MESSAGE_COMPLETE, context))
-        {
-            return {ParseStatus::StateTransitionError, consumed, nullptr,
-                    "Failed to transition to MESSAGE_COMPLETE", ParseState::ERROR_RECOVERY, consumed};
-        }
-
-        return {ParseStatus::FinishedParsingFields, consumed, nullptr,
-                "Checksum parsed, transitioning to MESSAGE_COMPLETE",
-                ParseState::MESSAGE_COMPLETE, 0};
+        Snapshot snap;
+        snap.messages_parsed = messages_parsed;
+        snap.parse_errors = parse_errors;
+        snap.checksum_errors = checksum_errors;
+        snap.allocation_failures = allocation_failures;
+        snap.field_parse_errors = field_parse_errors;
+        snap.total_parse_time_ns = total_parse_time_ns;
+        snap.max_parse_time_ns = max_parse_time_ns;
+        snap.min_parse_time_ns = min_parse_time_ns;
+        snap.state_transitions = state_transitions;
+        snap.partial_messages_handled = partial_messages_handled;
+        snap.error_recoveries = error_recoveries;
+        snap.corrupted_data_skipped = corrupted_data_skipped;
+        snap.prefilter_passed_through = prefilter_passed_through;
+        snap.prefilter_dropped = prefilter_dropped;
+        for (size_t i = 0; i < FixMsgTypeUtils::MSG_TYPE_COUNT; ++i)
+        {
+            snap.prefiltered_by_type[i] = prefiltered_by_type[i];
+        }
+        for (size_t i = 0; i < PARSE_STATE_COUNT; ++i)
+        {
+            snap.errors_by_state[i] = errors_by_state[i];
+        }
+        for (size_t i = 0; i < PARSE_STATUS_COUNT; ++i)
+        {
+            snap.error_frequency[i] = error_frequency[i];
+        }
+        snap.parse_time = parse_time_histogram.snapshot();
+        return snap;
     }
 
-    StreamFixParser::ParseResult StreamFixParser::handleMessageComplete(const char *buffer, size_t length, ParseContext &context)
+    void StreamFixParser::ParserStats::reset()
     {
-        // Message is complete - allocate and populate the final message
-        FixMessage *message = message_pool_->allocate();
-        if (!message)
+        for (Counter *counter : {&messages_parsed, &parse_errors, &checksum_errors, &allocation_failures,
+                                 &total_parse_time_ns, &max_parse_time_ns, &state_transitions,
+                                 &partial_messages_handled, &error_recoveries, &corrupted_data_skipped,
+                                 &field_parse_errors, &prefilter_passed_through, &prefilter_dropped})
         {
-            return {ParseStatus::AllocationFailed, 0, nullptr, "MessagePool allocation failed",
-                    ParseState::ERROR_RECOVERY, 0};
+            counter->set(0);
         }
-
-        // Populate message with all parsed fields
-        for (const auto &field : context.parsed_fields)
+        min_parse_time_ns.set(UINT64_MAX);
+        for (auto &count : errors_by_state)
         {
-            message->setField(field.first, field.second);
+            count.set(0);
         }
-
-        // Set required header fields that were parsed in earlier states
-        message->setField(FixFields::BeginString, std::string_view("FIX.4.4"));
-        message->setField(FixFields::BodyLength, FastStringConversion::make_permanent(
-                                                     FastStringConversion::int_to_string(static_cast<int>(context.expected_body_length))));
-
-        // Extract MsgType from parsed fields (it should be field 35)
-        auto msg_type_field = std::find_if(context.parsed_fields.begin(), context.parsed_fields.end(),
-                                           [](const std::pair<int, std::string> &field)
-                                           {
-                                               return field.first == FixFields::MsgType; // 35
-                                           });
-        if (msg_type_field != context.parsed_fields.end())
+        for (auto &count : error_frequency)
         {
-            message->setField(FixFields::MsgType, msg_type_field->second);
+            count.set(0);
         }
-
-        // Optional: Validate checksum if enabled
-        if (validate_checksum_)
+        for (auto &count : prefiltered_by_type)
         {
-            // Find the checksum field that was just parsed
-            auto checksum_field = std::find_if(context.parsed_fields.begin(), context.parsed_fields.end(),
-                                               [](const std::pair<int, std::string> &field)
-                                               {
-                                                   return field.first == FixFields::CheckSum;
-                                               });
-
-            if (checksum_field != context.parsed_fields.end())
-            {
-                // Reconstruct message for checksum calculation (without checksum field)
-                std::string message_for_checksum = "8=FIX.4.4";
-                message_for_checksum += FIX_SOH;
-                message_for_checksum += "9=" + std::to_string(context.expected_body_length);
-                message_for_checksum += FIX_SOH;
-
-                // Add all parsed fields except checksum
-                for (const auto &field : context.parsed_fields)
-                {
-                    if (field.first != FixFields::CheckSum)
-                    {
-                        message_for_checksum += std::to_string(field.first) + "=" + field.second;
-                        message_for_checksum += FIX_SOH;
-                    }
-                }
-
-                // Calculate expected checksum
-                uint8_t calculated_checksum = 0;
-                for (char c : message_for_checksum)
-                {
-                    calculated_checksum += static_cast<uint8_t>(c);
-                }
-                calculated_checksum %= 256;
-
-                // Parse received checksum
-                int received_checksum = std::stoi(checksum_field->second);
-
-                // Validate checksums match
-                if (calculated_checksum != static_cast<uint8_t>(received_checksum))
-                {
-                    message_pool_->deallocate(message);
-                    return {ParseStatus::ChecksumError, 0, nullptr,
-                            "Checksum validation failed: expected " + std::to_string(calculated_checksum) +
-                                ", received " + std::to_string(received_checksum),
-                            ParseState::ERROR_RECOVERY, 0};
-                }
-            }
+            count.set(0);
         }
-
-        // Calculate total message length for the return result
-        size_t total_message_length = strlen(FIX_BEGIN_STRING) + 1 +                              // BeginString + SOH
-                                      std::to_string(context.expected_body_length).length() + 3 + // "9=" + length + SOH
-                                      context.expected_body_length +                              // Body
-                                      7;                                                          // "10=XXX" + SOH (checksum)
-
-        // Reset context for next message
-        context.reset();
-
-        return {ParseStatus::Success, total_message_length, message,
-                "Message parsed successfully with " + std::to_string(message->getFieldCount()) + " fields",
-                ParseState::IDLE, 0};
+        parse_time_histogram.reset();
     }
 
     // =================================================================
@@ -1542,71 +1684,6 @@ namespace fix_gateway::protocol
     // ENHANCED VALIDATION FUNCTIONS
     // =================================================================
 
-    bool StreamFixParser::validateBeginString(const char *buffer, size_t length, size_t &consumed)
-    {
-        consumed = 0;
-
-        if (length < strlen(FIX_BEGIN_STRING) + 1) // +1 for SOH
-        {
-            return false; // Need more data
-        }
-
-        // Check if buffer starts with "8=FIX.4.4"
-        if (std::strncmp(buffer, FIX_BEGIN_STRING, strlen(FIX_BEGIN_STRING)) != 0)
-        {
-            return false; // Invalid BeginString
-        }
-
-        // Find SOH delimiter
-        const char *soh_pos = std::find(buffer + strlen(FIX_BEGIN_STRING), buffer + length, FIX_SOH);
-        if (soh_pos == buffer + length)
-        {
-            return false; // SOH not found - need more data
-        }
-
-        consumed = (soh_pos - buffer) + 1; // Include SOH in consumed bytes
-        return true;
-    }
-
-    bool StreamFixParser::validateBodyLength(const char *buffer, size_t length, ParseContext &context, size_t &consumed)
-    {
-        consumed = 0;
-
-        // Look for "9=" pattern
-        if (length < 3 || buffer[0] != '9' || buffer[1] != '=')
-        {
-            return false; // Invalid BodyLength format
-        }
-
-        // Find SOH after body length value
-        const char *soh_pos = std::find(buffer + 2, buffer + length, FIX_SOH);
-        if (soh_pos == buffer + length)
-        {
-            return false; // SOH not found - need more data
-        }
-
-        // Parse body length value
-        int body_length = 0;
-        size_t value_length = soh_pos - (buffer + 2);
-
-        if (!parseInteger(buffer + 2, value_length, body_length) || body_length <= 0)
-        {
-            return false; // Invalid body length value
-        }
-
-        // Validate body length is reasonable
-        if (body_length > static_cast<int>(max_message_size_))
-        {
-            return false; // Body length exceeds maximum
-        }
-
-        // Store body length in context
-        context.expected_body_length = static_cast<size_t>(body_length);
-        consumed = (soh_pos - buffer) + 1; // Include SOH
-
-        return true;
-    }
-
     bool StreamFixParser::isValidFieldTag(int tag)
     {
         // Basic validation - FIX field tags are positive integers
@@ -1640,11 +1717,15 @@ namespace fix_gateway::protocol
 
     void StreamFixParser::updateErrorStats(ParseStatus error_status, ParseState error_state)
     {
-        stats_.error_frequency[error_status]++;
-        stats_.errors_by_state[error_state]++;
+        stats_.error_frequency[static_cast<size_t>(error_status)]++;
+        stats_.errors_by_state[static_cast<size_t>(error_state)]++;
 
-        // Update context error tracking
-        parse_context_.consecutive_errors++;
+        // Update context error tracking. An exhausted pool is backpressure,
+        // not bad input - retrying it must not trip the circuit breaker.
+        if (error_status != ParseStatus::AllocationFailed)
+        {
+            parse_context_.consecutive_errors++;
+        }
         parse_context_.error_count_in_session++;
         parse_context_.last_error_time = std::chrono::steady_clock::now();
 
@@ -1743,55 +1824,90 @@ namespace fix_gateway::protocol
         return std::string_view{value_start, static_cast<size_t>(soh_pos - value_start)};
     }
 
-    // Intelligent parsing implementation - framework for future optimization
-    StreamFixParser::ParseResult StreamFixParser::parseIntelligent(const char *buffer, size_t length)
+    FixMsgType StreamParserUtils::classifyMsgTypeField(const char *field, size_t available)
     {
-        std::string_view msg_type = StreamParserUtils::extractMsgType(buffer, length);
-
-        if (msg_type.empty())
+        if (available < 5 || field[0] != '3' || field[1] != '5' || field[2] != '=')
         {
-            // Fall back to legacy parsing without recursion
-            size_t message_start = 0;
-            size_t message_end = length;
-            return parseMessage(buffer, message_start, message_end);
+            return FixMsgType::UNKNOWN;
         }
 
-        // Message type detection successful - dispatch to optimized parsers
-
-        // Template-optimized parsing for performance-critical message types (INCOMING MESSAGES ONLY)
-        // Note: NEW_ORDER_SINGLE removed - we don't receive these from exchange/broker
-
-        // Template-optimized parsing for incoming message types
-        if (msg_type == "8") // EXECUTION_REPORT
+        if (field[4] == FIX_SOH)
         {
-            return OptimizedParser<FixMsgType::EXECUTION_REPORT>::parseExecutionReport(this, buffer, length);
+            return FixMsgTypeUtils::fromCode(FixMsgTypeUtils::msgTypeCode(field[3]));
         }
-        else if (msg_type == "0") // HEARTBEAT
-        {
-            return OptimizedParser<FixMsgType::HEARTBEAT>::parseHeartbeat(this, buffer, length);
-        }
-        else if (msg_type == "9") // ORDER_CANCEL_REJECT
+
+        if (available >= 6 && field[5] == FIX_SOH)
         {
-            return OptimizedParser<FixMsgType::ORDER_CANCEL_REJECT>::parseOrderCancelReject(this, buffer, length);
+            return FixMsgTypeUtils::fromCode(FixMsgTypeUtils::msgTypeCode(field[3], field[4]));
         }
-        else if (msg_type == "3") // REJECT
+
+        return FixMsgType::UNKNOWN;
+    }
+
+    FixMsgType StreamParserUtils::peekMsgType(const char *buffer, size_t length)
+    {
+        if (!buffer)
         {
-            return OptimizedParser<FixMsgType::REJECT>::parseReject(this, buffer, length);
+            return FixMsgType::UNKNOWN;
         }
-        else if (msg_type == "1") // TEST_REQUEST
+
+        // Skip the BeginString and BodyLength fields
+        const char *end = buffer + length;
+        const char *soh = static_cast<const char *>(memchr(buffer, FIX_SOH, length));
+        if (soh)
         {
-            return OptimizedParser<FixMsgType::TEST_REQUEST>::parseTestRequest(this, buffer, length);
+            soh = static_cast<const char *>(memchr(soh + 1, FIX_SOH, static_cast<size_t>(end - (soh + 1))));
         }
-        else if (msg_type == "2") // RESEND_REQUEST
+        if (!soh)
         {
-            return OptimizedParser<FixMsgType::RESEND_REQUEST>::parseResendRequest(this, buffer, length);
+            return FixMsgType::UNKNOWN;
         }
 
-        // Fall back to legacy parseMessage for all other message types
-        // Note: Don't call parse() here to avoid infinite recursion
-        size_t message_start = 0;
-        size_t message_end = length;
-        return parseMessage(buffer, message_start, message_end);
+        return classifyMsgTypeField(soh + 1, static_cast<size_t>(end - (soh + 1)));
+    }
+
+    bool StreamParserUtils::validateChecksum(const char *buffer, size_t length)
+    {
+        return FixChecksum::validate(buffer, length);
+    }
+
+    bool StreamParserUtils::validateBodyLength(const char *buffer, size_t length)
+    {
+        return FixChecksum::validateBodyLength(buffer, length);
     }
 
+    // Intelligent parsing implementation - framework for future optimization
+    StreamFixParser::ParseResult StreamFixParser::parseIntelligent(const char *buffer, size_t length)
+    {
+        return dispatchMessage(StreamParserUtils::peekMsgType(buffer, length), buffer, length);
+    }
+
+    StreamFixParser::ParseResult StreamFixParser::decodeGeneric(StreamFixParser *parser, const char *buffer, size_t length)
+    {
+        return parser->parseMessage(buffer, 0, length);
+    }
+
+    // Template-optimized parsers for incoming message types; everything else
+    // (including UNKNOWN) takes the generic parseMessage path
+    const std::array<StreamFixParser::MessageDecoder, FixMsgTypeUtils::MSG_TYPE_COUNT> StreamFixParser::DECODERS = []
+    {
+        std::array<MessageDecoder, FixMsgTypeUtils::MSG_TYPE_COUNT> table{};
+        for (auto &decoder : table)
+            decoder = &StreamFixParser::decodeGeneric;
+
+        table[static_cast<size_t>(FixMsgType::EXECUTION_REPORT)] =
+            &OptimizedParser<FixMsgType::EXECUTION_REPORT>::parseExecutionReport;
+        table[static_cast<size_t>(FixMsgType::HEARTBEAT)] =
+            &OptimizedParser<FixMsgType::HEARTBEAT>::parseHeartbeat;
+        table[static_cast<size_t>(FixMsgType::ORDER_CANCEL_REJECT)] =
+            &OptimizedParser<FixMsgType::ORDER_CANCEL_REJECT>::parseOrderCancelReject;
+        table[static_cast<size_t>(FixMsgType::REJECT)] =
+            &OptimizedParser<FixMsgType::REJECT>::parseReject;
+        table[static_cast<size_t>(FixMsgType::TEST_REQUEST)] =
+            &OptimizedParser<FixMsgType::TEST_REQUEST>::parseTestRequest;
+        table[static_cast<size_t>(FixMsgType::RESEND_REQUEST)] =
+            &OptimizedParser<FixMsgType::RESEND_REQUEST>::parseResendRequest;
+        return table;
+    }();
+
 } // namespace fix_gateway::protocol
\ No newline at end of file
@@ -4,6 +4,24 @@
 
 namespace fix_gateway::utils
 {
+    namespace
+    {
+        // "00" "01" ... "99" - two output digits per lookup
+        constexpr char kDigitPairs[201] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+        
+        constexpr double kPow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+    }
+    
     // Thread-local buffer definitions
     thread_local char FastStringConversion::int_buffer_[INT_BUFFER_SIZE];
     thread_local char FastStringConversion::double_buffer_[DOUBLE_BUFFER_SIZE];
@@ -74,10 +92,16 @@ namespace fix_gateway::utils
             return value < 0 ? std::string_view("-inf", 4) : std::string_view("inf", 3);
         }
         
-        // Use snprintf for consistent, fast formatting
         // Precision is clamped to reasonable range for FIX protocol
         precision = std::max(0, std::min(precision, 9));
         
+        // Fixed-point path: round once at the target precision, then format
+        // the integer. Covers every realistic price and quantity.
+        double scaled = value * kPow10[precision];
+        if (std::fabs(scaled) < 9.0e18) {
+            return fixed_to_string(std::llround(scaled), precision);
+        }
+        
         int len = snprintf(double_buffer_, DOUBLE_BUFFER_SIZE, "%.*f", precision, value);
         
         // Handle error case
@@ -115,6 +139,64 @@ namespace fix_gateway::utils
         return double_to_string(value, precision);
     }
     
+    // Digits of INT64_MIN plus a point, or "-0." plus the largest scale
+    static_assert(FastStringConversion::FIXED_BUFFER_SIZE >= 1 + 19 + 1 &&
+                      FastStringConversion::FIXED_BUFFER_SIZE >= 3 + 18,
+                  "FIXED_BUFFER_SIZE must hold the longest fixed_to_chars output");
+
+    size_t FastStringConversion::fixed_to_chars(int64_t mantissa, int scale, char *out)
+    {
+        scale = std::max(0, std::min(scale, 18)); // Bounds the digit buffer
+        
+        char digits[FIXED_BUFFER_SIZE];
+        char *end = digits + sizeof(digits);
+        char *start = end;
+        
+        // Magnitude as unsigned so INT64_MIN is handled without overflow
+        uint64_t magnitude = mantissa < 0 ? 0 - static_cast<uint64_t>(mantissa) : static_cast<uint64_t>(mantissa);
+        while (magnitude >= 100) {
+            const char *pair = kDigitPairs + (magnitude % 100) * 2;
+            magnitude /= 100;
+            *--start = pair[1];
+            *--start = pair[0];
+        }
+        if (magnitude >= 10) {
+            const char *pair = kDigitPairs + magnitude * 2;
+            *--start = pair[1];
+            *--start = pair[0];
+        } else {
+            *--start = static_cast<char>('0' + magnitude);
+        }
+        
+        // Left-pad with zeros so there is at least one integer digit
+        size_t digit_count = static_cast<size_t>(end - start);
+        while (scale > 0 && digit_count <= static_cast<size_t>(scale)) {
+            *--start = '0';
+            ++digit_count;
+        }
+        
+        char *p = out;
+        if (mantissa < 0) {
+            *p++ = '-';
+        }
+        size_t int_digits = digit_count - static_cast<size_t>(scale);
+        std::memcpy(p, start, int_digits);
+        p += int_digits;
+        if (scale > 0) {
+            *p++ = '.';
+            std::memcpy(p, start + int_digits, static_cast<size_t>(scale));
+            p += scale;
+        }
+        return static_cast<size_t>(p - out);
+    }
+    
+    std::string_view FastStringConversion::fixed_to_string(int64_t mantissa, int scale)
+    {
+        static_assert(DOUBLE_BUFFER_SIZE >= FIXED_BUFFER_SIZE, "fixed_to_string formats into double_buffer_");
+        size_t len = fixed_to_chars(mantissa, scale, double_buffer_);
+        return std::string_view(double_buffer_, len);
+    }
+    
     std::string FastStringConversion::make_permanent(std::string_view view)
     {
         return std::string(view);
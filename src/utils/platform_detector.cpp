@@ -161,6 +161,25 @@ namespace fix_gateway::utils
 #endif
     }
 
+    bool PlatformDetector::supportsSSE2()
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        return true; // Baseline for every x86-64 CPU
+#else
+        return false;
+#endif
+    }
+
+    bool PlatformDetector::supportsAVX2()
+    {
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+        __builtin_cpu_init(); // Safe to call before static constructors have run
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+
     bool PlatformDetector::isContainerEnvironment()
     {
         // Multiple ways to detect container environment
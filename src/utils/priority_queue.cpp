@@ -7,13 +7,33 @@
 
 namespace fix_gateway::utils
 {
+    namespace
+    {
+        size_t roundUpToPowerOfTwo(size_t n)
+        {
+            size_t power = 1;
+            while (power < n)
+            {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        uint32_t levelBit(size_t level)
+        {
+            return uint32_t{1} << level;
+        }
+    }
+
     // Constructor
     PriorityQueue::PriorityQueue(
         size_t max_size,
         OverflowPolicy overflow_policy,
-        const std::string &queue_name)
+        const std::string &queue_name,
+        size_t max_capacity)
         : max_size_(max_size),
           overflow_policy_(overflow_policy),
+          ring_capacity_(roundUpToPowerOfTwo(std::max<size_t>({max_size, max_capacity, 2}))),
           queue_name_(queue_name),
           is_shutdown_(false),
           total_pushed_(0),
@@ -23,6 +43,16 @@ namespace fix_gateway::utils
           total_latency_ns_(0),
           latency_samples_(0)
     {
+        // Producers evict from the ring heads under DROP_OLDEST
+        QueueMode mode = overflow_policy == OverflowPolicy::DROP_OLDEST ? QueueMode::MPMC : QueueMode::MPSC;
+        for (size_t level = 0; level < LEVEL_COUNT; ++level)
+        {
+            levels_[level] = std::make_unique<LevelRing>(ring_capacity_, queue_name_ + "_level" + std::to_string(level), mode);
+            // Waiting happens on not_empty_ across all levels, so the rings never park
+            levels_[level]->setWaitStrategy(WaitConfig::spinYield());
+        }
+        configureBlockingWait();
+
         LOG_INFO("PriorityQueue '" + queue_name_ + "' created with max_size=" +
                  std::to_string(max_size_) + ", policy=" + getOverflowPolicyString());
     }
@@ -62,69 +92,35 @@ namespace fix_gateway::utils
         // Set queue entry timestamp
         message->setQueueEntryTime(start_time);
 
-        std::unique_lock<std::mutex> lock(mutex_);
+        auto deadline = timeout == std::chrono::milliseconds::max()
+                            ? std::chrono::steady_clock::time_point::max()
+                            : start_time + timeout;
 
-        // Handle different overflow policies
-        if (queue_.size() >= max_size_)
+        size_t level = levelOf(message);
+        if (!reserveSlot(level, deadline))
         {
-            switch (overflow_policy_)
-            {
-            case OverflowPolicy::DROP_OLDEST:
-                if (!handleOverflow(message))
-                {
-                    fix_gateway::common::Message::destroy(message);
-                    return false;
-                }
-                break;
-
-            case OverflowPolicy::DROP_NEWEST:
-                total_dropped_.fetch_add(1, std::memory_order_relaxed);
-                LOG_DEBUG("Message dropped due to queue overflow (DROP_NEWEST policy)");
-                fix_gateway::common::Message::destroy(message);
-                return false;
-
-            case OverflowPolicy::BLOCK:
-            {
-                bool success = not_full_cv_.wait_for(lock, timeout,
-                                                     [this]
-                                                     { return queue_.size() < max_size_ || is_shutdown_.load(std::memory_order_relaxed); });
-                if (!success || is_shutdown_.load(std::memory_order_relaxed))
-                {
-                    LOG_DEBUG("Push timed out or queue shutdown");
-                    fix_gateway::common::Message::destroy(message);
-                    return false;
-                }
-            }
-            break;
-
-            case OverflowPolicy::REJECT:
-                total_dropped_.fetch_add(1, std::memory_order_relaxed);
-                LOG_DEBUG("Message rejected due to queue overflow (REJECT policy)");
-                fix_gateway::common::Message::destroy(message);
-                return false;
-            }
+            fix_gateway::common::Message::destroy(message);
+            return false;
         }
 
-        // Perform the actual push
-        queue_.push(message);
-        total_pushed_.fetch_add(1, std::memory_order_relaxed);
-
-        // Update peak size
-        size_t current_size = queue_.size();
-        size_t current_peak = peak_size_.load(std::memory_order_relaxed);
-        while (current_size > current_peak &&
-               !peak_size_.compare_exchange_weak(current_peak, current_size, std::memory_order_relaxed))
+        // Every ring holds the whole queue, so a reserved slot always fits
+        if (!levels_[level]->push(message))
         {
-            // Loop until we successfully update peak_size or current_size <= current_peak
+            releaseSlots(1);
+            total_dropped_.fetch_add(1, std::memory_order_relaxed);
+            fix_gateway::common::Message::destroy(message);
+            return false;
         }
 
+        markOccupied(level);
+        total_pushed_.fetch_add(1, std::memory_order_relaxed);
+        updatePeak(size_.load(std::memory_order_relaxed));
+
         // Record latency
         recordLatency(start_time);
 
-        // Notify waiting consumers
-        not_empty_cv_.notify_one();
-
-        LOG_DEBUG("Message pushed to queue '" + queue_name_ + "', size=" + std::to_string(current_size));
+        // Wake a parked consumer
+        not_empty_.notify();
         return true;
     }
 
@@ -137,89 +133,58 @@ namespace fix_gateway::utils
     // Blocking pop with timeout
     bool PriorityQueue::pop(MessagePtr &message, std::chrono::milliseconds timeout)
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        // Wait for message or shutdown
-        bool success = not_empty_cv_.wait_for(lock, timeout,
-                                              [this]
-                                              { return !queue_.empty() || is_shutdown_.load(std::memory_order_relaxed); });
+        auto deadline = timeout == std::chrono::milliseconds::max()
+                            ? std::chrono::steady_clock::time_point::max()
+                            : std::chrono::steady_clock::now() + timeout;
 
-        if (!success || (queue_.empty() && is_shutdown_.load(std::memory_order_relaxed)))
+        while (true)
         {
-            message = nullptr;
-            return false;
-        }
+            if (popLevels(message))
+            {
+                return true;
+            }
+            if (is_shutdown_.load(std::memory_order_relaxed) || std::chrono::steady_clock::now() >= deadline)
+            {
+                message = nullptr;
+                return false;
+            }
 
-        if (queue_.empty())
-        {
-            message = nullptr;
-            return false;
+            // Stale bits end the wait early; popLevels() clears them on the next pass
+            not_empty_.waitFor([this]()
+                               { return occupancy_.load(std::memory_order_acquire) != 0 ||
+                                        is_shutdown_.load(std::memory_order_relaxed); });
         }
-
-        // Get the highest priority message
-        message = queue_.top();
-        queue_.pop();
-        total_popped_.fetch_add(1, std::memory_order_relaxed);
-
-        // Notify waiting producers
-        not_full_cv_.notify_one();
-
-        LOG_DEBUG("Message popped from queue '" + queue_name_ + "', size=" + std::to_string(queue_.size()));
-        return true;
     }
 
     // Non-blocking pop
     bool PriorityQueue::tryPop(MessagePtr &message)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        if (queue_.empty())
-        {
-            message = nullptr;
-            return false;
-        }
-
-        message = queue_.top();
-        queue_.pop();
-        total_popped_.fetch_add(1, std::memory_order_relaxed);
-
-        // Notify waiting producers
-        not_full_cv_.notify_one();
-
-        return true;
+        return popLevels(message);
     }
 
     // Queue management
     void PriorityQueue::clear()
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        size_t cleared_count = queue_.size();
+        size_t cleared_count = 0;
+        MessagePtr msg = nullptr;
 
         // Clear the queue
-        while (!queue_.empty())
+        while (popLevels(msg))
         {
-            auto msg = queue_.top();
-            queue_.pop();
             fix_gateway::common::Message::destroy(msg);
+            cleared_count++;
         }
 
-        // Notify all waiting threads
-        not_full_cv_.notify_all();
-
         LOG_INFO("Queue '" + queue_name_ + "' cleared, removed " + std::to_string(cleared_count) + " messages");
     }
 
     void PriorityQueue::shutdown()
     {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            is_shutdown_.store(true, std::memory_order_relaxed);
-        }
+        is_shutdown_.store(true, std::memory_order_relaxed);
 
         // Wake up all waiting threads
-        not_empty_cv_.notify_all();
-        not_full_cv_.notify_all();
+        not_empty_.wakeAll();
+        not_full_.wakeAll();
 
         LOG_INFO("Queue '" + queue_name_ + "' shutdown initiated");
     }
@@ -232,28 +197,30 @@ namespace fix_gateway::utils
     // Monitoring and statistics
     size_t PriorityQueue::size() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return queue_.size();
+        return size_.load(std::memory_order_relaxed);
     }
 
     bool PriorityQueue::empty() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return queue_.empty();
+        return size() == 0;
     }
 
     size_t PriorityQueue::capacity() const
     {
-        return max_size_;
+        return max_size_.load(std::memory_order_relaxed);
     }
 
-    QueueStats PriorityQueue::getStats() const
+    size_t PriorityQueue::levelSize(Priority priority) const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        size_t level = std::min(static_cast<size_t>(priority), LEVEL_COUNT - 1);
+        return levels_[level]->size();
+    }
 
+    QueueStats PriorityQueue::getStats() const
+    {
         QueueStats stats;
-        stats.current_size = queue_.size();
-        stats.max_size = max_size_;
+        stats.current_size = size();
+        stats.max_size = capacity();
         stats.total_pushed = total_pushed_.load(std::memory_order_relaxed);
         stats.total_popped = total_popped_.load(std::memory_order_relaxed);
         stats.total_dropped = total_dropped_.load(std::memory_order_relaxed);
@@ -298,34 +265,48 @@ namespace fix_gateway::utils
     // Configuration
     void PriorityQueue::setOverflowPolicy(OverflowPolicy policy)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        overflow_policy_ = policy;
+        if (policy == OverflowPolicy::DROP_OLDEST && levels_[0]->mode() != QueueMode::MPMC)
+        {
+            LOG_WARN("Queue '" + queue_name_ + "' keeps " + getOverflowPolicyString() +
+                     ": DROP_OLDEST needs a queue constructed with it");
+            return;
+        }
+        overflow_policy_.store(policy, std::memory_order_relaxed);
+        configureBlockingWait();
         LOG_INFO("Queue '" + queue_name_ + "' overflow policy changed to " + overflowPolicyToString(policy));
     }
 
     OverflowPolicy PriorityQueue::getOverflowPolicy() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return overflow_policy_;
+        return overflow_policy_.load(std::memory_order_relaxed);
     }
 
-    void PriorityQueue::setMaxSize(size_t max_size)
+    bool PriorityQueue::setMaxSize(size_t max_size)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        max_size_ = max_size;
+        bool fits = max_size <= ring_capacity_;
+        if (!fits)
+        {
+            // The rings cannot grow under live producers - size them with max_capacity
+            LOG_ERROR("Queue '" + queue_name_ + "' max size " + std::to_string(max_size) +
+                      " exceeds the ring capacity " + std::to_string(ring_capacity_) + " - clamped");
+            max_size = ring_capacity_;
+        }
+        max_size_.store(max_size, std::memory_order_relaxed);
         LOG_INFO("Queue '" + queue_name_ + "' max size changed to " + std::to_string(max_size));
 
         // If we're now over capacity, handle overflow
-        while (queue_.size() > max_size_ && overflow_policy_ == OverflowPolicy::DROP_OLDEST)
+        while (size_.load(std::memory_order_relaxed) > max_size &&
+               getOverflowPolicy() == OverflowPolicy::DROP_OLDEST &&
+               evictLessUrgent(0))
         {
-            auto msg = queue_.top();
-            queue_.pop();
-            fix_gateway::common::Message::destroy(msg);
-            total_dropped_.fetch_add(1, std::memory_order_relaxed);
+            releaseSlots(1);
         }
+        return fits;
+    }
 
-        // Notify waiting producers
-        not_full_cv_.notify_all();
+    void PriorityQueue::setWaitStrategy(const WaitConfig &config)
+    {
+        not_empty_.configure(config);
     }
 
     // Utility methods
@@ -352,47 +333,152 @@ namespace fix_gateway::utils
 
     std::string PriorityQueue::getOverflowPolicyString() const
     {
-        return overflowPolicyToString(overflow_policy_);
+        return overflowPolicyToString(getOverflowPolicy());
     }
 
     // Helper methods
-    bool PriorityQueue::pushInternal(MessagePtr message)
+    size_t PriorityQueue::levelOf(MessagePtr message)
     {
-        // This method assumes the mutex is already locked
-        queue_.push(message);
-        total_pushed_.fetch_add(1, std::memory_order_relaxed);
+        // Priority values are the level indices: CRITICAL = 0 is the most urgent
+        return std::min(static_cast<size_t>(message->getPriority()), LEVEL_COUNT - 1);
+    }
 
-        // Update peak size
-        size_t current_size = queue_.size();
-        size_t current_peak = peak_size_.load(std::memory_order_relaxed);
-        while (current_size > current_peak &&
-               !peak_size_.compare_exchange_weak(current_peak, current_size, std::memory_order_relaxed))
+    bool PriorityQueue::reserveSlot(size_t level, std::chrono::steady_clock::time_point deadline)
+    {
+        size_t current = size_.load(std::memory_order_relaxed);
+        while (true)
         {
-            // Loop until we successfully update peak_size or current_size <= current_peak
+            if (current < max_size_.load(std::memory_order_relaxed))
+            {
+                if (size_.compare_exchange_weak(current, current + 1, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            switch (getOverflowPolicy())
+            {
+            case OverflowPolicy::DROP_OLDEST:
+                if (evictLessUrgent(level))
+                {
+                    return true; // The evicted message's slot is ours
+                }
+                if (size_.load(std::memory_order_relaxed) >= max_size_.load(std::memory_order_relaxed))
+                {
+                    // Only more urgent messages are queued: the incoming one goes
+                    total_dropped_.fetch_add(1, std::memory_order_relaxed);
+                    LOG_DEBUG("Message dropped due to queue overflow (DROP_OLDEST policy)");
+                    return false;
+                }
+                break;
+
+            case OverflowPolicy::DROP_NEWEST:
+                total_dropped_.fetch_add(1, std::memory_order_relaxed);
+                LOG_DEBUG("Message dropped due to queue overflow (DROP_NEWEST policy)");
+                return false;
+
+            case OverflowPolicy::BLOCK:
+                if (is_shutdown_.load(std::memory_order_relaxed) || std::chrono::steady_clock::now() >= deadline)
+                {
+                    LOG_DEBUG("Push timed out or queue shutdown");
+                    return false;
+                }
+                not_full_.waitFor([this]()
+                                  { return size_.load(std::memory_order_relaxed) < max_size_.load(std::memory_order_relaxed) ||
+                                           is_shutdown_.load(std::memory_order_relaxed); });
+                break;
+
+            case OverflowPolicy::REJECT:
+                total_dropped_.fetch_add(1, std::memory_order_relaxed);
+                LOG_DEBUG("Message rejected due to queue overflow (REJECT policy)");
+                return false;
+            }
+            current = size_.load(std::memory_order_relaxed);
         }
+    }
 
-        return true;
+    bool PriorityQueue::evictLessUrgent(size_t level)
+    {
+        // Least urgent level first, down to (and including) the incoming message's level
+        for (size_t victim_level = LEVEL_COUNT; victim_level-- > level;)
+        {
+            MessagePtr victim = nullptr;
+            if (levels_[victim_level]->tryPop(victim))
+            {
+                fix_gateway::common::Message::destroy(victim);
+                total_dropped_.fetch_add(1, std::memory_order_relaxed);
+                LOG_DEBUG("Dropped oldest message due to queue overflow");
+                return true;
+            }
+        }
+        return false;
     }
 
-    bool PriorityQueue::handleOverflow(MessagePtr message)
+    bool PriorityQueue::popLevels(MessagePtr &message)
     {
-        // This method assumes the mutex is already locked
-        if (overflow_policy_ == OverflowPolicy::DROP_OLDEST && !queue_.empty())
+        uint32_t occupied = occupancy_.load(std::memory_order_acquire);
+        while (occupied != 0)
         {
-            auto dropped = queue_.top();
-            queue_.pop(); // Remove oldest (lowest priority) message
-            fix_gateway::common::Message::destroy(dropped);
-            total_dropped_.fetch_add(1, std::memory_order_relaxed);
-            LOG_DEBUG("Dropped oldest message due to queue overflow");
-            return true;
+            size_t level = static_cast<size_t>(__builtin_ctz(occupied));
+            if (levels_[level]->tryPop(message))
+            {
+                releaseSlots(1);
+                total_popped_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // Level drained: clear its bit, then look again so a push that
+            // still saw the bit set is not stranded behind a clear one
+            uint32_t bit = levelBit(level);
+            occupancy_.fetch_and(~bit, std::memory_order_acq_rel);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!levels_[level]->empty())
+            {
+                occupancy_.fetch_or(bit, std::memory_order_release);
+            }
+
+            // Less urgent levels next; a skipped level is picked up on the next call
+            occupied = occupancy_.load(std::memory_order_acquire) & ~((bit << 1) - 1);
         }
+
+        message = nullptr;
         return false;
     }
 
-    void PriorityQueue::updateStats(MessagePtr message)
+    void PriorityQueue::markOccupied(size_t level)
+    {
+        // Pairs with the clear-then-recheck in popLevels(): either the consumer
+        // sees our message or we see its cleared bit
+        uint32_t bit = levelBit(level);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ((occupancy_.load(std::memory_order_relaxed) & bit) == 0)
+        {
+            occupancy_.fetch_or(bit, std::memory_order_release);
+        }
+    }
+
+    void PriorityQueue::releaseSlots(size_t count)
+    {
+        size_.fetch_sub(count, std::memory_order_release);
+        not_full_.notify();
+    }
+
+    void PriorityQueue::configureBlockingWait()
     {
-        // Update message statistics - could be extended for more detailed tracking
-        // For now, basic stats are handled in push/pop operations
+        // Only BLOCK producers park on not_full_; otherwise its notify() is free
+        not_full_.configure(getOverflowPolicy() == OverflowPolicy::BLOCK ? WaitConfig::spinPark()
+                                                                          : WaitConfig::spinYield());
+    }
+
+    void PriorityQueue::updatePeak(size_t current_size)
+    {
+        size_t current_peak = peak_size_.load(std::memory_order_relaxed);
+        while (current_size > current_peak &&
+               !peak_size_.compare_exchange_weak(current_peak, current_size, std::memory_order_relaxed))
+        {
+            // Loop until we successfully update peak_size or current_size <= current_peak
+        }
     }
 
     void PriorityQueue::recordLatency(const std::chrono::steady_clock::time_point &start_time)
@@ -0,0 +1,68 @@
+#include "utils/wait_strategy.h"
+
+#include <climits>
+#include <ctime>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace fix_gateway::utils
+{
+    namespace
+    {
+#ifdef __linux__
+        // std::atomic<uint32_t> is a lock-free 32-bit word, as the futex calls expect
+        uint32_t *futexWord(std::atomic<uint32_t> &word)
+        {
+            static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32 bits");
+            return reinterpret_cast<uint32_t *>(&word);
+        }
+#endif
+    }
+
+    const char *waitPolicyToString(WaitPolicy policy)
+    {
+        switch (policy)
+        {
+        case WaitPolicy::BusySpin:
+            return "busy_spin";
+        case WaitPolicy::SpinYield:
+            return "spin_yield";
+        case WaitPolicy::SpinPark:
+            return "spin_park";
+        }
+        return "unknown";
+    }
+
+    void WaitStrategy::park(uint32_t key)
+    {
+#ifdef __linux__
+        auto timeout_us = config_.park_timeout.count();
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(timeout_us / 1000000);
+        timeout.tv_nsec = static_cast<long>((timeout_us % 1000000) * 1000);
+
+        // Returns at once if epoch_ moved on since key was read (EAGAIN); a
+        // spurious wake or the timeout just ends this wait round
+        ::syscall(SYS_futex, futexWord(epoch_), FUTEX_WAIT_PRIVATE, key, &timeout, nullptr, 0);
+#else
+        if (epoch_.load(std::memory_order_acquire) == key)
+        {
+            std::this_thread::sleep_for(config_.park_timeout);
+        }
+#endif
+    }
+
+    void WaitStrategy::wakeAll()
+    {
+        epoch_.fetch_add(1, std::memory_order_release);
+        wake_count_.fetch_add(1, std::memory_order_relaxed);
+#ifdef __linux__
+        ::syscall(SYS_futex, futexWord(epoch_), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+} // namespace fix_gateway::utils
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "network/egress_scheduler.h"
+#include "network/tcp_connection.h"
+#include "common/message.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::network;
+using fix_gateway::common::Message;
+
+class EgressSchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (size_t lane = 0; lane < EgressScheduler::LANE_COUNT; ++lane)
+        {
+            lanes_[lane] = std::make_shared<EgressScheduler::LaneQueue>(64, "lane" + std::to_string(lane));
+        }
+        tcp_ = std::make_shared<TcpConnection>();
+    }
+
+    void push(Priority priority, const std::string &payload)
+    {
+        ASSERT_TRUE(lanes_[static_cast<size_t>(priority)]->push(Message::create(payload, payload, priority)));
+    }
+
+    static std::vector<std::string> payloads(MessagePtr *batch, size_t count)
+    {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result.push_back(batch[i]->getPayload());
+            Message::destroy(batch[i]);
+        }
+        return result;
+    }
+
+    EgressScheduler::LaneArray lanes_;
+    std::shared_ptr<TcpConnection> tcp_;
+};
+
+TEST_F(EgressSchedulerTest, BatchesAreStrictPriorityWithReservedShares)
+{
+    EgressConfig config;
+    config.min_share = {0, 0, 1, 2};
+    EgressScheduler scheduler(lanes_, tcp_, config);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        push(Priority::CRITICAL, "C" + std::to_string(i));
+    }
+    push(Priority::LOW, "L0");
+    push(Priority::LOW, "L1");
+    push(Priority::LOW, "L2");
+    push(Priority::HIGH, "H0");
+
+    // Six slots: LOW keeps its two, MEDIUM is empty so its slot goes to CRITICAL
+    MessagePtr batch[8];
+    size_t count = scheduler.selectBatch(batch, 6);
+    std::vector<std::string> expected = {"C0", "C1", "C2", "C3", "L0", "L1"};
+    EXPECT_EQ(expected, payloads(batch, count));
+
+    // Urgent lanes first again, then what is left of LOW
+    count = scheduler.selectBatch(batch, 6);
+    expected = {"C4", "C5", "H0", "L2"};
+    EXPECT_EQ(expected, payloads(batch, count));
+    EXPECT_EQ(0U, scheduler.getQueueDepth());
+}
+
+TEST_F(EgressSchedulerTest, SchedulerCoalescesLanesIntoOneWrite)
+{
+    int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listen_fd, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(0, ::bind(listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+    ASSERT_EQ(0, ::listen(listen_fd, 1));
+    socklen_t length = sizeof(addr);
+    ASSERT_EQ(0, ::getsockname(listen_fd, reinterpret_cast<sockaddr *>(&addr), &length));
+
+    ASSERT_TRUE(tcp_->connect("127.0.0.1", ntohs(addr.sin_port)));
+    int peer_fd = ::accept(listen_fd, nullptr, nullptr);
+    ASSERT_GE(peer_fd, 0);
+
+    push(Priority::LOW, "low|");
+    push(Priority::MEDIUM, "medium|");
+    push(Priority::CRITICAL, "critical|");
+    push(Priority::HIGH, "high|");
+
+    {
+        EgressScheduler scheduler(lanes_, tcp_);
+        scheduler.start();
+
+        std::string expected = "critical|high|medium|low|";
+        std::string received;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received.size() < expected.size() && std::chrono::steady_clock::now() < deadline)
+        {
+            struct pollfd pfd = {peer_fd, POLLIN, 0};
+            if (::poll(&pfd, 1, 100) > 0)
+            {
+                char buffer[256];
+                ssize_t n = ::recv(peer_fd, buffer, sizeof(buffer), 0);
+                ASSERT_GT(n, 0);
+                received.append(buffer, static_cast<size_t>(n));
+            }
+        }
+        EXPECT_EQ(expected, received);
+
+        scheduler.stop();
+        EgressStats stats = scheduler.getStats();
+        EXPECT_EQ(4U, stats.messages_sent);
+        EXPECT_EQ(1U, stats.batches_written);
+        EXPECT_EQ(expected.size(), stats.bytes_sent);
+        EXPECT_EQ(1U, stats.lane_sent[static_cast<size_t>(Priority::LOW)]);
+    }
+
+    tcp_->disconnect();
+    ::close(peer_fd);
+    ::close(listen_fd);
+}
+
+TEST_F(EgressSchedulerTest, FailedBatchIsRetriedThenReported)
+{
+    push(Priority::HIGH, "high|");
+    push(Priority::LOW, "low|");
+
+    EgressConfig config;
+    config.max_retries = 2;
+    config.retry_delay = std::chrono::milliseconds(1);
+    EgressScheduler scheduler(lanes_, tcp_, config); // tcp_ never connects
+
+    std::atomic<size_t> reported{0};
+    std::vector<std::string> failed;
+    scheduler.setErrorCallback([&](MessagePtr message, const std::string &)
+                               {
+                                   failed.push_back(message->getPayload());
+                                   reported++;
+                               });
+    scheduler.start();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (reported.load() < 2 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    scheduler.stop();
+
+    std::vector<std::string> expected = {"high|", "low|"};
+    EXPECT_EQ(expected, failed);
+    EgressStats stats = scheduler.getStats();
+    EXPECT_EQ(0U, stats.messages_sent);
+    EXPECT_EQ(2U, stats.messages_failed);
+    EXPECT_EQ(2U, stats.batch_retries);
+}
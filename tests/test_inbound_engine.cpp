@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+
+#include "application/inbound_engine.h"
+#include "protocol/fix_message.h"
+#include "protocol/fix_checksum.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::application;
+using namespace fix_gateway::protocol;
+
+class InboundEngineTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Loopback listener standing in for the brokers/venues
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_GE(listen_fd_, 0);
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        ASSERT_EQ(0, ::bind(listen_fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+        ASSERT_EQ(0, ::listen(listen_fd_, 16));
+
+        socklen_t length = sizeof(addr);
+        ASSERT_EQ(0, ::getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &length));
+        port_ = ntohs(addr.sin_port);
+    }
+
+    void TearDown() override
+    {
+        for (int fd : peer_fds_)
+        {
+            ::close(fd);
+        }
+        ::close(listen_fd_);
+    }
+
+    static InboundEngine::Config testConfig(size_t workers)
+    {
+        InboundEngine::Config config;
+        config.worker_count = workers;
+        config.enable_core_pinning = false;
+        config.worker_pool_size = 1024;
+        config.session_ring_capacity = 64 * 1024;
+        config.idle_spins = 16;
+        return config;
+    }
+
+    // Connect one engine session and return the venue side of it
+    int addSession(InboundEngine &engine, InboundEngine::SessionId &id)
+    {
+        id = engine.addSession("127.0.0.1", port_);
+        int fd = ::accept(listen_fd_, nullptr, nullptr);
+        peer_fds_.push_back(fd);
+        return fd;
+    }
+
+    static std::string executionReport(int seq)
+    {
+        std::string body = "35=8\x01" "49=VENUE\x01" "56=GATEWAY\x01" "34=" + std::to_string(seq) + "\x01" +
+                           "52=20231201-10:30:00\x01" "37=O" + std::to_string(seq) + "\x01" +
+                           "17=E" + std::to_string(seq) + "\x01" "150=F\x01" "39=2\x01" "55=AAPL\x01";
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+        char digits[3];
+        FixChecksum::format(FixChecksum::compute(msg.data(), msg.size()), digits);
+        return msg + "10=" + std::string(digits, 3) + "\x01";
+    }
+
+    // Write in odd-sized pieces so frames straddle reads
+    static void sendFragmented(int fd, const std::string &stream, size_t chunk)
+    {
+        for (size_t offset = 0; offset < stream.size(); offset += chunk)
+        {
+            size_t length = std::min(chunk, stream.size() - offset);
+            ASSERT_EQ(static_cast<ssize_t>(length), ::send(fd, stream.data() + offset, length, MSG_NOSIGNAL));
+        }
+    }
+
+    static size_t drain(InboundEngine &engine, Priority priority, size_t expected,
+                        std::vector<FixMessage *> &out)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        FixMessage *batch[32];
+        while (out.size() < expected && std::chrono::steady_clock::now() < deadline)
+        {
+            size_t count = engine.pollMessages(priority, batch, 32);
+            out.insert(out.end(), batch, batch + count);
+            if (count == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+        return out.size();
+    }
+
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::vector<int> peer_fds_;
+};
+
+TEST_F(InboundEngineTest, SessionsShardedAcrossWorkers)
+{
+    InboundEngine engine(testConfig(2));
+    constexpr int SESSIONS = 4;
+    constexpr int MESSAGES = 50;
+
+    std::vector<InboundEngine::SessionId> ids(SESSIONS);
+    std::vector<int> venues;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        venues.push_back(addSession(engine, ids[i]));
+        ASSERT_NE(0U, ids[i]);
+    }
+    engine.start();
+
+    // Least-loaded assignment splits the sessions evenly
+    EXPECT_EQ(2U, engine.getWorkerStats(0).sessions);
+    EXPECT_EQ(2U, engine.getWorkerStats(1).sessions);
+
+    std::vector<std::thread> senders;
+    for (int i = 0; i < SESSIONS; ++i)
+    {
+        senders.emplace_back([&, i]()
+                             {
+            std::string stream;
+            for (int seq = 1; seq <= MESSAGES; ++seq)
+            {
+                stream += executionReport(seq);
+            }
+            sendFragmented(venues[i], stream, 61 + 13 * i); });
+    }
+    for (auto &sender : senders)
+    {
+        sender.join();
+    }
+
+    std::vector<FixMessage *> received;
+    ASSERT_EQ(static_cast<size_t>(SESSIONS * MESSAGES), drain(engine, Priority::CRITICAL, SESSIONS * MESSAGES, received));
+
+    // Every message carries its session, and each session arrives in order
+    std::map<InboundEngine::SessionId, int> last_seq;
+    for (FixMessage *message : received)
+    {
+        InboundEngine::SessionId session = message->getSessionId();
+        int seq = message->getMsgSeqNum();
+        EXPECT_EQ(last_seq[session] + 1, seq) << "session " << session;
+        last_seq[session] = seq;
+        EXPECT_TRUE(engine.releaseMessage(message));
+    }
+    for (InboundEngine::SessionId id : ids)
+    {
+        EXPECT_EQ(MESSAGES, last_seq[id]);
+    }
+
+    for (const auto &stats : engine.getSessionStats())
+    {
+        EXPECT_EQ(static_cast<uint64_t>(MESSAGES), stats.messages_parsed);
+        EXPECT_TRUE(stats.active);
+    }
+    for (size_t w = 0; w < engine.workerCount(); ++w)
+    {
+        auto stats = engine.getWorkerStats(w);
+        EXPECT_EQ(0U, stats.pool.allocated_count); // Released to the owning worker pool
+        EXPECT_EQ(static_cast<uint64_t>(2 * MESSAGES), stats.messages_published);
+    }
+
+    engine.stop();
+}
+
+TEST_F(InboundEngineTest, SessionLossIsReportedPerSession)
+{
+    InboundEngine engine(testConfig(1));
+    std::atomic<InboundEngine::SessionId> lost{0};
+    engine.setErrorCallback([&](InboundEngine::SessionId id, const std::string &)
+                            { lost.store(id); });
+
+    InboundEngine::SessionId first = 0, second = 0;
+    addSession(engine, first);
+    int venue = addSession(engine, second);
+    engine.start();
+
+    // The second venue drops; the first session keeps running
+    ::shutdown(venue, SHUT_RDWR);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (lost.load() == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(second, lost.load());
+
+    // The closed session (connection, ring, parser) is released by its worker
+    while (engine.getSessionStats().size() > 1 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto sessions = engine.getSessionStats();
+    ASSERT_EQ(1U, sessions.size());
+    EXPECT_EQ(first, sessions[0].session_id);
+    EXPECT_TRUE(sessions[0].active);
+    EXPECT_EQ(1U, engine.getWorkerStats(0).sessions);
+
+    std::vector<FixMessage *> received;
+    sendFragmented(peer_fds_[0], executionReport(1), 7);
+    ASSERT_EQ(1U, drain(engine, Priority::CRITICAL, 1, received));
+    EXPECT_EQ(first, received[0]->getSessionId());
+    engine.releaseMessage(received[0]);
+
+    engine.stop();
+}
+
+TEST_F(InboundEngineTest, ExhaustedPoolPausesReadsWithoutLosingFrames)
+{
+    // A tiny pool and ring: the sender outruns both while nothing is released
+    InboundEngine::Config config = testConfig(1);
+    config.worker_pool_size = 16;
+    config.session_ring_capacity = 16 * 1024;
+    InboundEngine engine(config);
+
+    InboundEngine::SessionId id = 0;
+    int venue = addSession(engine, id);
+    engine.start();
+
+    constexpr int MESSAGES = 2000;
+    std::thread sender([&]()
+                       {
+        std::string stream;
+        for (int seq = 1; seq <= MESSAGES; ++seq)
+        {
+            stream += executionReport(seq);
+        }
+        sendFragmented(venue, stream, 4096); });
+
+    // Let the pool run dry and the ring fill before consuming anything
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    int expected_seq = 1;
+    FixMessage *batch[32];
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (expected_seq <= MESSAGES && std::chrono::steady_clock::now() < deadline)
+    {
+        size_t count = engine.pollMessages(Priority::CRITICAL, batch, 32);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(expected_seq++, batch[i]->getMsgSeqNum());
+            engine.releaseMessage(batch[i]);
+        }
+        if (count == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    sender.join();
+    EXPECT_EQ(MESSAGES + 1, expected_seq);
+
+    auto stats = engine.getSessionStats();
+    ASSERT_EQ(1U, stats.size());
+    EXPECT_EQ(0U, stats[0].messages_dropped);
+    EXPECT_EQ(0U, stats[0].parse_errors);
+    EXPECT_EQ(0U, engine.getWorkerStats(0).queue_full_drops);
+
+    engine.stop();
+}
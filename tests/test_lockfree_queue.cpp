@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+
+#include "utils/lockfree_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::utils;
+
+class LockFreeQueueTest : public ::testing::Test
+{
+protected:
+    using Queue = LockFreeQueue<uint64_t>;
+};
+
+TEST_F(LockFreeQueueTest, BulkOperationsWrapAroundTheRing)
+{
+    Queue queue(8, "wrap_queue");
+    uint64_t out[8] = {};
+
+    // Move the indices near the end of the ring first
+    uint64_t lead[5] = {1, 2, 3, 4, 5};
+    ASSERT_EQ(5U, queue.pushBulk(lead, 5));
+    ASSERT_EQ(5U, queue.popBulk(out, 8));
+
+    uint64_t burst[6] = {10, 11, 12, 13, 14, 15};
+    EXPECT_EQ(6U, queue.pushBulk(burst, 6)); // Slots 5..7, then 0..2
+    EXPECT_EQ(6U, queue.size());
+
+    EXPECT_EQ(4U, queue.popBulk(out, 4));
+    uint64_t value = 0;
+    ASSERT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(14U, value);
+    EXPECT_EQ(1U, queue.popBulk(out + 4, 8));
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(10 + i, out[i]);
+    }
+    EXPECT_EQ(15U, out[4]);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(0U, queue.popBulk(out, 8));
+}
+
+TEST_F(LockFreeQueueTest, ShortBulkPushCountsTheRestAsDropped)
+{
+    Queue queue(8, "full_queue");
+    uint64_t burst[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(7U, queue.pushBulk(burst, 10)); // One slot always stays free
+    EXPECT_FALSE(queue.push(99));
+    EXPECT_EQ(7U, queue.getTotalPushed());
+    EXPECT_EQ(4U, queue.getTotalDropped());
+
+    uint64_t out[8] = {};
+    EXPECT_EQ(7U, queue.popBulk(out, 8));
+    EXPECT_EQ(6U, out[6]);
+    EXPECT_EQ(7U, queue.getTotalPopped());
+}
+
+TEST_F(LockFreeQueueTest, ProducerAndConsumerKeepFifoOrderAcrossThreads)
+{
+    // Mixed single and bulk calls on both sides; a stale cached index would
+    // show up as a lost, repeated or reordered value
+    Queue queue(256, "spsc_queue");
+    constexpr uint64_t MESSAGES = 200000;
+
+    std::thread producer([&]()
+                         {
+        uint64_t next = 0;
+        uint64_t burst[32];
+        while (next < MESSAGES)
+        {
+            size_t pushed = 0;
+            if (next % 3 == 0)
+            {
+                pushed = queue.push(next) ? 1 : 0;
+            }
+            else
+            {
+                size_t count = std::min<uint64_t>(1 + next % 32, MESSAGES - next);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    burst[i] = next + i;
+                }
+                pushed = queue.pushBulk(burst, count);
+            }
+            next += pushed;
+            if (pushed == 0)
+            {
+                std::this_thread::yield();
+            }
+        } });
+
+    uint64_t expected = 0;
+    size_t out_of_order = 0;
+    uint64_t out[48];
+    while (expected < MESSAGES)
+    {
+        size_t count = queue.popBulk(out, 1 + expected % 48);
+        for (size_t i = 0; i < count; ++i)
+        {
+            out_of_order += out[i] != expected++;
+        }
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(0U, out_of_order);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(MESSAGES, queue.getTotalPopped());
+    EXPECT_EQ(MESSAGES, queue.getTotalPushed());
+}
+
+// =================================================================
+// MULTI-PRODUCER RINGS - run under -DFIX_GATEWAY_TSAN=ON as well
+// =================================================================
+
+namespace
+{
+    constexpr uint64_t PRODUCER_SHIFT = 48;
+
+    // Each producer pushes (producer << PRODUCER_SHIFT) | 0, 1, 2, ... mixing
+    // single and bulk pushes
+    void produceTokens(LockFreeQueue<uint64_t> &queue, uint64_t producer, uint64_t messages)
+    {
+        uint64_t next = 0;
+        uint64_t burst[16];
+        while (next < messages)
+        {
+            size_t count = std::min<uint64_t>(1 + (next + producer) % 16, messages - next);
+            for (size_t i = 0; i < count; ++i)
+            {
+                burst[i] = (producer << PRODUCER_SHIFT) | (next + i);
+            }
+            size_t pushed = count == 1 ? (queue.push(burst[0]) ? 1 : 0) : queue.pushBulk(burst, count);
+            next += pushed;
+            if (pushed == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+TEST_F(LockFreeQueueTest, MultiProducerFanInKeepsPerProducerOrder)
+{
+    constexpr uint64_t PRODUCERS = 4;
+    constexpr uint64_t MESSAGES = 50000;
+    Queue queue(128, "fan_in_queue", QueueMode::MPSC);
+
+    std::vector<std::thread> producers;
+    for (uint64_t p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back(produceTokens, std::ref(queue), p, MESSAGES);
+    }
+
+    // One consumer: every producer's tokens must arrive complete and in order
+    std::vector<uint64_t> expected(PRODUCERS, 0);
+    size_t errors = 0;
+    uint64_t received = 0;
+    uint64_t out[32];
+    while (received < PRODUCERS * MESSAGES)
+    {
+        size_t count = queue.popBulk(out, 1 + received % 32);
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t producer = out[i] >> PRODUCER_SHIFT;
+            uint64_t sequence = out[i] & ((1ULL << PRODUCER_SHIFT) - 1);
+            errors += producer >= PRODUCERS || sequence != expected[producer]++;
+        }
+        received += count;
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(0U, errors);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(PRODUCERS * MESSAGES, queue.getTotalPushed());
+    EXPECT_EQ(PRODUCERS * MESSAGES, queue.getTotalPopped());
+}
+
+TEST_F(LockFreeQueueTest, MultiConsumerRingDeliversEachMessageOnce)
+{
+    constexpr uint64_t PRODUCERS = 3;
+    constexpr uint64_t CONSUMERS = 3;
+    constexpr uint64_t MESSAGES = 30000;
+    Queue queue(64, "mpmc_queue", QueueMode::MPMC);
+
+    std::vector<std::thread> threads;
+    for (uint64_t p = 0; p < PRODUCERS; ++p)
+    {
+        threads.emplace_back(produceTokens, std::ref(queue), p, MESSAGES);
+    }
+
+    std::atomic<uint64_t> received{0};
+    std::vector<std::vector<uint64_t>> seen(CONSUMERS);
+    for (uint64_t c = 0; c < CONSUMERS; ++c)
+    {
+        threads.emplace_back([&, c]()
+                             {
+            uint64_t out[8];
+            while (received.load() < PRODUCERS * MESSAGES)
+            {
+                size_t count = c == 0 ? (queue.tryPop(out[0]) ? 1 : 0) : queue.popBulk(out, 8);
+                seen[c].insert(seen[c].end(), out, out + count);
+                received.fetch_add(count);
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+            } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every token exactly once across all consumers
+    std::vector<uint64_t> all;
+    for (auto &tokens : seen)
+    {
+        all.insert(all.end(), tokens.begin(), tokens.end());
+    }
+    ASSERT_EQ(PRODUCERS * MESSAGES, all.size());
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(all.end(), std::adjacent_find(all.begin(), all.end()));
+    EXPECT_EQ(PRODUCERS * MESSAGES, queue.getTotalPopped());
+}
+
+TEST_F(LockFreeQueueTest, ParkedConsumerIsWokenByPush)
+{
+    // A park far longer than the test: only the producer's wake can end it early
+    Queue queue(64, "park_queue", QueueMode::MPSC);
+    queue.setWaitStrategy(WaitConfig::spinPark(16, 0, std::chrono::seconds(10)));
+
+    std::atomic<bool> popped{false};
+    uint64_t value = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]()
+                         { popped = queue.popWait(value); });
+
+    while (queue.getWaitStrategy().getParkCount() == 0)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(queue.push(42));
+    consumer.join();
+
+    EXPECT_TRUE(popped.load());
+    EXPECT_EQ(42U, value);
+    EXPECT_GE(queue.getWaitStrategy().getWakeCount(), 1U);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(LockFreeQueueTest, PushWithoutParkedConsumerSkipsTheWake)
+{
+    Queue queue(64, "spin_queue");
+    queue.setWaitStrategy(WaitConfig::busySpin(64));
+
+    uint64_t value = 0;
+    EXPECT_FALSE(queue.popWait(value)); // One bounded spin round on an empty queue
+    ASSERT_TRUE(queue.push(7));
+    EXPECT_TRUE(queue.popWait(value));
+    EXPECT_EQ(7U, value);
+
+    // Parking lane with nobody parked: push never enters the kernel
+    queue.setWaitStrategy(WaitConfig::spinPark());
+    uint64_t burst[3] = {1, 2, 3};
+    ASSERT_EQ(3U, queue.pushBulk(burst, 3));
+    EXPECT_EQ(0U, queue.getWaitStrategy().getWakeCount());
+}
+
+TEST_F(LockFreeQueueTest, ShutdownEndsAParkedWait)
+{
+    Queue queue(64, "shutdown_queue");
+    queue.setWaitStrategy(WaitConfig::spinPark(16, 0, std::chrono::seconds(10)));
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]()
+                         {
+                             uint64_t out[4];
+                             EXPECT_EQ(0U, queue.popBulkWait(out, 4));
+                         });
+
+    while (queue.getWaitStrategy().getParkCount() == 0)
+    {
+        std::this_thread::yield();
+    }
+    queue.shutdown();
+    consumer.join();
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
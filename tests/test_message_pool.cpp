@@ -0,0 +1,538 @@
+#include <gtest/gtest.h>
+
+#include "common/message_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::common;
+
+namespace
+{
+    struct TestPayload
+    {
+        uint64_t sequence = 0;
+        char padding[120];
+    };
+
+    struct TestHeader
+    {
+        uint64_t sequence;
+        uint32_t live;
+        uint32_t reserved;
+    };
+
+    // Segregated layout: hot sequence in the header array, odd-sized payload
+    struct SplitPayload
+    {
+        TestHeader *header = nullptr;
+        char body[200];
+    };
+}
+
+template <>
+struct fix_gateway::common::PoolHeaderTraits<SplitPayload>
+{
+    static constexpr bool segregated = true;
+    using Header = TestHeader;
+    static void attach(SplitPayload *payload, Header *header)
+    {
+        header->live = 1;
+        payload->header = header;
+    }
+};
+
+class MessagePoolTest : public ::testing::Test
+{
+protected:
+    using Pool = MessagePool<TestPayload>;
+
+    static constexpr size_t POOL_SIZE = 4096;
+};
+
+TEST_F(MessagePoolTest, ThreadCacheServesRepeatedAllocations)
+{
+    Pool pool(POOL_SIZE, "magazine_pool");
+    ASSERT_TRUE(pool.threadCachesEnabled());
+
+    for (int round = 0; round < 100; ++round)
+    {
+        std::vector<TestPayload *> messages;
+        for (int i = 0; i < 10; ++i)
+        {
+            TestPayload *message = pool.allocate();
+            ASSERT_NE(nullptr, message);
+            messages.push_back(message);
+        }
+        EXPECT_EQ(10U, pool.allocated());
+        for (TestPayload *message : messages)
+        {
+            pool.deallocate(message);
+        }
+    }
+
+    auto stats = pool.getStats();
+    EXPECT_EQ(0U, stats.allocated_count);
+    EXPECT_EQ(POOL_SIZE, stats.available_count);
+    EXPECT_EQ(1000U, stats.total_allocations);
+    EXPECT_EQ(1000U, stats.total_deallocations);
+    EXPECT_EQ(1U, stats.thread_caches);
+    EXPECT_EQ(Pool::MAGAZINE_BATCH, stats.cached_count); // One refill covered every round
+
+    auto caches = pool.getThreadCacheStats();
+    ASSERT_EQ(1U, caches.size());
+    EXPECT_EQ(1000U, caches[0].allocations);
+    EXPECT_FALSE(caches[0].orphaned);
+}
+
+TEST_F(MessagePoolTest, CrossThreadFreesAreAccounted)
+{
+    // Receive-thread/manager-thread shape: one thread allocates, others free
+    Pool pool(POOL_SIZE, "cross_thread_pool");
+    constexpr size_t MESSAGES = 200000;
+    constexpr size_t FREERS = 2;
+
+    std::mutex mutex;
+    std::deque<TestPayload *> handoff;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> freers;
+    for (size_t f = 0; f < FREERS; ++f)
+    {
+        freers.emplace_back([&]()
+                            {
+            while (true)
+            {
+                TestPayload *message = nullptr;
+                bool finished = done.load();
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!handoff.empty())
+                    {
+                        message = handoff.front();
+                        handoff.pop_front();
+                    }
+                }
+                if (message)
+                {
+                    pool.deallocate(message);
+                }
+                else if (finished)
+                {
+                    return;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            } });
+    }
+
+    size_t allocated = 0;
+    while (allocated < MESSAGES)
+    {
+        TestPayload *message = pool.allocate();
+        if (!message)
+        {
+            std::this_thread::yield(); // Freers are behind; slots come back through their caches
+            continue;
+        }
+        message->sequence = allocated++;
+        std::lock_guard<std::mutex> lock(mutex);
+        handoff.push_back(message);
+    }
+    done.store(true);
+    for (auto &freer : freers)
+    {
+        freer.join();
+    }
+
+    auto stats = pool.getStats();
+    EXPECT_EQ(0U, stats.allocated_count);
+    EXPECT_EQ(MESSAGES, stats.total_allocations);
+    EXPECT_EQ(MESSAGES, stats.total_deallocations);
+    EXPECT_GE(stats.thread_caches, 2U); // A freer that never got a message has no cache
+    EXPECT_LE(stats.thread_caches, 1U + FREERS);
+    EXPECT_LE(stats.cached_count, (1U + FREERS) * Pool::MAGAZINE_CAPACITY);
+}
+
+TEST_F(MessagePoolTest, ExitedThreadCacheIsReclaimed)
+{
+    Pool pool(Pool::MAGAZINE_MIN_POOL_SIZE, "reclaim_pool");
+    pool.deallocate(pool.allocate()); // This thread has a cache before the worker runs
+
+    std::thread worker([&]()
+                       {
+        std::vector<TestPayload *> messages;
+        while (TestPayload *message = pool.allocate())
+        {
+            messages.push_back(message);
+        }
+        for (TestPayload *message : messages)
+        {
+            pool.deallocate(message);
+        } });
+    worker.join();
+
+    // The exited worker's cache still holds free slots until they are needed
+    auto caches = pool.getThreadCacheStats();
+    ASSERT_EQ(2U, caches.size());
+    EXPECT_TRUE(caches[1].orphaned);
+    EXPECT_GT(caches[1].cached_count, 0U);
+
+    std::vector<TestPayload *> messages;
+    while (TestPayload *message = pool.allocate())
+    {
+        messages.push_back(message);
+    }
+    EXPECT_EQ(pool.capacity(), messages.size());
+    EXPECT_EQ(0U, pool.getThreadCacheStats()[1].cached_count);
+
+    for (TestPayload *message : messages)
+    {
+        pool.deallocate(message);
+    }
+    EXPECT_EQ(0U, pool.allocated());
+}
+
+TEST_F(MessagePoolTest, IdleThreadCachesAreDrainedWhenThePoolRunsDry)
+{
+    Pool pool(Pool::MAGAZINE_MIN_POOL_SIZE, "drain_pool");
+    constexpr int IDLE_THREADS = 8;
+
+    // Each idle thread parks a full magazine of free slots and stays alive
+    std::atomic<int> parked{0};
+    std::atomic<bool> release{false};
+    std::vector<std::thread> idle;
+    for (int t = 0; t < IDLE_THREADS; ++t)
+    {
+        idle.emplace_back([&]()
+                          {
+            std::vector<TestPayload *> held;
+            for (uint32_t i = 0; i < Pool::MAGAZINE_CAPACITY; ++i)
+            {
+                held.push_back(pool.allocate());
+            }
+            for (TestPayload *message : held)
+            {
+                pool.deallocate(message);
+            }
+            parked.fetch_add(1);
+            while (!release.load())
+            {
+                std::this_thread::yield();
+            } });
+    }
+    while (parked.load() < IDLE_THREADS)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_GE(pool.getStats().cached_count, IDLE_THREADS * Pool::MAGAZINE_BATCH);
+
+    // Every slot is still reachable from this thread
+    std::vector<TestPayload *> messages;
+    while (TestPayload *message = pool.allocate())
+    {
+        messages.push_back(message);
+    }
+    EXPECT_EQ(pool.capacity(), messages.size());
+
+    for (TestPayload *message : messages)
+    {
+        pool.deallocate(message);
+    }
+    EXPECT_EQ(0U, pool.allocated());
+
+    // Drained but with slots cached in magazines: reset() must accept it
+    EXPECT_GT(pool.getStats().cached_count, 0U);
+    EXPECT_NO_THROW(pool.reset());
+    EXPECT_EQ(0U, pool.getStats().cached_count);
+    EXPECT_EQ(pool.capacity(), pool.available());
+
+    release.store(true);
+    for (auto &thread : idle)
+    {
+        thread.join();
+    }
+}
+
+TEST_F(MessagePoolTest, NewThreadAdoptsExitedThreadCache)
+{
+    Pool pool(POOL_SIZE, "adopt_pool");
+    for (int i = 0; i < 3; ++i)
+    {
+        std::thread([&]()
+                    { pool.deallocate(pool.allocate()); })
+            .join();
+    }
+    EXPECT_EQ(1U, pool.getStats().thread_caches);
+    EXPECT_EQ(3U, pool.getStats().total_allocations);
+}
+
+TEST_F(MessagePoolTest, SmallPoolsBypassThreadCaches)
+{
+    Pool pool(16, "small_pool");
+    EXPECT_FALSE(pool.threadCachesEnabled());
+
+    std::vector<TestPayload *> messages;
+    while (TestPayload *message = pool.allocate())
+    {
+        messages.push_back(message);
+    }
+    EXPECT_EQ(16U, messages.size());
+    EXPECT_EQ(1U, pool.getStats().allocation_failures);
+    EXPECT_EQ(0U, pool.getStats().thread_caches);
+
+    for (TestPayload *message : messages)
+    {
+        pool.deallocate(message);
+    }
+    EXPECT_EQ(0U, pool.allocated());
+}
+
+TEST_F(MessagePoolTest, MaintainGrowsAtWatermark)
+{
+    PoolConfig config;
+    config.initial_size = 256;
+    config.max_size = 1024;
+    config.grow_watermark = 0.5;
+    Pool pool(config, "growing_pool");
+    pool.prewarm();
+    ASSERT_TRUE(pool.isGrowable());
+
+    std::vector<TestPayload *> messages;
+    for (int i = 0; i < 100; ++i)
+    {
+        messages.push_back(pool.allocate());
+    }
+    EXPECT_FALSE(pool.maintain()); // Below the watermark
+
+    for (int i = 0; i < 50; ++i)
+    {
+        messages.push_back(pool.allocate());
+    }
+    EXPECT_TRUE(pool.maintain());
+    EXPECT_EQ(512U, pool.capacity());
+    EXPECT_EQ(2U, pool.getStats().slab_count);
+    EXPECT_EQ(0U, pool.getStats().emergency_growths);
+
+    // Slots of both slabs come back to the pool they were taken from
+    while (TestPayload *message = pool.allocate())
+    {
+        messages.push_back(message);
+    }
+    EXPECT_EQ(1024U, messages.size()); // Emergency growth filled the remaining slabs
+    EXPECT_EQ(4U, pool.getStats().slab_count);
+    for (TestPayload *message : messages)
+    {
+        EXPECT_TRUE(pool.owns(message));
+        pool.deallocate(message);
+    }
+    EXPECT_EQ(0U, pool.allocated());
+    EXPECT_FALSE(pool.grow()); // At max_size
+}
+
+TEST_F(MessagePoolTest, EmergencyGrowthReplacesFailure)
+{
+    PoolConfig config;
+    config.initial_size = Pool::MAGAZINE_MIN_POOL_SIZE;
+    config.max_size = 2 * Pool::MAGAZINE_MIN_POOL_SIZE;
+    Pool pool(config, "spike_pool");
+
+    std::vector<TestPayload *> messages;
+    for (size_t i = 0; i < Pool::MAGAZINE_MIN_POOL_SIZE + 1; ++i)
+    {
+        TestPayload *message = pool.allocate();
+        ASSERT_NE(nullptr, message);
+        messages.push_back(message);
+    }
+
+    auto stats = pool.getStats();
+    EXPECT_EQ(0U, stats.allocation_failures);
+    EXPECT_EQ(1U, stats.emergency_growths);
+    EXPECT_EQ(2 * Pool::MAGAZINE_MIN_POOL_SIZE, stats.total_capacity);
+
+    for (TestPayload *message : messages)
+    {
+        pool.deallocate(message);
+    }
+    EXPECT_EQ(0U, pool.allocated());
+}
+
+TEST_F(MessagePoolTest, FixedPoolDoesNotGrow)
+{
+    Pool pool(64, "fixed_pool");
+    EXPECT_FALSE(pool.isGrowable());
+    EXPECT_FALSE(pool.grow());
+
+    std::vector<TestPayload *> messages;
+    while (TestPayload *message = pool.allocate())
+    {
+        messages.push_back(message);
+    }
+    EXPECT_EQ(64U, messages.size());
+    EXPECT_FALSE(pool.maintain());
+    EXPECT_EQ(1U, pool.getStats().slab_count);
+
+    for (TestPayload *message : messages)
+    {
+        pool.deallocate(message);
+    }
+}
+
+TEST_F(MessagePoolTest, SegregatedLayoutPacksPayloadsAndExposesHeaders)
+{
+    MessagePool<SplitPayload> pool(128, "split_pool");
+    PoolLayoutInfo layout = pool.getLayout();
+    EXPECT_TRUE(layout.segregated);
+    EXPECT_EQ(sizeof(SplitPayload), layout.slot_stride); // No cache-line rounding
+    EXPECT_EQ(0U, layout.slot_padding);
+    EXPECT_EQ(sizeof(TestHeader), layout.header_size);
+    EXPECT_EQ(4U, layout.headers_per_cache_line);
+    EXPECT_EQ(128 * sizeof(TestHeader), layout.payload_offset);
+
+    // A type without traits keeps one cache-line-aligned slot per object
+    PoolLayoutInfo plain = Pool(16, "plain_pool").getLayout();
+    EXPECT_FALSE(plain.segregated);
+    EXPECT_EQ(0U, plain.slot_stride % Pool::CACHE_LINE_SIZE);
+    EXPECT_EQ(0U, plain.header_size);
+
+    std::vector<SplitPayload *> payloads;
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        SplitPayload *payload = pool.allocate();
+        ASSERT_NE(nullptr, payload);
+        EXPECT_EQ(payload->header, pool.headerOf(payload));
+        payload->header->sequence = i;
+        payloads.push_back(payload);
+    }
+
+    // Headers are dense and scanned without touching the payloads
+    size_t live = 0;
+    uint64_t sequence_sum = 0;
+    pool.forEachHeader([&](const TestHeader &header)
+                       {
+        live += header.live;
+        sequence_sum += header.live ? header.sequence : 0; });
+    EXPECT_EQ(10U, live);
+    EXPECT_EQ(45U, sequence_sum);
+
+    const TestHeader *first = pool.headerOf(payloads[0]);
+    const TestHeader *second = pool.headerOf(payloads[1]);
+    EXPECT_EQ(1, second - first); // Consecutive slots, adjacent headers
+
+    for (SplitPayload *payload : payloads)
+    {
+        pool.deallocate(payload);
+    }
+}
+
+// =================================================================
+// CONCURRENCY STRESS - run under -DFIX_GATEWAY_TSAN=ON as well
+// =================================================================
+
+class MessagePoolStressTest : public ::testing::TestWithParam<size_t>
+{
+protected:
+    using Pool = MessagePool<TestPayload>;
+
+    static constexpr size_t THREADS = 16;
+    static constexpr size_t ITERATIONS = 20000;
+    static constexpr size_t MAILBOXES = 64;
+};
+
+TEST_P(MessagePoolStressTest, ConcurrentAllocateDeallocateKeepsFreeListIntact)
+{
+    // 512 slots: every operation hits the shared free list; 4096: magazine
+    // refills and flushes race on it in batches
+    Pool pool(GetParam(), "stress_pool");
+    std::atomic<uint64_t> next_token{1};
+    std::atomic<size_t> corrupted{0};
+    std::atomic<TestPayload *> mailboxes[MAILBOXES] = {};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&, t]()
+                             {
+            uint64_t rng = t * 0x9E3779B97F4A7C15ULL + 1;
+            std::vector<std::pair<TestPayload *, uint64_t>> held;
+
+            for (size_t i = 0; i < ITERATIONS; ++i)
+            {
+                rng ^= rng << 13;
+                rng ^= rng >> 7;
+                rng ^= rng << 17;
+
+                // A burst of allocations, each stamped with a unique token
+                size_t burst = 1 + rng % 8;
+                for (size_t b = 0; b < burst; ++b)
+                {
+                    if (TestPayload *message = pool.allocate())
+                    {
+                        uint64_t token = next_token.fetch_add(1, std::memory_order_relaxed);
+                        message->sequence = token;
+                        held.emplace_back(message, token);
+                    }
+                }
+
+                // A slot handed out twice would have had its token overwritten
+                for (auto &entry : held)
+                {
+                    if (entry.first->sequence != entry.second)
+                    {
+                        corrupted.fetch_add(1);
+                    }
+                }
+
+                // Cross-thread frees: swap one message through a mailbox
+                auto &mailbox = mailboxes[rng % MAILBOXES];
+                TestPayload *previous = mailbox.exchange(held.back().first, std::memory_order_acq_rel);
+                held.pop_back();
+                if (previous)
+                {
+                    pool.deallocate(previous);
+                }
+
+                for (auto &entry : held)
+                {
+                    pool.deallocate(entry.first);
+                }
+                held.clear();
+            } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    for (auto &mailbox : mailboxes)
+    {
+        pool.deallocate(mailbox.exchange(nullptr));
+    }
+
+    EXPECT_EQ(0U, corrupted.load());
+    auto stats = pool.getStats();
+    EXPECT_EQ(0U, stats.allocated_count);
+    EXPECT_EQ(stats.total_allocations, stats.total_deallocations);
+    EXPECT_EQ(0U, stats.allocation_failures);
+
+    // A corrupted list loses slots or hands one out twice - drain it and check
+    std::vector<TestPayload *> drained;
+    while (TestPayload *message = pool.allocate())
+    {
+        drained.push_back(message);
+    }
+    EXPECT_EQ(pool.capacity(), drained.size());
+    std::sort(drained.begin(), drained.end());
+    EXPECT_EQ(drained.end(), std::adjacent_find(drained.begin(), drained.end()));
+    for (TestPayload *message : drained)
+    {
+        pool.deallocate(message);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SharedListAndMagazines, MessagePoolStressTest, ::testing::Values(512, 4096));
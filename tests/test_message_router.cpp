@@ -355,6 +355,78 @@ TEST_F(MessageRouterTest, LatencyMeasurement)
     deallocateMessage(message);
 }
 
+TEST_F(MessageRouterTest, HeaderPoolRoutingUsesPoolHeaders)
+{
+    router_->setHeaderPool(message_pool_.get());
+
+    FixMessage* message = createTestMessage(FixMsgType::NEW_ORDER_SINGLE);
+    ASSERT_NE(nullptr, message);
+    message->setMsgTypeEnum(FixMsgType::NEW_ORDER_SINGLE); // As the parser seeds it
+
+    const FixMessageHeader* header = message_pool_->headerOf(message);
+    ASSERT_NE(nullptr, header);
+    EXPECT_EQ(&message->header(), header);
+    EXPECT_TRUE(header->isLive());
+    EXPECT_EQ(FixMsgType::NEW_ORDER_SINGLE, header->msg_type);
+
+    EXPECT_TRUE(router_->routeMessage(message));
+    EXPECT_TRUE(header->hasPriority());
+    EXPECT_EQ(static_cast<uint8_t>(Priority::CRITICAL), header->priority);
+
+    auto routed = drainQueue(Priority::CRITICAL);
+    ASSERT_EQ(1U, routed.size());
+    EXPECT_EQ(1, routed[0]->getMsgSeqNum());
+    EXPECT_EQ(1, header->seq_num); // Cached in the header by the first read
+
+    deallocateMessage(message);
+    EXPECT_FALSE(header->isLive());
+}
+
+TEST_F(MessageRouterTest, HeaderScanRunsAlongsideRouting)
+{
+    // A monitor scans the header array while the router writes into it; with
+    // FIX_GATEWAY_TSAN this is the race check for the header fields
+    router_->setHeaderPool(message_pool_.get());
+
+    std::atomic<bool> done{false};
+    std::atomic<size_t> scans{0};
+    std::atomic<size_t> unknown_priorities{0};
+    std::thread monitor([&]()
+    {
+        while (!done.load(std::memory_order_acquire))
+        {
+            message_pool_->forEachHeader([&](const FixMessageHeader &header)
+            {
+                if (header.hasPriority() && header.priority > static_cast<uint8_t>(Priority::CRITICAL))
+                {
+                    unknown_priorities.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            scans.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (int i = 0; i < 500; ++i)
+    {
+        FixMessage* message = createTestMessage(FixMsgType::NEW_ORDER_SINGLE);
+        ASSERT_NE(nullptr, message);
+        message->setMsgTypeEnum(FixMsgType::NEW_ORDER_SINGLE);
+        ASSERT_TRUE(router_->routeMessage(message));
+        for (FixMessage* routed : drainQueue(Priority::CRITICAL))
+        {
+            deallocateMessage(routed);
+        }
+    }
+    while (scans.load(std::memory_order_relaxed) == 0)
+    {
+        std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    monitor.join();
+    EXPECT_EQ(0U, unknown_priorities.load());
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
 // =============================================================================
 // STRESS TESTS
 // =============================================================================
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "utils/priority_queue.h"
+#include "common/message.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::utils;
+using fix_gateway::common::Message;
+
+class PriorityQueueTest : public ::testing::Test
+{
+protected:
+    static MessagePtr makeMessage(const std::string &id, Priority priority)
+    {
+        return Message::create(id, "35=D|", priority);
+    }
+
+    // Pops everything and returns the message ids in pop order
+    static std::vector<std::string> drain(PriorityQueue &queue)
+    {
+        std::vector<std::string> ids;
+        MessagePtr message = nullptr;
+        while (queue.tryPop(message))
+        {
+            ids.push_back(message->getMessageId());
+            Message::destroy(message);
+        }
+        return ids;
+    }
+};
+
+TEST_F(PriorityQueueTest, PopsMostUrgentLevelFirstAndFifoWithinALevel)
+{
+    PriorityQueue queue(64, OverflowPolicy::REJECT, "order_queue");
+
+    ASSERT_TRUE(queue.push(makeMessage("low1", Priority::LOW)));
+    ASSERT_TRUE(queue.push(makeMessage("high1", Priority::HIGH)));
+    ASSERT_TRUE(queue.push(makeMessage("critical1", Priority::CRITICAL)));
+    ASSERT_TRUE(queue.push(makeMessage("low2", Priority::LOW)));
+    ASSERT_TRUE(queue.push(makeMessage("high2", Priority::HIGH)));
+    ASSERT_TRUE(queue.push(makeMessage("critical2", Priority::CRITICAL)));
+    EXPECT_EQ(6U, queue.size());
+    EXPECT_EQ(2U, queue.levelSize(Priority::HIGH));
+
+    std::vector<std::string> expected = {"critical1", "critical2", "high1", "high2", "low1", "low2"};
+    EXPECT_EQ(expected, drain(queue));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(6U, queue.getTotalPopped());
+}
+
+TEST_F(PriorityQueueTest, RejectAndDropNewestRefuseTheIncomingMessage)
+{
+    for (OverflowPolicy policy : {OverflowPolicy::REJECT, OverflowPolicy::DROP_NEWEST})
+    {
+        PriorityQueue queue(2, policy, "full_queue");
+        ASSERT_TRUE(queue.push(makeMessage("a", Priority::LOW)));
+        ASSERT_TRUE(queue.push(makeMessage("b", Priority::LOW)));
+        EXPECT_FALSE(queue.push(makeMessage("c", Priority::CRITICAL)));
+
+        EXPECT_EQ(1U, queue.getTotalDropped());
+        std::vector<std::string> expected = {"a", "b"};
+        EXPECT_EQ(expected, drain(queue));
+    }
+}
+
+TEST_F(PriorityQueueTest, DropOldestEvictsLeastUrgentButNeverMoreUrgent)
+{
+    PriorityQueue queue(3, OverflowPolicy::DROP_OLDEST, "evict_queue");
+    ASSERT_TRUE(queue.push(makeMessage("low1", Priority::LOW)));
+    ASSERT_TRUE(queue.push(makeMessage("low2", Priority::LOW)));
+    ASSERT_TRUE(queue.push(makeMessage("high1", Priority::HIGH)));
+
+    // Full: the oldest LOW message makes room for the CRITICAL one
+    EXPECT_TRUE(queue.push(makeMessage("critical1", Priority::CRITICAL)));
+    EXPECT_EQ(1U, queue.getTotalDropped());
+    EXPECT_EQ(3U, queue.size());
+
+    // MEDIUM evicts low2; then only more urgent messages are queued and LOW is refused
+    EXPECT_TRUE(queue.push(makeMessage("medium1", Priority::MEDIUM)));
+    EXPECT_FALSE(queue.push(makeMessage("low3", Priority::LOW)));
+    EXPECT_EQ(3U, queue.getTotalDropped());
+
+    std::vector<std::string> expected = {"critical1", "high1", "medium1"};
+    EXPECT_EQ(expected, drain(queue));
+}
+
+TEST_F(PriorityQueueTest, BlockingPopTimesOutAndBlockingPushWaitsForSpace)
+{
+    PriorityQueue queue(1, OverflowPolicy::BLOCK, "block_queue");
+
+    MessagePtr message = nullptr;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.pop(message, std::chrono::milliseconds(20)));
+    EXPECT_EQ(nullptr, message);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(queue.push(makeMessage("first", Priority::LOW)));
+    EXPECT_FALSE(queue.push(makeMessage("timeout", Priority::LOW), std::chrono::milliseconds(5)));
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]()
+                         { pushed = queue.push(makeMessage("second", Priority::LOW), std::chrono::seconds(10)); });
+
+    ASSERT_TRUE(queue.pop(message, std::chrono::seconds(10)));
+    EXPECT_EQ("first", message->getMessageId());
+    Message::destroy(message);
+
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    std::vector<std::string> expected = {"second"};
+    EXPECT_EQ(expected, drain(queue));
+}
+
+TEST_F(PriorityQueueTest, ProducersFanInWhileTheConsumerSchedules)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 5000;
+    PriorityQueue queue(256, OverflowPolicy::BLOCK, "fan_in_queue");
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&queue, p]()
+                               {
+                                   Priority priority = static_cast<Priority>(p);
+                                   for (int i = 0; i < PER_PRODUCER; ++i)
+                                   {
+                                       queue.push(Message::create(std::to_string(i), "35=D|", priority));
+                                   } });
+    }
+
+    // Within a level (one producer each here) ids must come out in order
+    std::vector<int> next(PRODUCERS, 0);
+    int received = 0;
+    while (received < PRODUCERS * PER_PRODUCER)
+    {
+        MessagePtr message = nullptr;
+        ASSERT_TRUE(queue.pop(message, std::chrono::seconds(10)));
+        int level = static_cast<int>(message->getPriority());
+        EXPECT_EQ(next[level], std::stoi(message->getMessageId()));
+        next[level]++;
+        received++;
+        Message::destroy(message);
+    }
+
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(0U, queue.getTotalDropped());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(PriorityQueueTest, MaxSizeGrowsOnlyWithinTheConstructedCapacity)
+{
+    PriorityQueue queue(2, OverflowPolicy::REJECT, "growing_queue", 8);
+    ASSERT_TRUE(queue.push(makeMessage("a", Priority::LOW)));
+    ASSERT_TRUE(queue.push(makeMessage("b", Priority::LOW)));
+    EXPECT_FALSE(queue.push(makeMessage("c", Priority::LOW)));
+
+    // Headroom from max_capacity: growth is accepted
+    EXPECT_TRUE(queue.setMaxSize(8));
+    EXPECT_TRUE(queue.push(makeMessage("c", Priority::LOW)));
+
+    // Past the rings: clamped and reported
+    EXPECT_FALSE(queue.setMaxSize(64));
+    EXPECT_EQ(8U, queue.capacity());
+    drain(queue);
+}
@@ -3,8 +3,19 @@
 #include "protocol/stream_fix_parser.h"
 #include "protocol/fix_message.h"
 #include "protocol/fix_fields.h"
+#include "protocol/fix_tokenizer.h"
+#include "protocol/fix_checksum.h"
+#include "protocol/fix_field_store.h"
+#include "protocol/fix_typed_messages.h"
+#include "protocol/fix_decimal.h"
+#include "protocol/fix_builder.h"
+#include "utils/fast_string_conversion.h"
 #include "common/message_pool.h"
+#include "common/receive_segment.h"
+#include "common/receive_ring.h"
 #include "utils/logger.h"
+#include "utils/latency_histogram.h"
+#include <atomic>
 #include <chrono>
 #include <random>
 #include <string>
@@ -434,6 +445,1419 @@ TEST_F(StreamFixParserComprehensiveTest, HandleMultiplePartialMessages)
     }
 }
 
+TEST_F(StreamFixParserComprehensiveTest, ResumableScanAcrossSmallFragments)
+{
+    std::string complete_msg = createExecutionReport("17=EXEC1\x01" "150=F\x01" "39=2\x01" "55=AAPL\x01"
+                                                     "54=1\x01" "38=100\x01" "44=150.25\x01");
+    StreamFixParser::ParseContext context;
+
+    // Retain fragments the way the partial buffer does; each call scans only the new bytes
+    std::string retained;
+    StreamFixParser::ParseResult result;
+    for (size_t offset = 0; offset < complete_msg.size(); offset += 7)
+    {
+        retained.append(complete_msg, offset, 7);
+        result = parser_->parseWithState(retained.data(), retained.size(), context);
+        if (result.status != StreamFixParser::ParseStatus::NeedMoreData)
+        {
+            break;
+        }
+        EXPECT_EQ(0U, result.bytes_consumed);
+        EXPECT_EQ(retained.size(), context.scanner.scanned());
+        EXPECT_NE(StreamFixParser::ParseState::IDLE, result.final_state);
+    }
+
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    ASSERT_NE(nullptr, result.parsed_message);
+    EXPECT_EQ(complete_msg.size(), result.bytes_consumed);
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, result.parsed_message->getMsgTypeEnum());
+    EXPECT_TRUE(result.parsed_message->hasField(FixFields::CheckSum));
+    EXPECT_EQ(StreamFixParser::ParseState::IDLE, context.current_state);
+    message_pool_->deallocate(result.parsed_message);
+
+    // A corrupted body byte is caught by the running checksum
+    std::string corrupted = createExecutionReport();
+    corrupted[corrupted.find("SENDER")] = 'T';
+    auto bad = parser_->parseWithState(corrupted.data(), corrupted.size(), context);
+    EXPECT_EQ(StreamFixParser::ParseStatus::ChecksumError, bad.status);
+    EXPECT_EQ(nullptr, bad.parsed_message);
+
+    // Header order is enforced as the bytes arrive
+    std::string misordered = "8=FIX.4.4\x01" "35=0\x01";
+    auto order = parser_->parseWithState(misordered.data(), misordered.size(), context);
+    EXPECT_EQ(StreamFixParser::ParseStatus::InvalidFormat, order.status);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TrailerSplitAcrossFragments)
+{
+    // Standard BodyLength excludes the trailer, so the body can arrive before "10=XXX"
+    std::string complete_msg = createExecutionReport("55=AAPL\x01");
+    size_t trailer_start = complete_msg.size() - 7;
+
+    for (size_t split = trailer_start; split < complete_msg.size(); ++split)
+    {
+        parser_->reset();
+        auto first = parser_->parse(complete_msg.data(), split);
+        EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, first.status) << "split at " << split;
+
+        auto second = parser_->parse(complete_msg.data() + split, complete_msg.size() - split);
+        ASSERT_EQ(StreamFixParser::ParseStatus::Success, second.status) << "split at " << split;
+        EXPECT_TRUE(second.parsed_message->hasField(FixFields::CheckSum));
+        message_pool_->deallocate(second.parsed_message);
+    }
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseReleasesSupersededMessages)
+{
+    // parse() hands out only the last message; the earlier ones must go back to the pool
+    std::string stream = createExecutionReport() + createOrderCancelReject() + createReject();
+    auto result = parser_->parse(stream.data(), stream.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    EXPECT_EQ(FixMsgType::REJECT, result.parsed_message->getMsgTypeEnum());
+    EXPECT_EQ(1U, message_pool_->allocated());
+    message_pool_->deallocate(result.parsed_message);
+
+    // A trailing fragment does not hide the message completed before it
+    std::string with_tail = createExecutionReport() + createReject().substr(0, 20);
+    result = parser_->parse(with_tail.data(), with_tail.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    EXPECT_EQ(with_tail.size(), result.bytes_consumed);
+    message_pool_->deallocate(result.parsed_message);
+    parser_->reset();
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+// =================================================================
+// BATCH PARSING TESTS
+// =================================================================
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchReturnsEveryCoalescedMessage)
+{
+    // Several messages coalesced into one recv() buffer
+    std::vector<std::string> msgs = {createExecutionReport(), createHeartbeat(), createOrderCancelReject(),
+                                     createExecutionReport("17=EXEC1\x01"), createTestRequest()};
+    std::string buffer;
+    for (const auto &m : msgs)
+    {
+        buffer += m;
+    }
+
+    FixMessage *out[16];
+    auto result = parser_->parseBatch(buffer.data(), buffer.size(), out, 16);
+
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    EXPECT_EQ(msgs.size(), result.messages_parsed);
+    EXPECT_EQ(0U, result.messages_dropped);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    EXPECT_FALSE(parser_->hasPartialMessage());
+    EXPECT_EQ(msgs.size(), message_pool_->allocated());
+
+    const char *expected_types[] = {"8", "0", "9", "8", "1"};
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        std::string msg_type;
+        EXPECT_TRUE(out[i]->getField(FixFields::MsgType, msg_type));
+        EXPECT_EQ(expected_types[i], msg_type);
+        message_pool_->deallocate(out[i]);
+    }
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchStopsAtOutputCapacity)
+{
+    const std::string msg = createHeartbeat();
+    std::string buffer;
+    for (int i = 0; i < 10; ++i)
+    {
+        buffer += msg;
+    }
+
+    FixMessage *out[4];
+    size_t offset = 0;
+    size_t total_parsed = 0;
+
+    while (offset < buffer.size())
+    {
+        auto result = parser_->parseBatch(buffer.data() + offset, buffer.size() - offset, out, 4);
+        ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+        ASSERT_LE(result.messages_parsed, 4U);
+        EXPECT_EQ(result.messages_parsed * msg.size(), result.bytes_consumed);
+
+        for (size_t i = 0; i < result.messages_parsed; ++i)
+        {
+            message_pool_->deallocate(out[i]);
+        }
+        total_parsed += result.messages_parsed;
+        offset += result.bytes_consumed;
+    }
+
+    EXPECT_EQ(10U, total_parsed);
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchRetainsPartialTail)
+{
+    const std::string msg1 = createExecutionReport();
+    const std::string msg2 = createHeartbeat();
+    const std::string msg3 = createExecutionReport("11=ORDER3\x01");
+    const size_t split = msg3.size() / 2;
+
+    std::string first = msg1 + msg2 + msg3.substr(0, split);
+    std::string second = msg3.substr(split);
+
+    FixMessage *out[8];
+    auto result1 = parser_->parseBatch(first.data(), first.size(), out, 8);
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result1.status);
+    EXPECT_EQ(2U, result1.messages_parsed);
+    EXPECT_EQ(first.size(), result1.bytes_consumed); // Tail is consumed into the partial buffer
+    EXPECT_TRUE(parser_->hasPartialMessage());
+    EXPECT_EQ(split, parser_->getPartialMessageSize());
+    for (size_t i = 0; i < result1.messages_parsed; ++i)
+    {
+        message_pool_->deallocate(out[i]);
+    }
+
+    auto result2 = parser_->parseBatch(second.data(), second.size(), out, 8);
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result2.status);
+    ASSERT_EQ(1U, result2.messages_parsed);
+    EXPECT_EQ(second.size(), result2.bytes_consumed);
+    EXPECT_FALSE(parser_->hasPartialMessage());
+
+    std::string order_id;
+    EXPECT_TRUE(out[0]->getField(FixFields::ClOrdID, order_id));
+    EXPECT_EQ("ORDER3", order_id);
+    message_pool_->deallocate(out[0]);
+}
+
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchResumesSplitFrameAcrossCalls)
+{
+    // Legacy BodyLength (trailer counted) must still complete on its own last byte
+    std::string body = "35=0\x01" "49=SENDER\x01" "56=TARGET\x01" "34=2\x01";
+    std::string legacy = "8=FIX.4.4\x01" "9=" + std::to_string(body.size() + 7) + "\x01" + body + "10=";
+    char checksum[3];
+    FixChecksum::format(FixChecksum::compute(legacy.data(), legacy.size() - 3), checksum);
+    legacy.append(checksum, 3).push_back('\x01');
+
+    FixMessage *out[4];
+    for (const std::string &msg : {createExecutionReport(), legacy})
+    {
+        // Seven-byte fragments: nothing is parsed until the fragment holding the last byte
+        uint64_t resumed = parser_->getStats().snapshot().partial_messages_handled;
+        size_t fragments = (msg.size() + 6) / 7;
+        for (size_t offset = 0; offset < msg.size(); offset += 7)
+        {
+            size_t chunk = std::min<size_t>(7, msg.size() - offset);
+            auto result = parser_->parseBatch(msg.data() + offset, chunk, out, 4);
+            EXPECT_EQ(chunk, result.bytes_consumed);
+            if (offset + chunk < msg.size())
+            {
+                ASSERT_EQ(StreamFixParser::ParseStatus::NeedMoreData, result.status);
+                ASSERT_EQ(offset + chunk, parser_->getPartialMessageSize());
+                continue;
+            }
+            EXPECT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+            ASSERT_EQ(1U, result.messages_parsed);
+            EXPECT_FALSE(parser_->hasPartialMessage());
+            message_pool_->deallocate(out[0]);
+        }
+        // Every fragment between the first and the last was resumed by the scanner
+        EXPECT_EQ(resumed + fragments - 2, parser_->getStats().snapshot().partial_messages_handled);
+    }
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchDropsTailThatCanNeverComplete)
+{
+    // Unterminated BodyLength: no frame ever completes, so it is not held
+    std::string runaway = "8=FIX.4.4\x01" "9=" + std::string(70000, '1');
+    FixMessage *out[4];
+    auto result = parser_->parseBatch(runaway.data(), runaway.size(), out, 4);
+    EXPECT_EQ(StreamFixParser::ParseStatus::MessageTooLarge, result.status);
+    EXPECT_EQ(runaway.size(), result.bytes_consumed);
+    EXPECT_EQ(0U, result.messages_parsed);
+    EXPECT_FALSE(parser_->hasPartialMessage());
+
+    // Resynced at the BeginString of the frame that follows it
+    std::string msg = createHeartbeat();
+    std::string buffer = runaway + "\x01" + msg;
+    result = parser_->parseBatch(buffer.data(), buffer.size(), out, 4);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    ASSERT_EQ(1U, result.messages_parsed) << result.error_detail;
+    message_pool_->deallocate(out[0]);
+    EXPECT_FALSE(parser_->hasPartialMessage());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchRecoversFromRunawayFrameInSmallReads)
+{
+    std::string runaway = "8=FIX.4.4\x01" "9=" + std::string(8 * 8192, '1');
+    FixMessage *out[4];
+
+    // Read by read the held tail never outgrows a frame, and every read is consumed
+    for (size_t offset = 0; offset < runaway.size(); offset += 8192)
+    {
+        size_t chunk = std::min<size_t>(8192, runaway.size() - offset);
+        auto result = parser_->parseBatch(runaway.data() + offset, chunk, out, 4);
+        ASSERT_EQ(chunk, result.bytes_consumed) << "read at " << offset << ": " << result.error_detail;
+        EXPECT_EQ(0U, result.messages_parsed);
+        EXPECT_LE(parser_->getPartialMessageSize(), 8192U + 32U);
+    }
+
+    std::string msg = createHeartbeat();
+    auto result = parser_->parseBatch(msg.data(), msg.size(), out, 4);
+    EXPECT_EQ(msg.size(), result.bytes_consumed);
+    ASSERT_EQ(1U, result.messages_parsed) << result.error_detail;
+    message_pool_->deallocate(out[0]);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, RingDropsTailThatCanNeverComplete)
+{
+    // Left in the ring, an unterminated BodyLength would fill it for good
+    ReceiveRing ring(65536);
+    std::string runaway = "8=FIX.4.4\x01" "9=" + std::string(9000, '1');
+    std::memcpy(ring.writePtr(), runaway.data(), runaway.size());
+    ring.commit(runaway.size());
+
+    FixMessage *out[4];
+    auto result = parser_->parseBatch(ring, out, 4);
+    EXPECT_EQ(StreamFixParser::ParseStatus::MessageTooLarge, result.status);
+    EXPECT_EQ(runaway.size(), result.bytes_consumed);
+    EXPECT_EQ(0U, ring.readable());
+
+    // A tail within the maximum size is still waited for
+    std::string msg = createHeartbeat();
+    std::memcpy(ring.writePtr(), msg.data(), msg.size() - 1);
+    ring.commit(msg.size() - 1);
+    result = parser_->parseBatch(ring, out, 4);
+    EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, result.status);
+    EXPECT_EQ(msg.size() - 1, ring.readable());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchSkipsCorruptFrame)
+{
+    std::string bad = createHeartbeat();
+    bad[bad.size() - 2] = (bad[bad.size() - 2] == '0') ? '1' : '0'; // Corrupt last checksum digit
+
+    std::string buffer = createExecutionReport() + bad + createHeartbeat();
+
+    FixMessage *out[8];
+    auto result = parser_->parseBatch(buffer.data(), buffer.size(), out, 8);
+
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    EXPECT_EQ(2U, result.messages_parsed);
+    EXPECT_EQ(1U, result.messages_dropped);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    EXPECT_EQ(2U, message_pool_->allocated()); // Failed frame returned its slot
+
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        message_pool_->deallocate(out[i]);
+    }
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParseBatchFromRingDecodesAcrossTheWrapInPlace)
+{
+    ReceiveRing ring(4096);
+    ASSERT_EQ(0U, ring.capacity() % 4096);
+
+    // Each report arrives in two reads; enough of them to wrap the ring several times
+    std::string report = createExecutionReport("11=RING-ORDER\x01");
+    size_t split = report.size() / 2;
+    size_t rounds = 3 * ring.capacity() / report.size();
+    FixMessage *out[4];
+
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        ASSERT_GE(ring.writable(), split);
+        std::memcpy(ring.writePtr(), report.data(), split);
+        ring.commit(split);
+
+        auto partial = parser_->parseBatch(ring, out, 4);
+        EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, partial.status);
+        EXPECT_EQ(0U, partial.bytes_consumed);
+        EXPECT_EQ(split, ring.readable()); // Tail stays in the ring, not in the parser
+        EXPECT_FALSE(parser_->hasPartialMessage());
+
+        std::memcpy(ring.writePtr(), report.data() + split, report.size() - split);
+        ring.commit(report.size() - split);
+
+        auto result = parser_->parseBatch(ring, out, 4);
+        ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+        ASSERT_EQ(1U, result.messages_parsed);
+        EXPECT_EQ(report.size(), result.bytes_consumed);
+        EXPECT_EQ(0U, ring.readable());
+        EXPECT_EQ("RING-ORDER", out[0]->getClOrdID());
+        message_pool_->deallocate(out[0]);
+    }
+}
+
+// =================================================================
+// TOKENIZER KERNEL TESTS
+// =================================================================
+
+TEST(FixTokenizerTest, KernelsProduceIdenticalTables)
+{
+    // Long enough to cross several 16/32-byte blocks, with '=' inside a value
+    std::string fields = "35=8\x01"
+                         "49=SENDER\x01"
+                         "56=TARGET\x01"
+                         "34=12345\x01"
+                         "58=text=with=equals\x01"
+                         "11=ORDER_0000000000000000000001\x01"
+                         "55=AAPL\x01"
+                         "44=150.25\x01"
+                         "38=1000\x01"
+                         "9999=\x01";
+
+    const FixTokenizer::Kernel kernels[] = {FixTokenizer::Kernel::SCALAR, FixTokenizer::Kernel::SSE2,
+                                            FixTokenizer::Kernel::AVX2};
+
+    FieldToken expected[32];
+    auto ref = FixTokenizer::tokenizeWith(FixTokenizer::Kernel::SCALAR, fields.data(), fields.size(), expected, 32);
+    ASSERT_EQ(FixTokenizer::Status::Ok, ref.status);
+    ASSERT_EQ(10U, ref.field_count);
+    EXPECT_EQ(fields.size(), ref.bytes_consumed);
+    EXPECT_EQ(58, expected[4].tag);
+    EXPECT_EQ("text=with=equals", fields.substr(expected[4].value_offset, expected[4].value_length));
+    EXPECT_EQ(9999, expected[9].tag);
+    EXPECT_EQ(0U, expected[9].value_length);
+
+    // Every prefix exercises the block tails of each kernel
+    for (auto kernel : kernels)
+    {
+        if (!FixTokenizer::isKernelSupported(kernel))
+            continue;
+
+        for (size_t len = 0; len <= fields.size(); ++len)
+        {
+            FieldToken got[32];
+            FieldToken want[32];
+            auto r = FixTokenizer::tokenizeWith(kernel, fields.data(), len, got, 32);
+            auto w = FixTokenizer::tokenizeWith(FixTokenizer::Kernel::SCALAR, fields.data(), len, want, 32);
+
+            ASSERT_EQ(w.status, r.status) << FixTokenizer::kernelName(kernel) << " len=" << len;
+            ASSERT_EQ(w.field_count, r.field_count) << FixTokenizer::kernelName(kernel) << " len=" << len;
+            ASSERT_EQ(w.bytes_consumed, r.bytes_consumed);
+            for (size_t i = 0; i < r.field_count; ++i)
+            {
+                EXPECT_EQ(want[i].tag, got[i].tag);
+                EXPECT_EQ(want[i].value_offset, got[i].value_offset);
+                EXPECT_EQ(want[i].value_length, got[i].value_length);
+            }
+        }
+    }
+}
+
+TEST(FixTokenizerTest, ResumesWhenTableFillsAndRejectsMalformedFields)
+{
+    std::string fields = "1=a\x01"
+                         "2=bb\x01"
+                         "3=ccc\x01";
+    FieldToken table[2];
+
+    auto first = FixTokenizer::tokenize(fields.data(), fields.size(), table, 2);
+    EXPECT_EQ(FixTokenizer::Status::Ok, first.status);
+    EXPECT_EQ(2U, first.field_count);
+    EXPECT_EQ(9U, first.bytes_consumed);
+
+    auto rest = FixTokenizer::tokenize(fields.data() + first.bytes_consumed, fields.size() - first.bytes_consumed, table, 2);
+    EXPECT_EQ(FixTokenizer::Status::Ok, rest.status);
+    ASSERT_EQ(1U, rest.field_count);
+    EXPECT_EQ(3, table[0].tag);
+
+    std::string missing_equals = "35=8\x01"
+                                 "49SENDER\x01";
+    EXPECT_EQ(FixTokenizer::Status::MissingEquals,
+              FixTokenizer::tokenize(missing_equals.data(), missing_equals.size(), table, 2).status);
+
+    std::string bad_tag = "3X=8\x01";
+    EXPECT_EQ(FixTokenizer::Status::InvalidTag, FixTokenizer::tokenize(bad_tag.data(), bad_tag.size(), table, 2).status);
+
+    std::string incomplete = "35=8\x01"
+                             "49=SEN";
+    auto partial = FixTokenizer::tokenize(incomplete.data(), incomplete.size(), table, 2);
+    EXPECT_EQ(FixTokenizer::Status::Incomplete, partial.status);
+    EXPECT_EQ(1U, partial.field_count);
+    EXPECT_EQ(5U, partial.bytes_consumed);
+}
+
+// =================================================================
+// CHECKSUM KERNEL TESTS
+// =================================================================
+
+TEST(FixChecksumTest, KernelsMatchScalarForAllLengths)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    std::string data(300, '\0');
+    for (auto &c : data)
+    {
+        c = static_cast<char>(byte_dist(gen)); // High bytes catch signed-char mistakes
+    }
+
+    const FixChecksum::Kernel kernels[] = {FixChecksum::Kernel::SSE2, FixChecksum::Kernel::AVX2};
+    for (size_t len = 0; len <= data.size(); ++len)
+    {
+        uint32_t expected = FixChecksum::byteSumWith(FixChecksum::Kernel::SCALAR, data.data(), len);
+        for (auto kernel : kernels)
+        {
+            ASSERT_EQ(expected, FixChecksum::byteSumWith(kernel, data.data(), len))
+                << FixTokenizer::kernelName(kernel) << " len=" << len;
+        }
+
+        // Fused tokenizer sum must cover every input byte, even when the scan stops early
+        uint32_t fused = 0;
+        FieldToken table[4];
+        FixTokenizer::tokenize(data.data(), len, table, 4, &fused);
+        ASSERT_EQ(expected, fused) << "len=" << len;
+    }
+}
+
+TEST(FixChecksumTest, IncrementalAndValidate)
+{
+    std::string body = "8=FIX.4.4\x01"
+                       "9=5\x01"
+                       "35=0\x01";
+
+    FixChecksum::Accumulator acc;
+    for (char c : body.substr(0, 7))
+    {
+        acc.update(c);
+    }
+    acc.update(body.data() + 7, body.size() - 7);
+    EXPECT_EQ(FixChecksum::compute(body.data(), body.size()), acc.value());
+
+    char digits[3];
+    FixChecksum::format(acc.value(), digits);
+    std::string message = body + "10=" + std::string(digits, 3) + "\x01";
+    EXPECT_TRUE(FixChecksum::validate(message.data(), message.size()));
+    EXPECT_TRUE(StreamParserUtils::validateChecksum(message.data(), message.size()));
+
+    message[message.size() - 2] = (message[message.size() - 2] == '9') ? '0' : '9';
+    EXPECT_FALSE(FixChecksum::validate(message.data(), message.size()));
+
+    uint8_t parsed = 0;
+    EXPECT_FALSE(FixChecksum::parse("256", parsed));
+    EXPECT_TRUE(FixChecksum::parse("007", parsed));
+    EXPECT_EQ(7, parsed);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, SerializedMessageChecksumRoundTrip)
+{
+    // The trailer FixMessage writes must validate against the bytes it serialized
+    FixMessage out;
+    out.setField(FixFields::MsgType, std::string("8"));
+    out.setField(FixFields::SenderCompID, std::string("SENDER"));
+    out.setField(FixFields::TargetCompID, std::string("TARGET"));
+    out.setField(FixFields::MsgSeqNum, 7);
+    out.setField(FixFields::ClOrdID, std::string("ROUNDTRIP1"));
+
+    std::string wire = out.toString();
+    EXPECT_TRUE(FixChecksum::validate(wire.data(), wire.size()));
+    EXPECT_TRUE(FixMessageUtils::verifyChecksum(wire));
+    EXPECT_EQ(wire.substr(wire.size() - 4, 3), out.calculateChecksum());
+
+    auto result = parser_->parse(wire.data(), wire.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    std::string cl_ord_id;
+    EXPECT_TRUE(result.parsed_message->getField(FixFields::ClOrdID, cl_ord_id));
+    EXPECT_EQ("ROUNDTRIP1", cl_ord_id);
+    message_pool_->deallocate(result.parsed_message);
+}
+
+TEST(FixMessageTimestampTest, SendingTimeStampedAtSerialization)
+{
+    FixMessage out;
+    EXPECT_FALSE(out.hasField(FixFields::SendingTime)); // Nothing formatted at construction
+    out.setField(FixFields::MsgType, std::string("0"));
+
+    std::string wire = out.toString();
+    size_t pos = wire.find("\x01" "52=");
+    ASSERT_NE(std::string::npos, pos);
+    EXPECT_EQ('\x01', wire[pos + 4 + FixMessageUtils::FIX_TIMESTAMP_LENGTH]);
+    EXPECT_TRUE(FixChecksum::validate(wire.data(), wire.size()));
+    EXPECT_EQ(wire.substr(wire.size() - 4, 3), out.calculateChecksum());
+
+    auto result_begin = wire.find("9=") + 2;
+    EXPECT_EQ(std::to_string(out.calculateBodyLength()),
+              wire.substr(result_begin, wire.find('\x01', result_begin) - result_begin));
+
+    // 2023-12-01 12:00:00 UTC - a second call in the same second reuses the cached prefix
+    auto base = std::chrono::system_clock::time_point(std::chrono::seconds(1701432000));
+    EXPECT_EQ("20231201-12:00:00.123", FixMessageUtils::formatFixTime(base + std::chrono::milliseconds(123)));
+    EXPECT_EQ("20231201-12:00:00.007", FixMessageUtils::formatFixTime(base + std::chrono::milliseconds(7)));
+    EXPECT_EQ("20231201-12:00:01.000", FixMessageUtils::formatFixTime(base + std::chrono::seconds(1)));
+
+    out.setSendingTime(base);
+    std::string pinned;
+    ASSERT_TRUE(out.getField(FixFields::SendingTime, pinned));
+    EXPECT_EQ("20231201-12:00:00.000", pinned);
+    EXPECT_LE(out.getCreationTsc(), out.getLastModifiedTsc());
+}
+
+TEST(FixMessageTimestampTest, LazySendingTimeSurvivesReserialization)
+{
+    FixMessage out;
+    out.setField(FixFields::MsgType, std::string("D"));
+    out.setField(FixFields::ClOrdID, std::string("ORD1"));
+
+    std::string first = out.toString();
+    std::string stamped;
+    ASSERT_TRUE(out.getField(FixFields::SendingTime, stamped));
+    EXPECT_NE(std::string::npos, first.find("\x01" "52=" + stamped + "\x01"));
+
+    // A modification after the first send invalidates the cached wire form
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    out.setField(FixFields::PossDupFlag, std::string("Y"));
+    std::string second = out.toString();
+    EXPECT_NE(first, second);
+
+    std::string restamped;
+    ASSERT_TRUE(out.getField(FixFields::SendingTime, restamped));
+    EXPECT_EQ(stamped, restamped);
+    EXPECT_NE(std::string::npos, second.find("\x01" "35=D\x01" "52=" + stamped + "\x01"));
+    EXPECT_TRUE(FixChecksum::validate(second.data(), second.size()));
+
+    auto result_begin = second.find("9=") + 2;
+    EXPECT_EQ(std::to_string(out.calculateBodyLength()),
+              second.substr(result_begin, second.find('\x01', result_begin) - result_begin));
+}
+
+// =================================================================
+// FIELD STORE TESTS
+// =================================================================
+
+TEST(FixFieldStoreTest, OverwriteEraseAndWireOrder)
+{
+    FixFieldStore store;
+    store.set(FixFields::MsgType, "D");
+    store.set(FixFields::ClOrdID, "ORDER-0001");
+    store.set(5000, "custom"); // Outside the direct index - scan path
+    store.set(FixFields::ClOrdID, "SHORT");
+    store.set(FixFields::Symbol, "MSFT");
+    store.set(FixFields::ClOrdID, "A-MUCH-LONGER-ORDER-ID");
+
+    std::string_view value;
+    ASSERT_TRUE(store.get(FixFields::ClOrdID, value));
+    EXPECT_EQ("A-MUCH-LONGER-ORDER-ID", value);
+    ASSERT_TRUE(store.get(5000, value));
+    EXPECT_EQ("custom", value);
+    EXPECT_FALSE(store.contains(FixFields::Price));
+    EXPECT_FALSE(store.contains(-1));
+
+    EXPECT_TRUE(store.erase(FixFields::MsgType));
+    EXPECT_FALSE(store.erase(FixFields::MsgType));
+
+    std::vector<int> order;
+    for (const auto &field : store)
+    {
+        order.push_back(field.first);
+    }
+    EXPECT_EQ((std::vector<int>{FixFields::ClOrdID, 5000, FixFields::Symbol}), order);
+    ASSERT_TRUE(store.get(FixFields::Symbol, value));
+    EXPECT_EQ("MSFT", value);
+    EXPECT_FALSE(store.spilled());
+}
+
+TEST(FixFieldStoreTest, SpillsBeyondInlineCapacityAndCopies)
+{
+    FixFieldStore store;
+    const std::string big(FixFieldStore::INLINE_ARENA_SIZE, 'x');
+    for (int tag = 1; tag <= 300; ++tag)
+    {
+        store.set(tag, std::to_string(tag));
+    }
+    store.set(9999, big);
+    EXPECT_TRUE(store.spilled());
+    EXPECT_EQ(301U, store.size());
+
+    // Tags past entry 255 no longer fit a direct slot and must still resolve
+    std::string_view value;
+    ASSERT_TRUE(store.get(290, value));
+    EXPECT_EQ("290", value);
+
+    // Self-aliasing set across an arena grow
+    store.get(9999, value);
+    store.set(7, value);
+    ASSERT_TRUE(store.get(7, value));
+    EXPECT_EQ(big, value);
+
+    FixFieldStore copy(store);
+    FixFieldStore moved(std::move(store));
+    EXPECT_TRUE(store.empty());
+    for (const auto *s : {&copy, &moved})
+    {
+        ASSERT_TRUE(s->get(150, value));
+        EXPECT_EQ("150", value);
+        ASSERT_TRUE(s->get(9999, value));
+        EXPECT_EQ(big.size(), value.size());
+    }
+
+    moved.clear();
+    EXPECT_FALSE(moved.contains(150));
+    moved.set(150, "again");
+    ASSERT_TRUE(moved.get(150, value));
+    EXPECT_EQ("again", value);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ParsedMessageFieldsStayInline)
+{
+    std::string message = createExecutionReport();
+    auto result = parser_->parse(message.data(), message.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+
+    FixMessage *msg = result.parsed_message;
+    EXPECT_FALSE(msg->getAllFields().spilled());
+
+    auto msg_type = msg->getFieldPtr(FixFields::MsgType);
+    ASSERT_TRUE(msg_type);
+    EXPECT_EQ("8", *msg_type);
+    EXPECT_FALSE(msg->getFieldPtr(FixFields::Price + 100000));
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, msg->getMsgTypeEnum());
+
+    std::string_view sender;
+    EXPECT_TRUE(msg->getField(FixFields::SenderCompID, sender));
+    EXPECT_EQ("SENDER", sender);
+    message_pool_->deallocate(msg);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, ViewModeReferencesPinnedSegment)
+{
+    ReceiveSegmentPool segments(2, 4096);
+    ReceiveSegment *segment = segments.acquire();
+    ASSERT_NE(nullptr, segment);
+
+    std::string first = createExecutionReport("11=VIEW-ORDER\x01");
+    std::string second = createHeartbeat();
+    std::string wire = first + second.substr(0, 10); // Second message split across reads
+    std::memcpy(segment->data(), wire.data(), wire.size());
+
+    FixMessage *out[4];
+    parser_->setReceiveSegment(segment);
+    auto result = parser_->parseBatch(segment->data(), wire.size(), out, 4);
+    parser_->setReceiveSegment(nullptr);
+    ASSERT_EQ(1U, result.messages_parsed);
+
+    FixMessage *view = out[0];
+    EXPECT_TRUE(view->isView());
+    EXPECT_EQ(2U, segment->refCount());
+
+    std::string_view cl_ord_id;
+    ASSERT_TRUE(view->getField(FixFields::ClOrdID, cl_ord_id));
+    EXPECT_EQ("VIEW-ORDER", cl_ord_id);
+    EXPECT_TRUE(segment->contains(cl_ord_id.data(), cl_ord_id.size())); // No copy
+
+    // Copies share the segment; owned writes override a referenced value
+    FixMessage copy(*view);
+    EXPECT_EQ(3U, segment->refCount());
+    copy.setField(FixFields::ClOrdID, std::string("LOCAL-OVERRIDE-ID"));
+    std::string owned;
+    ASSERT_TRUE(copy.getField(FixFields::ClOrdID, owned));
+    EXPECT_EQ("LOCAL-OVERRIDE-ID", owned);
+    copy.attachSegment(nullptr); // Detach copies every remaining value out
+    EXPECT_EQ(2U, segment->refCount());
+    ASSERT_TRUE(copy.getField(FixFields::SenderCompID, owned));
+    EXPECT_EQ("SENDER", owned);
+
+    // Tail completed from the parser's carry buffer is an ordinary owned message
+    ReceiveSegment *next = segments.acquire();
+    std::string rest = second.substr(10);
+    std::memcpy(next->data(), rest.data(), rest.size());
+    parser_->setReceiveSegment(next);
+    result = parser_->parseBatch(next->data(), rest.size(), out, 4);
+    parser_->setReceiveSegment(nullptr);
+    ASSERT_EQ(1U, result.messages_parsed);
+    EXPECT_FALSE(out[0]->isView());
+    message_pool_->deallocate(out[0]);
+    next->release();
+
+    // Segment goes back to the pool with its last reference
+    segment->release();
+    EXPECT_EQ(1U, segments.available());
+    message_pool_->deallocate(view);
+    EXPECT_EQ(2U, segments.available());
+}
+
+// =================================================================
+// TYPED SCHEMA DECODE TESTS
+// =================================================================
+
+namespace
+{
+    // Wrap a body (starting with 35=) in BeginString/BodyLength/CheckSum
+    std::string frameFixBody(const std::string &body)
+    {
+        std::string msg = "8=FIX.4.4\x01" "9=" + std::to_string(body.size()) + "\x01" + body;
+        char checksum[4] = {};
+        FixChecksum::format(FixChecksum::compute(msg.data(), msg.size()), checksum);
+        return msg + "10=" + checksum + "\x01";
+    }
+
+    // Re-frame a spec message with the legacy BodyLength reading (trailer counted)
+    std::string countTrailerInBodyLength(const std::string &message)
+    {
+        size_t digits = message.find("\x01" "9=") + 3;
+        size_t digits_end = message.find('\x01', digits);
+        size_t body_length = std::stoul(message.substr(digits, digits_end - digits));
+        std::string legacy = message.substr(0, digits) + std::to_string(body_length + FixChecksum::TRAILER_LENGTH) +
+                             message.substr(digits_end, message.size() - FixChecksum::TRAILER_LENGTH - digits_end);
+        char checksum[4] = {};
+        FixChecksum::format(FixChecksum::compute(legacy.data(), legacy.size()), checksum);
+        return legacy + "10=" + checksum + "\x01";
+    }
+}
+
+TEST_F(StreamFixParserComprehensiveTest, FrameValidationChecksBodyLength)
+{
+    std::string message = frameFixBody("35=0\x01" "49=C\x01" "56=E\x01" "34=1\x01");
+    EXPECT_TRUE(FixChecksum::validateBodyLength(message.data(), message.size()));
+    EXPECT_TRUE(FixChecksum::validateFrame(message.data(), message.size()));
+    EXPECT_TRUE(StreamParserUtils::validateBodyLength(message.data(), message.size()));
+
+    // Declared length too short: the checksum still matches, the length does not
+    std::string shifted = message;
+    size_t digits = shifted.find("\x01" "9=") + 3;
+    shifted[digits] = static_cast<char>(shifted[digits] - 1);
+    shifted.replace(shifted.size() - 4, 3, "000");
+    char checksum[3];
+    FixChecksum::format(FixChecksum::compute(shifted.data(), shifted.size() - FixChecksum::TRAILER_LENGTH), checksum);
+    shifted.replace(shifted.size() - 4, 3, checksum, 3);
+    EXPECT_TRUE(FixChecksum::validate(shifted.data(), shifted.size()));
+    EXPECT_FALSE(FixChecksum::validateBodyLength(shifted.data(), shifted.size()));
+    EXPECT_FALSE(FixChecksum::validateFrame(shifted.data(), shifted.size()));
+
+    // Legacy reading (trailer counted) and a non-numeric length are rejected too
+    std::string body = "35=0\x01" "49=C\x01";
+    std::string legacy = "8=FIX.4.4\x01" "9=" + std::to_string(body.size() + 7) + "\x01" + body + "10=000\x01";
+    EXPECT_FALSE(FixChecksum::validateBodyLength(legacy.data(), legacy.size()));
+    std::string garbage = "8=FIX.4.4\x01" "9=1x\x01" + body + "10=000\x01";
+    EXPECT_FALSE(FixChecksum::validateBodyLength(garbage.data(), garbage.size()));
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TrailerCountedFramesAdvanceByFrameEnd)
+{
+    // Decoders take the CheckSum from the frame end, never from BodyLength:
+    // without validation nothing else would stop them reading the next frame
+    parser_->setValidateChecksum(false);
+    std::string report = countTrailerInBodyLength(createExecutionReport());
+    std::string heartbeat = countTrailerInBodyLength(createHeartbeat());
+    std::string buffer = report + heartbeat + heartbeat;
+
+    FixMessage *out[4];
+    auto result = parser_->parseBatch(buffer.data(), buffer.size(), out, 4);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    ASSERT_EQ(3U, result.messages_parsed);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    std::string checksum;
+    ASSERT_TRUE(out[0]->getField(FixFields::CheckSum, checksum));
+    EXPECT_EQ(report.substr(report.size() - 4, 3), checksum);
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        message_pool_->deallocate(out[i]);
+    }
+
+    // Same frames from the ring: consumption stops exactly at readable()
+    ReceiveRing ring(4096);
+    std::memcpy(ring.writePtr(), buffer.data(), buffer.size());
+    ring.commit(buffer.size());
+    result = parser_->parseBatch(ring, out, 4);
+    ASSERT_EQ(3U, result.messages_parsed);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    EXPECT_EQ(0U, ring.readable());
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        message_pool_->deallocate(out[i]);
+    }
+
+    // parse() hands out the last of them and consumes the whole buffer
+    auto single = parser_->parse(buffer.data(), buffer.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, single.status) << single.error_detail;
+    EXPECT_EQ(buffer.size(), single.bytes_consumed);
+    message_pool_->deallocate(single.parsed_message);
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, BodyEndingInTag10SuffixIsNotTakenForTrailer)
+{
+    // Spec BodyLength: the last body field "110=100|" ends like a counted trailer
+    std::string message = frameFixBody("35=D\x01" "49=C\x01" "56=E\x01" "34=1\x01" "11=O\x01" "110=100\x01");
+    auto result = parser_->parse(message.data(), message.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ(message.size(), result.bytes_consumed);
+    std::string value;
+    ASSERT_TRUE(result.parsed_message->getField(110, value));
+    EXPECT_EQ("100", value);
+    message_pool_->deallocate(result.parsed_message);
+
+    // Body complete, trailer still in flight
+    parser_->reset();
+    size_t body_end = message.size() - FixChecksum::TRAILER_LENGTH;
+    result = parser_->parse(message.data(), body_end);
+    EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, result.status);
+    result = parser_->parse(message.data() + body_end, message.size() - body_end);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_TRUE(result.parsed_message->hasField(110));
+    message_pool_->deallocate(result.parsed_message);
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TypedDecodeOrderEntryMessages)
+{
+    std::string order = frameFixBody("35=D\x01" "49=CLIENT\x01" "56=EXCHANGE\x01" "34=42\x01"
+                                     "52=20231201-12:00:00.000\x01" "11=ORD-1\x01" "1=ACCT\x01"
+                                     "55=MSFT\x01" "54=2\x01" "38=1500.00\x01" "40=2\x01"
+                                     "44=101.2500\x01" "59=0\x01" "5000=ignored\x01");
+    TypedNewOrderSingle nos;
+    auto result = parser_->parseTyped(order.data(), order.size(), nos);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ(order.size(), result.bytes_consumed);
+    EXPECT_EQ(nullptr, result.parsed_message);
+    EXPECT_EQ("CLIENT", nos.sender_comp_id.view());
+    EXPECT_EQ(42U, nos.msg_seq_num);
+    EXPECT_EQ("ORD-1", nos.cl_ord_id.view());
+    EXPECT_EQ("ACCT", nos.account.view());
+    EXPECT_EQ(SideCode::Sell, nos.side);
+    EXPECT_EQ(1500, nos.order_qty);
+    EXPECT_EQ('2', nos.ord_type);
+    EXPECT_EQ(1012500, nos.price.mantissa);
+    EXPECT_EQ(4, nos.price.scale);
+    EXPECT_EQ((FixDecimal{10125, 2}), nos.price);
+    EXPECT_TRUE(nos.transact_time.empty());
+
+    // Fractional quantities are rejected rather than truncated
+    std::string fractional = frameFixBody("35=D\x01" "49=C\x01" "56=E\x01" "34=1\x01" "11=O\x01"
+                                          "55=MSFT\x01" "54=1\x01" "38=10.5\x01" "40=1\x01");
+    result = parser_->parseTyped(fractional.data(), fractional.size(), nos);
+    EXPECT_EQ(StreamFixParser::ParseStatus::FieldParseError, result.status);
+    EXPECT_NE(std::string::npos, result.error_detail.find("38"));
+
+    // Out-of-order tags still decode through the linear fallback
+    std::string cancel = frameFixBody("35=F\x01" "56=EXCHANGE\x01" "49=CLIENT\x01" "34=7\x01"
+                                      "11=ORD-2\x01" "54=1\x01" "55=IBM\x01" "41=ORD-1\x01");
+    TypedOrderCancelRequest cxl;
+    result = parser_->parseTyped(cancel.data(), cancel.size(), cxl);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ("ORD-1", cxl.orig_cl_ord_id.view());
+    EXPECT_EQ("ORD-2", cxl.cl_ord_id.view());
+    EXPECT_EQ(SideCode::Buy, cxl.side);
+    EXPECT_EQ(0, cxl.order_qty);
+
+    // Schema/MsgType mismatch and truncation
+    result = parser_->parseTyped(cancel.data(), cancel.size(), nos);
+    EXPECT_EQ(StreamFixParser::ParseStatus::InvalidFormat, result.status);
+    result = parser_->parseTyped(order.data(), order.size() - 3, nos);
+    EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, result.status);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TypedDecodeExecutionAndCancelReject)
+{
+    std::string report = createExecutionReport("37=EX-1\x01" "11=ORD-1\x01" "17=FILL-1\x01" "150=F\x01"
+                                               "39=1\x01" "55=AAPL\x01" "54=1\x01" "38=300\x01"
+                                               "32=100\x01" "31=189.99\x01" "151=200\x01" "14=100\x01"
+                                               "6=189.99\x01" "58=partial fill\x01");
+    TypedExecutionReport er;
+    auto result = parser_->parseTyped(report.data(), report.size(), er);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ("SENDER", er.sender_comp_id.view());
+    EXPECT_EQ("20231201-12:00:00", er.sending_time.view());
+    EXPECT_EQ('F', er.exec_type);
+    EXPECT_EQ('1', er.ord_status);
+    EXPECT_EQ(100, er.last_qty);
+    EXPECT_EQ(200, er.leaves_qty);
+    EXPECT_EQ((FixDecimal{18999, 2}), er.last_px);
+    EXPECT_DOUBLE_EQ(189.99, er.avg_px.toDouble());
+    EXPECT_EQ("partial fill", er.text.view());
+
+    // Corrupted checksum
+    std::string corrupted = report;
+    corrupted[corrupted.size() - 2] = corrupted[corrupted.size() - 2] == '0' ? '1' : '0';
+    result = parser_->parseTyped(corrupted.data(), corrupted.size(), er);
+    EXPECT_EQ(StreamFixParser::ParseStatus::ChecksumError, result.status);
+
+    // The fixture's cancel reject omits OrigClOrdID (41) and CxlRejResponseTo (434)
+    std::string reject = createOrderCancelReject();
+    TypedOrderCancelReject ocr;
+    result = parser_->parseTyped(reject.data(), reject.size(), ocr);
+    EXPECT_EQ(StreamFixParser::ParseStatus::FieldParseError, result.status);
+    EXPECT_EQ("Missing required tag 41", result.error_detail);
+
+    std::string complete = frameFixBody("35=9\x01" "49=EXCHANGE\x01" "56=CLIENT\x01" "34=125\x01"
+                                        "37=REJECT001\x01" "11=ORDER002\x01" "41=ORDER001\x01"
+                                        "39=8\x01" "434=1\x01" "102=0\x01");
+    result = parser_->parseTyped(complete.data(), complete.size(), ocr);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ("ORDER001", ocr.orig_cl_ord_id.view());
+    EXPECT_EQ('1', ocr.cxl_rej_response_to);
+    EXPECT_EQ(0U, ocr.cxl_rej_reason);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TypedDecodeMarketDataGroup)
+{
+    std::string refresh = frameFixBody("35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=9\x01" "262=REQ-1\x01"
+                                       "268=2\x01"
+                                       "279=0\x01" "269=0\x01" "278=B1\x01" "55=EURUSD\x01" "270=1.08515\x01" "271=1000000\x01"
+                                       "279=2\x01" "269=1\x01" "278=A7\x01" "55=EURUSD\x01" "270=1.0852\x01" "271=0\x01");
+    TypedMarketDataIncrementalRefresh md;
+    auto result = parser_->parseTyped(refresh.data(), refresh.size(), md);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ("REQ-1", md.md_req_id.view());
+    ASSERT_EQ(2U, md.entry_count);
+    EXPECT_EQ('0', md.entries[0].update_action);
+    EXPECT_EQ("B1", md.entries[0].entry_id.view());
+    EXPECT_EQ((FixDecimal{108515, 5}), md.entries[0].price);
+    EXPECT_EQ(1000000, md.entries[0].size);
+    EXPECT_EQ('2', md.entries[1].update_action);
+    EXPECT_EQ('1', md.entries[1].entry_type);
+    EXPECT_EQ("A7", md.entries[1].entry_id.view());
+    EXPECT_EQ("EURUSD", md.entries[1].symbol.view());
+    EXPECT_EQ(0, md.entries[1].size);
+
+    // NoMDEntries must match the number of entries on the wire
+    std::string short_count = frameFixBody("35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=10\x01" "268=3\x01"
+                                           "279=0\x01" "269=0\x01" "270=1.1\x01");
+    result = parser_->parseTyped(short_count.data(), short_count.size(), md);
+    EXPECT_EQ(StreamFixParser::ParseStatus::FieldParseError, result.status);
+
+    // Group field ahead of its delimiter
+    std::string no_delimiter = frameFixBody("35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=11\x01" "268=1\x01"
+                                            "269=0\x01" "279=0\x01");
+    result = parser_->parseTyped(no_delimiter.data(), no_delimiter.size(), md);
+    EXPECT_EQ(StreamFixParser::ParseStatus::FieldParseError, result.status);
+    EXPECT_EQ("Invalid value for tag 269", result.error_detail);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, TypedDecodeFallsBackWhenValuesDoNotFit)
+{
+    // Text longer than the typed field: decoded generically instead of rejected
+    std::string text(300, 'x');
+    std::string report = createExecutionReport("37=EX-1\x01" "17=FILL-1\x01" "150=0\x01" "39=0\x01"
+                                               "55=AAPL\x01" "54=1\x01" "151=100\x01" "14=0\x01"
+                                               "58=" + text + "\x01");
+    TypedExecutionReport er;
+    auto result = parser_->parseTyped(report.data(), report.size(), er);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    EXPECT_EQ(report.size(), result.bytes_consumed);
+    ASSERT_NE(nullptr, result.parsed_message);
+    std::string value;
+    ASSERT_TRUE(result.parsed_message->getField(FixFields::Text, value));
+    EXPECT_EQ(text, value);
+    message_pool_->deallocate(result.parsed_message);
+
+    // More group entries than the typed struct holds
+    const size_t entries = TypedMarketDataIncrementalRefresh::MAX_ENTRIES + 1;
+    std::string body = "35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=12\x01" "268=" + std::to_string(entries) + "\x01";
+    for (size_t i = 0; i < entries; ++i)
+    {
+        body += "279=0\x01" "269=0\x01" "270=1.1\x01";
+    }
+    std::string refresh = frameFixBody(body);
+    TypedMarketDataIncrementalRefresh md;
+    result = parser_->parseTyped(refresh.data(), refresh.size(), md);
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    ASSERT_NE(nullptr, result.parsed_message);
+    EXPECT_EQ(FixMsgType::MARKET_DATA_INCREMENTAL_REFRESH, result.parsed_message->getMsgTypeEnum());
+    message_pool_->deallocate(result.parsed_message);
+    EXPECT_EQ(0U, message_pool_->allocated());
+}
+
+// =================================================================
+// FIXED-POINT DECIMAL TESTS
+// =================================================================
+
+TEST(FixDecimalTest, ParsesDigitRunsExactly)
+{
+    FixDecimal value;
+    ASSERT_TRUE(FixDecimal::parse("123456789.87654321", value)); // Two 8-byte chunks + tails
+    EXPECT_EQ(12345678987654321LL, value.mantissa);
+    EXPECT_EQ(8, value.scale);
+
+    ASSERT_TRUE(FixDecimal::parse("-0000000000000.25", value)); // Leading zeros are not significant
+    EXPECT_EQ(-25, value.mantissa);
+    EXPECT_EQ(2, value.scale);
+
+    ASSERT_TRUE(FixDecimal::parse("9223372036854775807", value));
+    EXPECT_EQ(INT64_MAX, value.mantissa);
+    ASSERT_TRUE(FixDecimal::parse("7.", value));
+    EXPECT_EQ(7, value.mantissa);
+    ASSERT_TRUE(FixDecimal::parse(".5", value));
+    EXPECT_EQ((FixDecimal{5, 1}), value);
+
+    for (const char *bad : {"", "-", ".", "1.2.3", "12a45678", "1234567a", "1e5", " 1", "9223372036854775808",
+                            "12345678901234567890", "0.1234567890123456789"})
+    {
+        EXPECT_FALSE(FixDecimal::parse(bad, value)) << bad;
+    }
+}
+
+TEST(FixDecimalTest, FormatsRescalesAndComparesAcrossScales)
+{
+    EXPECT_EQ("101.2500", (FixDecimal{1012500, 4}).toString());
+    EXPECT_EQ("-0.005", (FixDecimal{-5, 3}).toString());
+    EXPECT_EQ("42", FixDecimal::fromInteger(42).toString());
+    EXPECT_EQ("-9223372036854775808", (FixDecimal{INT64_MIN, 0}).toString());
+    EXPECT_EQ("-9.223372036854775808", (FixDecimal{INT64_MIN, 18}).toString()); // MAX_TEXT_LENGTH chars
+    EXPECT_EQ("-0.000000000000000001", (FixDecimal{-1, 18}).toString());
+
+    FixDecimal price{1012550, 4};
+    ASSERT_TRUE(price.rescale(2)); // Half away from zero
+    EXPECT_EQ("101.26", price.toString());
+    FixDecimal negative{-1012550, 4};
+    ASSERT_TRUE(negative.rescale(2));
+    EXPECT_EQ("-101.26", negative.toString());
+    ASSERT_TRUE(price.rescale(5));
+    EXPECT_EQ("101.26000", price.toString());
+    FixDecimal huge{INT64_MAX / 10, 0};
+    EXPECT_FALSE(huge.rescale(2));
+    EXPECT_EQ(0, huge.scale); // Unchanged on overflow
+
+    EXPECT_EQ((FixDecimal{15, 1}), (FixDecimal{150, 2}));
+    EXPECT_LT((FixDecimal{1499, 3}), (FixDecimal{15, 1}));
+    EXPECT_EQ((FixDecimal{10125, 2}), FixDecimal::fromDouble(101.25, 2));
+    EXPECT_DOUBLE_EQ(101.25, (FixDecimal{1012500, 4}).toDouble());
+
+    using fix_gateway::utils::FastStringConversion;
+    EXPECT_EQ("101.25", FastStringConversion::double_to_string(101.25, 2));
+    EXPECT_EQ("-0.50", FastStringConversion::double_to_string(-0.5, 2));
+    EXPECT_EQ("3", FastStringConversion::double_to_string(2.5, 0));
+    EXPECT_EQ("1.000000000", FastStringConversion::double_to_string(0.9999999999, 12)); // Clamped to 9
+}
+
+TEST(FixDecimalTest, MessageAndBuilderUseFixedPoint)
+{
+    FixMessage msg;
+    msg.setField(FixFields::Price, FixDecimal{1085150, 6});
+    std::string text;
+    ASSERT_TRUE(msg.getField(FixFields::Price, text));
+    EXPECT_EQ("1.085150", text);
+
+    FixDecimal price;
+    ASSERT_TRUE(msg.getField(FixFields::Price, price));
+    EXPECT_EQ((FixDecimal{108515, 5}), price);
+    double approx = 0.0;
+    ASSERT_TRUE(msg.getField(FixFields::Price, approx));
+    EXPECT_DOUBLE_EQ(1.08515, approx);
+    msg.setField(FixFields::Text, std::string("n/a"));
+    EXPECT_FALSE(msg.getField(FixFields::Text, price));
+
+    FixBuilder builder("CLIENT", "EXCHANGE");
+    builder.setPriceScale("EURUSD", 5);
+    builder.setPriceScale("MSFT", 2);
+    EXPECT_EQ(PriceScaleTable::KEEP_SCALE, builder.getPriceScales().scaleFor("IBM"));
+
+    auto order = builder.createMessage(MsgTypes::NewOrderSingle)
+                     .setSymbol("MSFT")
+                     .setOrderQty(FixDecimal::fromInteger(100))
+                     .setPrice(FixDecimal{4123456, 4})
+                     .buildMessage();
+    ASSERT_TRUE(order->getField(FixFields::Price, text));
+    EXPECT_EQ("412.35", text);
+
+    std::string wire = builder.buildNewOrderSingle("ORD-9", "EURUSD", "1", FixDecimal::fromInteger(1000000),
+                                                   FixDecimal{10852, 4});
+    EXPECT_NE(std::string::npos, wire.find("\x01" "44=1.08520\x01"));
+    EXPECT_NE(std::string::npos, wire.find("\x01" "38=1000000\x01"));
+}
+
+// =================================================================
+// REPEATING GROUP TESTS
+// =================================================================
+
+TEST_F(StreamFixParserComprehensiveTest, SnapshotBookKeepsEveryGroupEntry)
+{
+    // 50-level book: 100 entries (bid and offer per level)
+    std::string body = "35=W\x01" "49=FEED\x01" "56=CLIENT\x01" "34=3\x01" "52=20231201-12:00:00.000\x01"
+                       "55=MSFT\x01" "268=100\x01";
+    for (int level = 0; level < 50; ++level)
+    {
+        body += "269=0\x01" "270=" + std::to_string(400 - level) + ".25\x01" "271=" + std::to_string(100 + level) + "\x01";
+        body += "269=1\x01" "270=" + std::to_string(401 + level) + ".75\x01" "271=" + std::to_string(200 + level) + "\x01";
+    }
+    body += "58=end\x01";
+    std::string message = frameFixBody(body);
+
+    auto result = parser_->parse(message.data(), message.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    FixMessage *msg = result.parsed_message;
+
+    ASSERT_EQ(100U, msg->getGroupEntryCount(FixFields::NoMDEntries));
+    std::string_view value;
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 99, FixFields::MDEntryType, value));
+    EXPECT_EQ("1", value);
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 98, FixFields::MDEntrySize, value));
+    EXPECT_EQ("149", value);
+    FixDecimal px;
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 1, FixFields::MDEntryPx, px));
+    EXPECT_EQ((FixDecimal{40175, 2}), px);
+    EXPECT_FALSE(msg->getGroupField(FixFields::NoMDEntries, 0, FixFields::MDEntryTime, value)); // Absent member
+    EXPECT_FALSE(msg->getGroupField(FixFields::NoMDEntries, 100, FixFields::MDEntryType, value));
+    EXPECT_FALSE(msg->getGroupField(FixFields::NoMDEntries, 0, FixFields::Symbol, value)); // Not a W member
+
+    // Plain fields around the group are unaffected; group tags do not leak into them
+    std::string text;
+    ASSERT_TRUE(msg->getField(FixFields::Symbol, text));
+    EXPECT_EQ("MSFT", text);
+    ASSERT_TRUE(msg->getField(FixFields::Text, text));
+    EXPECT_EQ("end", text);
+    EXPECT_FALSE(msg->hasField(FixFields::MDEntryPx));
+
+    // Wire order round-trips, and copies keep the group
+    EXPECT_EQ(message, msg->toString());
+    FixMessage copy(*msg);
+    message_pool_->deallocate(msg);
+    ASSERT_TRUE(copy.getGroupField(FixFields::NoMDEntries, 50, FixFields::MDEntryPx, value));
+    EXPECT_EQ("375.25", value);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, GroupEntriesKeepUnlistedTags)
+{
+    // MDEntryDate (272), NumberOfOrders (346) and MDPriceLevel (1023) are not
+    // in the definition but belong to the entry
+    std::string message = frameFixBody("35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=5\x01" "52=20231201-12:00:00.000\x01"
+                                       "268=2\x01"
+                                       "279=0\x01" "269=0\x01" "55=EURUSD\x01" "270=1.0851\x01" "271=100\x01"
+                                       "272=20231201\x01" "273=12:00:00\x01" "346=3\x01" "1023=1\x01"
+                                       "279=1\x01" "269=1\x01" "55=EURUSD\x01" "270=1.0853\x01" "272=20231201\x01"
+                                       "273=12:00:01\x01" "1023=2\x01"
+                                       "58=done\x01");
+    auto result = parser_->parse(message.data(), message.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    FixMessage *msg = result.parsed_message;
+
+    ASSERT_EQ(2U, msg->getGroupEntryCount(FixFields::NoMDEntries));
+    std::string_view value;
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 0, 346, value));
+    EXPECT_EQ("3", value);
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 0, FixFields::MDEntryTime, value));
+    EXPECT_EQ("12:00:00", value);
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 1, 1023, value)); // Extra in the last entry
+    EXPECT_EQ("2", value);
+    ASSERT_TRUE(msg->getGroupField(FixFields::NoMDEntries, 1, FixFields::MDEntryTime, value));
+    EXPECT_EQ("12:00:01", value);
+    EXPECT_FALSE(msg->getGroupField(FixFields::NoMDEntries, 1, 346, value));
+
+    // Extras stay out of the message-level index; the body field after the group does not
+    EXPECT_FALSE(msg->hasField(346));
+    std::string text;
+    ASSERT_TRUE(msg->getField(FixFields::Text, text));
+    EXPECT_EQ("done", text);
+    EXPECT_EQ(message, msg->toString());
+    message_pool_->deallocate(msg);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, MalformedRepeatingGroupsAreRejected)
+{
+    const std::string header = "35=X\x01" "49=FEED\x01" "56=CLIENT\x01" "34=4\x01" "52=20231201-12:00:00.000\x01";
+    std::string good = frameFixBody(header + "268=2\x01"
+                                    "279=0\x01" "269=0\x01" "55=EURUSD\x01" "270=1.0851\x01"
+                                    "279=2\x01" "269=1\x01" "278=A7\x01" "55=GBPUSD\x01");
+    auto result = parser_->parse(good.data(), good.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    std::string_view value;
+    ASSERT_TRUE(result.parsed_message->getGroupField(FixFields::NoMDEntries, 1, FixFields::Symbol, value));
+    EXPECT_EQ("GBPUSD", value);
+    ASSERT_TRUE(result.parsed_message->getGroupField(FixFields::NoMDEntries, 1, FixFields::MDEntryID, value));
+    EXPECT_EQ("A7", value);
+    message_pool_->deallocate(result.parsed_message);
+
+    for (const std::string &group : {std::string("268=2\x01" "279=0\x01" "269=0\x01"),                    // Too few
+                                     std::string("268=1\x01" "279=0\x01" "279=1\x01"),                    // Too many
+                                     std::string("268=1\x01" "269=0\x01" "279=0\x01"),                    // Before delimiter
+                                     std::string("268=1\x01" "279=0\x01" "269=0\x01" "269=1\x01"),        // Repeated member
+                                     std::string("268=x\x01" "279=0\x01")})                               // Bad count
+    {
+        std::string message = frameFixBody(header + group);
+        result = parser_->parse(message.data(), message.size());
+        EXPECT_EQ(StreamFixParser::ParseStatus::FieldParseError, result.status) << group;
+        EXPECT_EQ(nullptr, result.parsed_message);
+    }
+}
+
+TEST(FixFieldStoreTest, BuiltGroupsSerializeAndSurviveErase)
+{
+    FixMessage request;
+    request.setField(FixFields::MsgType, std::string_view(MsgTypes::MarketDataRequest));
+    request.setField(FixFields::MDReqID, std::string("REQ-7"));
+    request.setField(FixFields::SendingTime, std::string("20231201-12:00:00.000"));
+    ASSERT_TRUE(request.beginGroup(FixFields::NoRelatedSym, 2));
+    EXPECT_EQ(FixFieldStore::GroupAppend::Added, request.addGroupField(FixFields::Symbol, "MSFT"));
+    EXPECT_EQ(FixFieldStore::GroupAppend::Added, request.addGroupField(FixFields::Symbol, "IBM"));
+    EXPECT_TRUE(request.endGroup());
+    EXPECT_FALSE(request.beginGroup(FixFields::Price, 1)); // Not a group of V
+
+    // Erasing a field before the group shifts entries; cells must follow
+    request.removeField(FixFields::MDReqID);
+    std::string_view value;
+    ASSERT_TRUE(request.getGroupField(FixFields::NoRelatedSym, 1, FixFields::Symbol, value));
+    EXPECT_EQ("IBM", value);
+    request.removeField(FixFields::NoRelatedSym); // Refused while the group exists
+    EXPECT_TRUE(request.hasField(FixFields::NoRelatedSym));
+
+    std::string wire = request.toString();
+    EXPECT_NE(std::string::npos, wire.find("\x01" "146=2\x01" "55=MSFT\x01" "55=IBM\x01" "10="));
+    EXPECT_FALSE(request.hasField(FixFields::Symbol));
+}
+
+// =================================================================
+// MESSAGE TYPE DISPATCH TESTS
+// =================================================================
+
+TEST(FixMsgTypeTableTest, CodesRoundTripThroughTable)
+{
+    for (size_t i = 0; i + 1 < FixMsgTypeUtils::MSG_TYPE_COUNT; ++i)
+    {
+        FixMsgType type = static_cast<FixMsgType>(i);
+        const char *code = FixMsgTypeUtils::toString(type);
+        EXPECT_EQ(type, FixMsgTypeUtils::fromString(code)) << code;
+        EXPECT_EQ(type, FixMsgTypeUtils::fromString(std::string_view(code))) << code;
+    }
+
+    EXPECT_EQ(FixMsgType::UNKNOWN, FixMsgTypeUtils::fromString(std::string_view("")));
+    EXPECT_EQ(FixMsgType::UNKNOWN, FixMsgTypeUtils::fromString(std::string_view("Z")));
+    EXPECT_EQ(FixMsgType::UNKNOWN, FixMsgTypeUtils::fromString(std::string_view("8D"))); // Prefix of a known code
+    EXPECT_EQ(FixMsgType::UNKNOWN, FixMsgTypeUtils::fromString("AAA"));
+
+    EXPECT_EQ(FixMsgType::LOGON, StreamParserUtils::classifyMsgTypeField("35=A\x01", 5));
+    EXPECT_EQ(FixMsgType::UNKNOWN, StreamParserUtils::classifyMsgTypeField("35=A", 4)); // No SOH yet
+    EXPECT_EQ(FixMsgType::UNKNOWN, StreamParserUtils::classifyMsgTypeField("49=A\x01", 5));
+}
+
+TEST_F(StreamFixParserComprehensiveTest, FramingPeekDispatchesAndStampsMsgType)
+{
+    std::string report = createExecutionReport("37=ORD\x01" "17=EX\x01" "150=0\x01" "39=0\x01"
+                                               "55=MSFT\x01" "54=1\x01" "151=100\x01" "14=0\x01");
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, StreamParserUtils::peekMsgType(report.data(), report.size()));
+
+    std::string snapshot = frameFixBody("35=W\x01" "49=FEED\x01" "56=CLIENT\x01" "34=3\x01"
+                                        "52=20231201-12:00:00\x01" "55=EURUSD\x01");
+    auto result = parser_->parse(report.data(), report.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    ASSERT_NE(nullptr, result.parsed_message);
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, result.parsed_message->getMsgTypeEnum());
+    EXPECT_FALSE(result.parsed_message->isAdminMessage());
+    message_pool_->deallocate(result.parsed_message);
+
+    result = parser_->parse(snapshot.data(), snapshot.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    ASSERT_NE(nullptr, result.parsed_message);
+    EXPECT_EQ(FixMsgType::MARKET_DATA_SNAPSHOT, result.parsed_message->getMsgTypeEnum());
+    EXPECT_EQ("EURUSD", result.parsed_message->getSymbol());
+    message_pool_->deallocate(result.parsed_message);
+}
+
+TEST_F(StreamFixParserComprehensiveTest, PrefilterSkipsFramesBeforeAllocation)
+{
+    MessagePrefilter prefilter;
+    prefilter.setAction(FixMsgType::HEARTBEAT, PrefilterAction::Drop);
+    ASSERT_TRUE(prefilter.addFieldRule(FixMsgType::MARKET_DATA_SNAPSHOT, FixFields::Symbol, {"AAPL", "MSFT"},
+                                       PrefilterAction::Parse, PrefilterAction::Drop));
+    ASSERT_TRUE(prefilter.addFieldRule(FixMsgType::EXECUTION_REPORT, FixFields::Account, {"DESK1"},
+                                       PrefilterAction::Parse, PrefilterAction::PassThrough));
+    EXPECT_FALSE(prefilter.addFieldRule(FixMsgType::EXECUTION_REPORT, FixFields::ClOrdID, {"X"},
+                                        PrefilterAction::Parse, PrefilterAction::Drop)); // Not peekable
+
+    std::vector<std::pair<FixMsgType, std::string>> passed;
+    parser_->setPrefilter(&prefilter);
+    parser_->setPassThroughHandler([&](FixMsgType type, const char *frame, size_t length)
+                                   { passed.emplace_back(type, std::string(frame, length)); });
+
+    auto snapshot = [this](const std::string &symbol)
+    {
+        return frameFixBody("35=W\x01" "49=FEED\x01" "56=CLIENT\x01" "34=3\x01"
+                            "52=20231201-12:00:00\x01" "55=" + symbol + "\x01");
+    };
+    std::string other_desk = createExecutionReport("1=DESK9\x01" "37=ORD2\x01");
+    std::vector<std::string> msgs = {createHeartbeat(), snapshot("AAPL"), snapshot("EURUSD"),
+                                     createExecutionReport("1=DESK1\x01" "37=ORD1\x01"), other_desk};
+    std::string buffer;
+    for (const auto &m : msgs)
+    {
+        buffer += m;
+    }
+
+    FixMessage *out[16];
+    auto result = parser_->parseBatch(buffer.data(), buffer.size(), out, 16);
+
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    ASSERT_EQ(2U, result.messages_parsed);
+    EXPECT_EQ(3U, result.messages_filtered);
+    EXPECT_EQ(buffer.size(), result.bytes_consumed);
+    EXPECT_EQ(2U, message_pool_->allocated()); // Filtered frames never reached the pool
+    EXPECT_EQ("AAPL", out[0]->getSymbol());
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, out[1]->getMsgTypeEnum());
+
+    ASSERT_EQ(1U, passed.size());
+    EXPECT_EQ(FixMsgType::EXECUTION_REPORT, passed[0].first);
+    EXPECT_EQ(other_desk, passed[0].second);
+
+    const auto &stats = parser_->getStats();
+    EXPECT_EQ(1U, static_cast<uint64_t>(stats.prefilter_passed_through));
+    EXPECT_EQ(2U, static_cast<uint64_t>(stats.prefilter_dropped));
+    EXPECT_EQ(1U, stats.prefilteredCount(FixMsgType::HEARTBEAT));
+    EXPECT_EQ(1U, stats.prefilteredCount(FixMsgType::MARKET_DATA_SNAPSHOT));
+    EXPECT_EQ(2U, static_cast<uint64_t>(stats.messages_parsed));
+
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        message_pool_->deallocate(out[i]);
+    }
+}
+
+TEST_F(StreamFixParserComprehensiveTest, PrefilterRulesKeepMostPermissiveOutcome)
+{
+    MessagePrefilter prefilter;
+    prefilter.addFieldRule(FixMsgType::EXECUTION_REPORT, FixFields::Account, {"DESK1"},
+                           PrefilterAction::Parse, PrefilterAction::Drop);
+    prefilter.addFieldRule(FixMsgType::EXECUTION_REPORT, FixFields::SenderSubID, {"TRADER7"},
+                           PrefilterAction::Parse, PrefilterAction::Drop);
+    parser_->setPrefilter(&prefilter);
+
+    // Either rule matching is enough to keep the report
+    std::string kept = createExecutionReport("50=TRADER7\x01" "1=DESK9\x01");
+    auto result = parser_->parse(kept.data(), kept.size());
+    ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status) << result.error_detail;
+    message_pool_->deallocate(result.parsed_message);
+
+    // Neither matches (and a missing tag never matches) - consumed without a message
+    std::string dropped = createExecutionReport("50=TRADER2\x01");
+    result = parser_->parse(dropped.data(), dropped.size());
+    EXPECT_EQ(StreamFixParser::ParseStatus::NeedMoreData, result.status);
+    EXPECT_EQ(dropped.size(), result.bytes_consumed);
+    EXPECT_EQ(nullptr, result.parsed_message);
+    EXPECT_FALSE(parser_->hasPartialMessage());
+    EXPECT_EQ(0U, message_pool_->allocated());
+    EXPECT_EQ(1U, static_cast<uint64_t>(parser_->getStats().prefilter_dropped));
+}
+
+TEST_F(StreamFixParserComprehensiveTest, PassThroughFramesAreChecksummedFirst)
+{
+    MessagePrefilter prefilter;
+    prefilter.setAction(FixMsgType::EXECUTION_REPORT, PrefilterAction::PassThrough);
+    EXPECT_FALSE(prefilter.filtersSessionMessages());
+    size_t passed = 0;
+    parser_->setPrefilter(&prefilter);
+    parser_->setPassThroughHandler([&](FixMsgType, const char *, size_t)
+                                   { passed++; });
+
+    // Corrupt the CheckSum value: the frame is decoded and rejected, not handed out
+    std::string corrupt = createExecutionReport();
+    char &digit = corrupt[corrupt.size() - 2];
+    digit = digit == '9' ? '0' : static_cast<char>(digit + 1);
+    auto result = parser_->parse(corrupt.data(), corrupt.size());
+    EXPECT_EQ(StreamFixParser::ParseStatus::ChecksumError, result.status);
+    EXPECT_EQ(0U, passed);
+    EXPECT_EQ(0U, static_cast<uint64_t>(parser_->getStats().prefilter_passed_through));
+
+    std::string valid = createExecutionReport();
+    result = parser_->parse(valid.data(), valid.size());
+    EXPECT_EQ(nullptr, result.parsed_message);
+    EXPECT_EQ(1U, passed);
+
+    // Any non-Parse outcome for a session-level type makes it unfit for a session path
+    prefilter.setAction(FixMsgType::HEARTBEAT, PrefilterAction::Drop);
+    EXPECT_TRUE(prefilter.filtersSessionMessages());
+}
+
 // =================================================================
 // ERROR HANDLING TESTS
 // =================================================================
@@ -578,6 +2002,83 @@ TEST_F(StreamFixParserComprehensiveTest, StatisticsTracking)
     EXPECT_EQ(1U, stats_after_error.parse_errors);
 }
 
+TEST_F(StreamFixParserComprehensiveTest, StatisticsSnapshotWhileParsing)
+{
+    parser_->resetStats();
+    std::string msg = createExecutionReport();
+    constexpr uint64_t MESSAGES = 2000;
+
+    // Monitor thread snapshots while the parsing thread is writing
+    std::atomic<bool> done{false};
+    bool monotonic = true;
+    std::thread monitor([&]()
+                        {
+        uint64_t last = 0;
+        while (!done.load(std::memory_order_acquire))
+        {
+            auto snap = parser_->getStats().snapshot();
+            monotonic = monotonic && snap.messages_parsed >= last;
+            last = snap.messages_parsed;
+        } });
+
+    for (uint64_t i = 0; i < MESSAGES; ++i)
+    {
+        auto result = parser_->parse(msg.c_str(), msg.length());
+        ASSERT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+        message_pool_->deallocate(result.parsed_message);
+    }
+    done.store(true, std::memory_order_release);
+    monitor.join();
+    EXPECT_TRUE(monotonic);
+
+    auto snap = parser_->getStats().snapshot();
+    EXPECT_EQ(MESSAGES, snap.messages_parsed);
+    EXPECT_EQ(MESSAGES, snap.parse_time.total_count);
+    EXPECT_LE(snap.p50ParseTimeNs(), snap.p99ParseTimeNs());
+    EXPECT_LE(snap.p99ParseTimeNs(), snap.p999ParseTimeNs());
+    EXPECT_GE(snap.p999ParseTimeNs(), snap.min_parse_time_ns);
+
+    // Error patterns are counted in enum-indexed slots
+    parser_->setValidateChecksum(true);
+    std::string bad = createExecutionReport();
+    bad[bad.find("SENDER")] = 'T';
+    auto result = parser_->parse(bad.c_str(), bad.length());
+    EXPECT_EQ(StreamFixParser::ParseStatus::ChecksumError, result.status);
+    EXPECT_EQ(MESSAGES, parser_->getStats().messages_parsed);
+    EXPECT_EQ(1U, parser_->getStats().errorCount(StreamFixParser::ParseStatus::ChecksumError));
+    EXPECT_EQ(0U, parser_->getStats().errorCount(StreamFixParser::ParseStatus::AllocationFailed));
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinBucketPrecision)
+{
+    using fix_gateway::utils::LatencyHistogram;
+
+    // Bucket bounds tile the value range without gaps
+    for (uint64_t value : {0ULL, 31ULL, 32ULL, 33ULL, 1000ULL, 123456ULL, 1ULL << 39})
+    {
+        size_t index = LatencyHistogram::bucketIndex(value);
+        EXPECT_LE(LatencyHistogram::lowestEquivalentValue(index), value);
+        EXPECT_GE(LatencyHistogram::highestEquivalentValue(index), value);
+    }
+    EXPECT_EQ(LatencyHistogram::BUCKET_COUNT - 1, LatencyHistogram::bucketIndex(UINT64_MAX));
+
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    auto snap = histogram.snapshot();
+    EXPECT_EQ(100000U, snap.total_count);
+    const double precision = 1.0 / LatencyHistogram::SUB_BUCKET_COUNT;
+    EXPECT_NEAR(50000.0, static_cast<double>(snap.percentile(50.0)), 50000.0 * precision);
+    EXPECT_NEAR(99000.0, static_cast<double>(snap.percentile(99.0)), 99000.0 * precision);
+    EXPECT_NEAR(99900.0, static_cast<double>(snap.percentile(99.9)), 99900.0 * precision);
+
+    histogram.reset();
+    EXPECT_EQ(0U, histogram.snapshot().percentile(99.0));
+}
+
 // =================================================================
 // CONFIGURATION TESTS
 // =================================================================
@@ -924,6 +2425,50 @@ TEST_F(StreamFixParserComprehensiveTest, MemoryPoolExhaustion)
     }
 }
 
+TEST_F(StreamFixParserComprehensiveTest, BatchHoldsInputWhilePoolIsExhausted)
+{
+    auto small_pool = std::make_unique<MessagePool<FixMessage>>(4, "small_test_pool");
+    auto small_parser = std::make_unique<StreamFixParser>(small_pool.get());
+    std::vector<FixMessage *> hogs;
+    for (int i = 0; i < 3; ++i)
+    {
+        hogs.push_back(small_pool->allocate());
+    }
+
+    std::string msg = createExecutionReport();
+    size_t half = msg.size() / 2;
+    FixMessage *out[8];
+
+    // First message takes the last slot, the second one's head is carried over
+    std::string first = msg + msg.substr(0, half);
+    auto result = small_parser->parseBatch(first.data(), first.size(), out, 8);
+    ASSERT_EQ(1U, result.messages_parsed);
+    small_pool->deallocate(out[0]);
+    hogs.push_back(small_pool->allocate());
+
+    // Completing the carried message fails to allocate: the new bytes are held too
+    std::string second = msg.substr(half) + msg;
+    result = small_parser->parseBatch(second.data(), second.size(), out, 8);
+    EXPECT_EQ(StreamFixParser::ParseStatus::AllocationFailed, result.status);
+    EXPECT_EQ(0U, result.messages_parsed);
+    EXPECT_EQ(second.size(), result.bytes_consumed);
+    EXPECT_TRUE(small_parser->hasPartialMessage());
+
+    // With slots free again the held frames come out ahead of the next read
+    for (auto *hog : hogs)
+    {
+        small_pool->deallocate(hog);
+    }
+    result = small_parser->parseBatch(msg.data(), msg.size(), out, 8);
+    EXPECT_EQ(StreamFixParser::ParseStatus::Success, result.status);
+    ASSERT_EQ(3U, result.messages_parsed);
+    EXPECT_FALSE(small_parser->hasPartialMessage());
+    for (size_t i = 0; i < result.messages_parsed; ++i)
+    {
+        small_pool->deallocate(out[i]);
+    }
+}
+
 // =================================================================
 // MAIN FUNCTION FOR STANDALONE EXECUTION
 // =================================================================
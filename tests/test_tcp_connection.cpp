@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "network/tcp_connection.h"
+#include "common/constants.h"
+#include "common/receive_ring.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fix_gateway::network;
+using fix_gateway::common::ReceiveRing;
+
+class TcpConnectionTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_GE(listen_fd_, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_EQ(0, ::bind(listen_fd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+        ASSERT_EQ(0, ::listen(listen_fd_, 1));
+        socklen_t length = sizeof(addr);
+        ASSERT_EQ(0, ::getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &length));
+        port_ = ntohs(addr.sin_port);
+        tcp_ = std::make_shared<TcpConnection>();
+    }
+
+    void TearDown() override
+    {
+        tcp_->disconnect();
+        if (peer_fd_ >= 0)
+        {
+            ::close(peer_fd_);
+        }
+        ::close(listen_fd_);
+    }
+
+    void connectPeer()
+    {
+        ASSERT_TRUE(tcp_->connect("127.0.0.1", port_));
+        peer_fd_ = ::accept(listen_fd_, nullptr, nullptr);
+        ASSERT_GE(peer_fd_, 0);
+    }
+
+    int listen_fd_ = -1;
+    int peer_fd_ = -1;
+    int port_ = 0;
+    std::shared_ptr<TcpConnection> tcp_;
+};
+
+TEST_F(TcpConnectionTest, RingThatStaysFullIsReported)
+{
+    // A consumer that never frees ring space: reads stop and, once the stall
+    // outlasts RING_STALL_TIMEOUT_MS, the error callback hears about it once
+    ReceiveRing ring(4096);
+    std::mutex errors_mutex;
+    std::vector<std::string> errors;
+    tcp_->setReceiveRing(&ring);
+    tcp_->setRingCallback([](ReceiveRing &) {});
+    tcp_->setErrorCallback([&](const std::string &error)
+                           {
+                               std::lock_guard<std::mutex> lock(errors_mutex);
+                               errors.push_back(error);
+                           });
+    connectPeer();
+    tcp_->startReceiveLoop();
+
+    std::string payload(2 * ring.capacity(), 'x');
+    ASSERT_EQ(static_cast<ssize_t>(payload.size()), ::send(peer_fd_, payload.data(), payload.size(), 0));
+
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(fix_gateway::constants::RING_STALL_TIMEOUT_MS * 3);
+    size_t reported = 0;
+    while (reported == 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::lock_guard<std::mutex> lock(errors_mutex);
+        reported = errors.size();
+    }
+    EXPECT_EQ(0U, ring.writable());
+    EXPECT_TRUE(tcp_->isConnected());
+
+    // Stop the receive thread before the ring and the callback state go away
+    tcp_->disconnect();
+    ASSERT_EQ(1U, reported);
+    EXPECT_NE(std::string::npos, errors[0].find("Receive ring full"));
+}